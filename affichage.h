@@ -0,0 +1,135 @@
+//
+// Created by ACER on 06/01/2025.
+//
+
+#ifndef TEST1_AFFICHAGE_H
+#define TEST1_AFFICHAGE_H
+#include "global.h"
+
+//Affichage différé des widgets créés.
+//Un gtk_widget_show_all() sur la fenetre ou sur la zone de prévisualisation parcourt tout
+//l'arbre des widgets et redemande une allocation, ce qui coute cher quand on l'appelle
+//après chaque widget. Les widgets créés sont donc construits cachés puis mis en attente
+//avec afficher_plus_tard(): les sous-arbres en attente sont affichés ensemble, une seule
+//fois, à la fin du lot (fin_lot_affichage) ou au plus tard juste avant la prochaine
+//image (callback idle de priorité plus haute que l'allocation et le dessin de GTK).
+
+//Widgets dont le sous-arbre attend d'etre affiché (une référence est gardée sur chacun)
+static GPtrArray* affichages_en_attente = NULL;
+//Source idle qui vide la file avant la prochaine image (0 si aucune)
+static guint affichages_idle_id = 0;
+//Profondeur des lots ouverts: tant qu'un lot est ouvert, rien n'est affiché
+static gint affichages_profondeur_lot = 0;
+//Nombre de sous-arbres affichés depuis le lancement (mesures)
+static guint affichages_nb_passes = 0;
+
+
+/**********************************************************************************************************
+ Nom            : racine_cachee()
+ Entrée         : widget - Un widget en attente d'affichage
+ Sortie         : Le plus haut ancetre caché du widget (le widget lui-meme si son père est visible)
+ Description    : Un widget peut etre placé dans un conteneur créé dans le meme lot et encore caché:
+                  on affiche alors le sous-arbre à partir de ce conteneur. On ne remonte jamais
+                  jusqu'à une fenetre, qui reste affichée par son créateur.
+**********************************************************************************************************/
+static GtkWidget* racine_cachee(GtkWidget* widget) {
+    GtkWidget* pere;
+    while ((pere = gtk_widget_get_parent(widget)) && !gtk_widget_get_visible(pere)
+           && !gtk_widget_is_toplevel(pere))
+        widget = pere;
+    return widget;
+}
+
+/**********************************************************************************************************
+ Nom            : afficher_en_attente()
+ Entrée         : Aucune
+ Sortie         : Aucune
+ Description    : Affiche tout de suite les sous-arbres en attente, chacun une seule fois. Les widgets
+                  détruits, retirés de leur conteneur ou déjà affichés (par exemple par le
+                  gtk_widget_show_all() final d'une fenetre chargée depuis le XML) sont ignorés.
+**********************************************************************************************************/
+void afficher_en_attente() {
+    if (affichages_idle_id) {
+        g_source_remove(affichages_idle_id);
+        affichages_idle_id = 0;
+    }
+    if (!affichages_en_attente)
+        return;
+
+    for (guint i = 0; i < affichages_en_attente->len; i++) {
+        GtkWidget* widget = g_ptr_array_index(affichages_en_attente, i);
+        if (gtk_widget_get_parent(widget) && !gtk_widget_get_visible(widget)) {
+            gtk_widget_show_all(racine_cachee(widget));
+            affichages_nb_passes++;
+        }
+        g_object_unref(widget);
+    }
+    g_ptr_array_set_size(affichages_en_attente, 0);
+}
+
+//Vide la file avant l'allocation et le dessin de la prochaine image
+static gboolean affichages_idle(gpointer data) {
+    affichages_idle_id = 0;
+    if (affichages_profondeur_lot == 0)
+        afficher_en_attente();
+    return G_SOURCE_REMOVE;
+}
+
+/**********************************************************************************************************
+ Nom            : afficher_plus_tard()
+ Entrée         : widget - Le widget (et son sous-arbre) à afficher
+ Sortie         : Aucune
+ Description    : Met le widget en attente au lieu de l'afficher tout de suite. Il sera affiché à la
+                  fin du lot en cours, ou avant la prochaine image s'il n'y a pas de lot ouvert.
+**********************************************************************************************************/
+void afficher_plus_tard(GtkWidget* widget) {
+    if (!widget) return;
+    if (!affichages_en_attente)
+        affichages_en_attente = g_ptr_array_new();
+    g_ptr_array_add(affichages_en_attente, g_object_ref(widget));
+
+    if (affichages_profondeur_lot == 0 && !affichages_idle_id)
+        affichages_idle_id = g_idle_add_full(G_PRIORITY_HIGH_IDLE, affichages_idle, NULL, NULL);
+}
+
+//Ouvre un lot: les widgets mis en attente ne sont affichés qu'à la fermeture du lot
+void debut_lot_affichage() {
+    affichages_profondeur_lot++;
+}
+
+//Ferme un lot: à la fermeture du dernier lot ouvert, tous les widgets en attente sont affichés
+void fin_lot_affichage() {
+    if (affichages_profondeur_lot > 0 && --affichages_profondeur_lot == 0)
+        afficher_en_attente();
+}
+
+//Termine la mesure "premiere image" au premier dessin de la fenetre
+static gboolean premiere_image_dessinee(GtkWidget* fenetre, cairo_t* cr, gpointer data) {
+    gint64* debut = g_object_get_data(G_OBJECT(fenetre), "premiere_image_debut");
+    if (debut)
+        TRACE_SPAN_FIN(*debut, TRACE_AFFICHAGE, "premiere image");
+    g_signal_handlers_disconnect_by_func(fenetre, premiere_image_dessinee, data);
+    g_object_set_data(G_OBJECT(fenetre), "premiere_image_debut", NULL);
+    return FALSE;
+}
+
+/**********************************************************************************************************
+ Nom            : suivre_premiere_image()
+ Entrée         : fenetre - Une fenetre qui vient d'etre créée
+ Sortie         : Aucune
+ Description    : Profil (trace.h): mesure le temps entre la création de la fenetre et son premier
+                  dessin, c'est-à-dire le temps que l'utilisateur attend avant de voir l'interface.
+                  Ne fait rien si le profil n'est pas actif.
+**********************************************************************************************************/
+void suivre_premiere_image(GtkWidget* fenetre) {
+    TRACE_SPAN_DEBUT(debut);
+    if (!fenetre || !debut)
+        return;
+    gint64* copie = g_new(gint64, 1);
+    *copie = debut;
+    g_object_set_data_full(G_OBJECT(fenetre), "premiere_image_debut", copie, g_free);
+    g_signal_connect_after(fenetre, "draw", G_CALLBACK(premiere_image_dessinee), NULL);
+}
+
+
+#endif //TEST1_AFFICHAGE_H
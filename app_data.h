@@ -14,6 +14,7 @@ typedef struct _AppData {
     GtkWidget *properties_panel;  // Right panel for properties
     GtkWidget *properties_content; // Content area for properties (to be dynamically replaced)
     GList *containers;           // List of available containers
+    GtkListStore *container_store; // Model of the container combos (see get_container_store)
     GtkWidget *selected_container; // Currently selected container (NULL = preview area)
     GtkWidget *container_combo;  // Combo box for container selection
     GtkWidget *selected_widget;  // Currently selected widget for property editing
@@ -34,7 +35,29 @@ typedef struct _AppData {
     // int argc;
 } AppData;
 
+// Columns of the container combo model
+enum {
+    CONTAINER_COL_NAME,          // Displayed name
+    CONTAINER_COL_WIDGET,        // The container (NULL for the preview area)
+    CONTAINER_N_COLUMNS
+};
+
+// Columns of the widget hierarchy model
+enum {
+    HIERARCHY_COL_LABEL,         // Displayed text
+    HIERARCHY_COL_WIDGET,        // The widget (NULL for menu and menu item rows)
+    HIERARCHY_COL_MENU,          // Menu* of a menu row (see menu_dialog.h), NULL otherwise
+    HIERARCHY_COL_ITEM,          // MenuItem* of a menu item row, NULL otherwise
+    HIERARCHY_N_COLUMNS
+};
+
 // Function declaration to resolve circular dependency
 void update_container_combo(AppData *app_data);
+void add_container(AppData *app_data, GtkWidget *container);
+void remove_container(AppData *app_data, GtkWidget *container);
+GtkWidget *create_container_combo(AppData *app_data);
+void select_current_container(GtkComboBox *combo, AppData *app_data);
+GtkWidget *get_selected_container(GtkComboBox *combo, AppData *app_data);
+GtkWidget *menu_hierarchy_row_widget(GtkTreeModel *model, GtkTreeIter *iter);
 
 #endif /* APP_DATA_H */
@@ -0,0 +1,602 @@
+//
+// Created by ACER on 06/01/2025.
+//
+// Mesure du temps de chargement XML des boutons (normal, checkbox, radio) et du temps
+// d'application des styles sur un layout de 5000 boutons, du temps entre le début du
+// chargement et la première image de la fenetre, et du nombre de passes d'allocation.
+// Compare aussi l'affichage après chaque widget (avant) et l'affichage différé (après).
+// Vérifie enfin que charger puis détruire un layout ne laisse aucune mémoire derrière lui,
+// et que des sous-menus très imbriqués se chargent sans récursion.
+// Compilation: ./build.sh bench_xml.c
+//
+
+#include <gtk/gtk.h>
+#include "global.h"
+#include "xml_utility.h"
+#include "bouton_xml.h"
+#include "checkbox_xml.h"
+#include "dialog_xml.h"
+#include "radio_xml.h"
+#include "box.h"
+#include "menu_xml.h"
+#include "fixed_virtuel_xml.h"
+
+#define BENCH_NB_BOUTONS 5000
+#define BENCH_FICHIER "bench_5k.html"
+//Widgets ajoutés un par un, comme depuis les dialogues de création
+#define BENCH_NB_AJOUTS 5000
+//Attente maximale de la première image (sans serveur d'affichage, elle n'arrive jamais)
+#define BENCH_ATTENTE_MAX_US (10 * G_USEC_PER_SEC)
+//Grand canevas décrit par l'Arbre, affiché avec le fixed virtuel
+#define BENCH_NB_VIRTUELS 20000
+#define BENCH_FICHIER_VIRTUEL "bench_virtuel.html"
+//Chargements/destructions successifs d'un petit layout (mémoire vivante comparée)
+#define BENCH_NB_CYCLES 1000
+#define BENCH_FICHIER_CYCLES "bench_cycles.html"
+//Profondeur de la chaine de sous-menus (une récursion par niveau épuiserait la pile)
+#define BENCH_PROFONDEUR_MENUS 20000
+#define BENCH_FICHIER_MENUS "bench_menus.html"
+
+//Quelques looks répétés, comme dans un vrai formulaire
+static const char* bench_polices[] = {"Sans", "Consolas", "Arial", "Serif"};
+static const char* bench_couleurs[] = {"#000000", "#F25ACE", "#1E1E1E", "#FFFFFF"};
+static const char* bench_fonds[] = {"#F2FAAE", "#FFFFFF", "#6699ff", "#ff6666"};
+
+//Ecrit un layout avec BENCH_NB_BOUTONS boutons: moitié normaux, un quart checkbox,
+//un quart radios (par listes de 4)
+static int bench_generer_layout(const char* chemin) {
+    FILE* f = fopen(chemin, "w");
+    if (!f) {
+        printf("ERREUR de creation du fichier %s !!\n", chemin);
+        return 0;
+    }
+    fprintf(f, "<window>\n"
+               "    <property name=\"title\" >Bench</property>\n"
+               "    <property name=\"width\" >1200</property>\n"
+               "    <property name=\"height\" >900</property>\n"
+               "    <property name=\"resizable\" >1</property>\n"
+               "    <property name=\"border\" >0</property>\n"
+               "    <property name=\"position\" >c</property>\n"
+               "    <property name=\"x\" >0</property>\n"
+               "    <property name=\"y\" >0</property>\n"
+               "    <property name=\"icon\" >icon.png</property>\n"
+               "    <child>\n"
+               "        <fixed>\n"
+               "            <children>\n");
+
+    int nb_normaux = BENCH_NB_BOUTONS / 2;
+    int nb_checks = BENCH_NB_BOUTONS / 4;
+    int nb_radios = BENCH_NB_BOUTONS - nb_normaux - nb_checks;
+
+    for (int i = 0; i < nb_normaux; i++) {
+        int k = i % 4;
+        fprintf(f, "                <button>\n"
+                   "                    <property name=\"nom\" >b%d</property>\n"
+                   "                    <property name=\"text\" >b%d</property>\n"
+                   "                    <property name=\"x\" >%d</property>\n"
+                   "                    <property name=\"y\" >%d</property>\n"
+                   "                    <property name=\"width\" >60</property>\n"
+                   "                    <property name=\"height\" >20</property>\n"
+                   "                    <property name=\"police\" >%s</property>\n"
+                   "                    <property name=\"color\" >%s</property>\n"
+                   "                    <property name=\"bgcolor\" >%s</property>\n"
+                   "                    <property name=\"taille\" >%d</property>\n"
+                   "                    <property name=\"gras\" >%d</property>\n"
+                   "                    <property name=\"border\" >1</property>\n"
+                   "                    <property name=\"border_radius\" >3</property>\n"
+                   "                </button>\n",
+                i, i, (i % 20) * 60, (i / 20) * 22,
+                bench_polices[k], bench_couleurs[k], bench_fonds[k], 10 + k, k % 2);
+    }
+    for (int i = 0; i < nb_checks; i++) {
+        fprintf(f, "                <checkbox>\n"
+                   "                    <property name=\"text\" >c%d</property>\n"
+                   "                    <property name=\"x\" >%d</property>\n"
+                   "                    <property name=\"y\" >%d</property>\n"
+                   "                    <property name=\"checked\" >%d</property>\n"
+                   "                </checkbox>\n",
+                i, (i % 20) * 60, 1200 + (i / 20) * 22, i % 2);
+    }
+    for (int i = 0; i < nb_radios; i += 4) {
+        fprintf(f, "                <radioList x=%d y=%d >\n", (i % 80) * 15, 1600 + (i / 80) * 22);
+        for (int j = 0; j < 4 && i + j < nb_radios; j++) {
+            int k = (i + j) % 4;
+            fprintf(f, "                    <radio>\n"
+                       "                        <property name=\"text\" >r%d</property>\n"
+                       "                        <property name=\"mnemonic\" >0</property>\n"
+                       "                        <property name=\"police\" >%s</property>\n"
+                       "                        <property name=\"color\" >%s</property>\n"
+                       "                        <property name=\"taille\" >%d</property>\n"
+                       "                    </radio>\n",
+                    i + j, bench_polices[k], bench_couleurs[k], 10 + k);
+        }
+        fprintf(f, "                </radioList>\n");
+    }
+
+    fprintf(f, "            </children>\n"
+               "        </fixed>\n"
+               "    </child>\n"
+               "</window>\n");
+    fclose(f);
+    return 1;
+}
+
+//Ecrit un petit layout avec un widget de chaque sorte courante (boutons, checkbox,
+//radios, labels, entries)
+static int bench_generer_cycles(const char* chemin) {
+    FILE* f = fopen(chemin, "w");
+    if (!f) {
+        printf("ERREUR de creation du fichier %s !!\n", chemin);
+        return 0;
+    }
+    fprintf(f, "<window>\n"
+               "    <property name=\"title\" >Cycles</property>\n"
+               "    <property name=\"width\" >400</property>\n"
+               "    <property name=\"height\" >300</property>\n"
+               "    <property name=\"resizable\" >1</property>\n"
+               "    <property name=\"border\" >0</property>\n"
+               "    <property name=\"position\" >c</property>\n"
+               "    <property name=\"x\" >0</property>\n"
+               "    <property name=\"y\" >0</property>\n"
+               "    <child>\n"
+               "        <fixed>\n"
+               "            <children>\n");
+    for (int i = 0; i < 4; i++)
+        fprintf(f, "                <button>\n"
+                   "                    <property name=\"nom\" >b%d</property>\n"
+                   "                    <property name=\"text\" >b%d</property>\n"
+                   "                    <property name=\"x\" >%d</property>\n"
+                   "                    <property name=\"y\" >0</property>\n"
+                   "                    <property name=\"width\" >60</property>\n"
+                   "                    <property name=\"height\" >20</property>\n"
+                   "                    <property name=\"police\" >%s</property>\n"
+                   "                    <property name=\"color\" >%s</property>\n"
+                   "                    <property name=\"bgcolor\" >%s</property>\n"
+                   "                    <property name=\"taille\" >12</property>\n"
+                   "                    <property name=\"gras\" >0</property>\n"
+                   "                    <property name=\"border\" >1</property>\n"
+                   "                    <property name=\"border_radius\" >3</property>\n"
+                   "                </button>\n",
+                i, i, i * 70, bench_polices[i], bench_couleurs[i], bench_fonds[i]);
+    for (int i = 0; i < 2; i++)
+        fprintf(f, "                <checkbox>\n"
+                   "                    <property name=\"text\" >c%d</property>\n"
+                   "                    <property name=\"x\" >%d</property>\n"
+                   "                    <property name=\"y\" >40</property>\n"
+                   "                    <property name=\"checked\" >%d</property>\n"
+                   "                </checkbox>\n",
+                i, i * 70, i);
+    fprintf(f, "                <radioList x=0 y=80 >\n");
+    for (int i = 0; i < 3; i++)
+        fprintf(f, "                    <radio>\n"
+                   "                        <property name=\"text\" >r%d</property>\n"
+                   "                        <property name=\"mnemonic\" >0</property>\n"
+                   "                        <property name=\"police\" >%s</property>\n"
+                   "                        <property name=\"color\" >%s</property>\n"
+                   "                        <property name=\"taille\" >12</property>\n"
+                   "                    </radio>\n",
+                i, bench_polices[i], bench_couleurs[i]);
+    fprintf(f, "                </radioList>\n");
+    for (int i = 0; i < 2; i++)
+        fprintf(f, "                <label>\n"
+                   "                    <property name=\"text\" >l%d</property>\n"
+                   "                    <property name=\"x\" >%d</property>\n"
+                   "                    <property name=\"y\" >160</property>\n"
+                   "                    <property name=\"width\" >60</property>\n"
+                   "                    <property name=\"height\" >20</property>\n"
+                   "                    <property name=\"color\" >%s</property>\n"
+                   "                    <property name=\"police\" >%s</property>\n"
+                   "                    <property name=\"taille\" >12</property>\n"
+                   "                    <property name=\"gras\" >%d</property>\n"
+                   "                </label>\n",
+                i, i * 70, bench_couleurs[i], bench_polices[i], i);
+    for (int i = 0; i < 2; i++)
+        fprintf(f, "                <entry>\n"
+                   "                    <property name=\"type\" >%s</property>\n"
+                   "                    <property name=\"placeholder\" >e%d</property>\n"
+                   "                    <property name=\"visible\" >1</property>\n"
+                   "                    <property name=\"editable\" >1</property>\n"
+                   "                    <property name=\"x\" >%d</property>\n"
+                   "                    <property name=\"y\" >200</property>\n"
+                   "                    <property name=\"width\" >100</property>\n"
+                   "                    <property name=\"height\" >20</property>\n"
+                   "                    <property name=\"max\" >20</property>\n"
+                   "                    <property name=\"default_text\" >e%d</property>\n"
+                   "                </entry>\n",
+                i ? "pass" : "basic", i, i * 120, i);
+    fprintf(f, "            </children>\n"
+               "        </fixed>\n"
+               "    </child>\n"
+               "</window>\n");
+    fclose(f);
+    return 1;
+}
+
+//Traite les évènements en attente (calcul des styles, allocation, dessin)
+static void bench_vider_evenements() {
+    while (gtk_events_pending())
+        gtk_main_iteration();
+}
+
+//Passes d'allocation des fenetres et instant de la première image, relevés par des
+//emission hooks: ils voient aussi les fenetres créées par le chargeur XML
+static guint bench_nb_allocations = 0;
+static gint64 bench_premiere_image = 0;
+
+static gboolean bench_hook_allocation(GSignalInvocationHint* hint, guint nb, const GValue* params, gpointer data) {
+    if (gtk_widget_is_toplevel(GTK_WIDGET(g_value_get_object(&params[0]))))
+        bench_nb_allocations++;
+    return TRUE;
+}
+
+static gboolean bench_hook_dessin(GSignalInvocationHint* hint, guint nb, const GValue* params, gpointer data) {
+    if (!bench_premiere_image && gtk_widget_is_toplevel(GTK_WIDGET(g_value_get_object(&params[0]))))
+        bench_premiere_image = g_get_monotonic_time();
+    return TRUE;
+}
+
+static void bench_installer_hooks() {
+    g_type_class_unref(g_type_class_ref(GTK_TYPE_WIDGET));
+    g_signal_add_emission_hook(g_signal_lookup("size-allocate", GTK_TYPE_WIDGET), 0,
+                               bench_hook_allocation, NULL, NULL);
+    g_signal_add_emission_hook(g_signal_lookup("draw", GTK_TYPE_WIDGET), 0,
+                               bench_hook_dessin, NULL, NULL);
+}
+
+//Remet les compteurs à zéro avant une mesure
+static void bench_debut_mesure() {
+    bench_nb_allocations = 0;
+    bench_premiere_image = 0;
+}
+
+//Fait tourner la boucle principale jusqu'à la première image (ou l'attente maximale)
+static gint64 bench_attendre_image() {
+    gint64 limite = g_get_monotonic_time() + BENCH_ATTENTE_MAX_US;
+    while (!bench_premiere_image && g_get_monotonic_time() < limite)
+        gtk_main_iteration_do(FALSE);
+    bench_vider_evenements();
+    return bench_premiere_image;
+}
+
+//Ajoute BENCH_NB_AJOUTS boutons un par un dans un GtkFixed déjà affiché.
+//par_widget: ancien comportement, gtk_widget_show_all() du conteneur après chaque widget;
+//sinon les widgets sont mis en attente et affichés en une seule fois.
+static void bench_ajouts(gboolean par_widget, gint64* duree, guint* allocations) {
+    GtkWidget* fenetre = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    GtkWidget* fixed = gtk_fixed_new();
+    gtk_window_set_default_size(GTK_WINDOW(fenetre), 1200, 900);
+    gtk_container_add(GTK_CONTAINER(fenetre), fixed);
+    gtk_widget_show_all(fenetre);
+    bench_attendre_image();
+
+    bench_debut_mesure();
+    gint64 debut = g_get_monotonic_time();
+    for (int i = 0; i < BENCH_NB_AJOUTS; i++) {
+        GtkWidget* bouton = gtk_button_new_with_label("a");
+        gtk_fixed_put(GTK_FIXED(fixed), bouton, (i % 20) * 60, (i / 20) * 22);
+        if (par_widget)
+            gtk_widget_show_all(fixed);
+        else
+            afficher_plus_tard(bouton);
+    }
+    if (!par_widget)
+        afficher_en_attente();
+    gtk_widget_queue_draw(fenetre);
+    bench_attendre_image();
+
+    *duree = bench_premiere_image ? bench_premiere_image - debut : -1;
+    *allocations = bench_nb_allocations;
+    gtk_widget_destroy(fenetre);
+}
+
+//Ecrit un <fixedvirtuel> de 'nombre' boutons et labels (20 par ligne) dans une fenetre
+static int bench_generer_virtuel(const char* chemin, int nombre) {
+    FILE* f = fopen(chemin, "w");
+    if (!f) {
+        printf("ERREUR de creation du fichier %s !!\n", chemin);
+        return 0;
+    }
+    fprintf(f, "<window>\n"
+               "    <property name=\"title\" >Virtuel</property>\n"
+               "    <property name=\"width\" >1200</property>\n"
+               "    <property name=\"height\" >900</property>\n"
+               "    <property name=\"resizable\" >1</property>\n"
+               "    <property name=\"border\" >0</property>\n"
+               "    <property name=\"position\" >c</property>\n"
+               "    <property name=\"x\" >0</property>\n"
+               "    <property name=\"y\" >0</property>\n"
+               "    <child>\n"
+               "        <fixedvirtuel>\n"
+               "            <property name=\"nom\" >canevas</property>\n"
+               "            <property name=\"marge\" >200</property>\n"
+               "            <children>\n");
+    for (int i = 0; i < nombre; i++) {
+        const char* balise = (i % 2) ? "label" : "button";
+        fprintf(f, "                <%s>\n"
+                   "                    <property name=\"nom\" >v%d</property>\n"
+                   "                    <property name=\"text\" >v%d</property>\n"
+                   "                    <property name=\"x\" >%d</property>\n"
+                   "                    <property name=\"y\" >%d</property>\n"
+                   "                    <property name=\"width\" >60</property>\n"
+                   "                    <property name=\"height\" >20</property>\n"
+                   "                </%s>\n",
+                balise, i, i, (i % 20) * 60, (i / 20) * 22, balise);
+    }
+    fprintf(f, "            </children>\n"
+               "        </fixedvirtuel>\n"
+               "    </child>\n"
+               "</window>\n");
+    fclose(f);
+    return 1;
+}
+
+//Cherche le fixed virtuel créé par le chargement dans les descendants d'un widget
+static void bench_trouver_virtuel(GtkWidget* widget, gpointer data) {
+    fixed_virtuel** trouve = data;
+    if (*trouve)
+        return;
+    *trouve = fixed_virtuel_du_scroll(widget);
+    if (!*trouve && GTK_IS_CONTAINER(widget))
+        gtk_container_forall(GTK_CONTAINER(widget), bench_trouver_virtuel, data);
+}
+
+//Charge un <fixedvirtuel> de BENCH_NB_VIRTUELS boutons et labels par le chargeur XML, puis
+//fait défiler jusqu'en bas: seuls les widgets visibles (plus la marge) sont construits ou réutilisés
+static void bench_virtuel() {
+    if (!bench_generer_virtuel(BENCH_FICHIER_VIRTUEL, BENCH_NB_VIRTUELS))
+        return;
+    FILE* file = fopen(BENCH_FICHIER_VIRTUEL, "r");
+    if (!file) {
+        printf("ERREUR d'ouverture du fichier !!");
+        return;
+    }
+
+    bench_debut_mesure();
+    gint64 debut = g_get_monotonic_time();
+    creer_object(file, 0);
+    fclose(file);
+    gint64 fin_chargement = g_get_monotonic_time();
+    GtkWidget* fenetre = parents[0];
+    fixed_virtuel* fv = NULL;
+    bench_trouver_virtuel(fenetre, &fv);
+    if (!fv) {
+        printf("ERREUR: le chargement n'a pas cree de fixed virtuel !!\n");
+        gtk_widget_destroy(fenetre);
+        return;
+    }
+
+    gtk_widget_show_all(fenetre);
+    bench_attendre_image();
+    gint64 premiere_image = bench_premiere_image;
+    guint crees_affichage = fv->nb_crees;
+
+    //Défilement par pages jusqu'en bas
+    GtkAdjustment* v = gtk_scrolled_window_get_vadjustment(GTK_SCROLLED_WINDOW(fv->scroll));
+    gint64 debut_defilement = g_get_monotonic_time();
+    guint nb_pages = 0;
+    while (gtk_adjustment_get_value(v) + gtk_adjustment_get_page_size(v) < gtk_adjustment_get_upper(v)
+           && gtk_adjustment_get_page_size(v) > 0) {
+        gtk_adjustment_set_value(v, gtk_adjustment_get_value(v) + gtk_adjustment_get_page_size(v));
+        bench_vider_evenements();
+        nb_pages++;
+    }
+    gint64 fin_defilement = g_get_monotonic_time();
+
+    printf("\n=== Fixed virtuel (%d noeuds) ===\n", BENCH_NB_VIRTUELS);
+    printf("Chargement XML                         : %8.2f ms\n", (fin_chargement - debut) / 1000.0);
+    if (premiere_image)
+        printf("Creation -> premiere image             : %8.2f ms\n", (premiere_image - debut) / 1000.0);
+    else
+        printf("Creation -> premiere image             :   (aucune image)\n");
+    printf("Widgets construits a l'affichage       : %8u\n", crees_affichage);
+    printf("Defilement (%u pages)                  : %8.2f ms\n", nb_pages,
+           (fin_defilement - debut_defilement) / 1000.0);
+    printf("Widgets construits / reutilises        : %8u / %u\n", fv->nb_crees, fv->nb_recycles);
+
+    //L'Arbre appartient au scrolled window: il est libéré avec la fenetre
+    gtk_widget_destroy(fenetre);
+}
+
+//Charge puis détruit BENCH_NB_CYCLES fois un petit layout. Les structures des widgets
+//appartiennent aux widgets (memoire_attacher): détruire la fenetre doit tout rendre.
+//Le premier cycle n'est pas compté (styles partagés, classes GTK créés une fois).
+static void bench_cycles() {
+    gsize octets[MEMOIRE_NB_CATEGORIES], objets[MEMOIRE_NB_CATEGORIES];
+    gint64 debut = 0;
+
+    if (!bench_generer_cycles(BENCH_FICHIER_CYCLES))
+        return;
+    for (int i = 0; i <= BENCH_NB_CYCLES; i++) {
+        if (i == 1) {
+            for (int c = 0; c < MEMOIRE_NB_CATEGORIES; c++) {
+                octets[c] = memoire_octets(c);
+                objets[c] = memoire_objets(c);
+            }
+            debut = g_get_monotonic_time();
+        }
+        FILE* file = fopen(BENCH_FICHIER_CYCLES, "r");
+        if (!file) {
+            printf("ERREUR d'ouverture du fichier !!");
+            return;
+        }
+        creer_object(file, 0);
+        fclose(file);
+        bench_vider_evenements();
+        gtk_widget_destroy(parents[0]);
+        bench_vider_evenements();
+    }
+    gint64 fin = g_get_monotonic_time();
+
+    printf("\n=== Chargement / destruction (%d cycles) ===\n", BENCH_NB_CYCLES);
+    printf("Duree moyenne d'un cycle               : %8.3f ms\n",
+           (fin - debut) / 1000.0 / BENCH_NB_CYCLES);
+    for (int c = 0; c < MEMOIRE_NB_CATEGORIES; c++)
+        printf("Croissance %-10s                  : %+8ld octets, %+ld objet(s)\n",
+               memoire_noms_categories[c],
+               (long)memoire_octets(c) - (long)octets[c], (long)memoire_objets(c) - (long)objets[c]);
+}
+
+//Ecrit une barre de menus dont le premier menu ouvre une chaine de 'profondeur' sous-menus
+//imbriqués. Le titre du second menu dépasse MAX_LABEL_LENGTH (lecture bornée).
+static int bench_generer_menus(const char* chemin, int profondeur) {
+    FILE* f = fopen(chemin, "w");
+    if (!f) {
+        printf("ERREUR de creation du fichier %s !!\n", chemin);
+        return 0;
+    }
+    fprintf(f, "<window>\n"
+               "    <property name=\"title\" >Menus</property>\n"
+               "    <property name=\"width\" >400</property>\n"
+               "    <property name=\"height\" >300</property>\n"
+               "    <property name=\"resizable\" >1</property>\n"
+               "    <property name=\"border\" >0</property>\n"
+               "    <property name=\"position\" >c</property>\n"
+               "    <property name=\"x\" >0</property>\n"
+               "    <property name=\"y\" >0</property>\n"
+               "    <child>\n"
+               "        <fixed>\n"
+               "            <children>\n"
+               "<menubarre>\n"
+               "<property name=\"x\" >0</property>\n"
+               "<property name=\"y\" >0</property>\n"
+               "<menu>\n"
+               "<property name=\"title\" >Profond</property>\n"
+               "<submenu>\n");
+    for (int i = 0; i < profondeur; i++)
+        fprintf(f, "<menuitem>\n"
+                   "<property name=\"label\" >n%d</property>\n"
+                   "<submenu>\n", i);
+    fprintf(f, "<menuitem>\n"
+               "<property name=\"label\" >feuille</property>\n"
+               "</menuitem>\n");
+    for (int i = 0; i < profondeur; i++)
+        fprintf(f, "</submenu>\n"
+                   "</menuitem>\n");
+    fprintf(f, "</submenu>\n"
+               "</menu>\n"
+               "<menu>\n"
+               "<property name=\"title\" >");
+    for (int i = 0; i < 3 * MAX_LABEL_LENGTH; i++)
+        fputc('L', f);
+    fprintf(f, "</property>\n"
+               "</menu>\n"
+               "</menubarre>\n"
+               "            </children>\n"
+               "        </fixed>\n"
+               "    </child>\n"
+               "</window>\n");
+    fclose(f);
+    return 1;
+}
+
+//Charge la barre de menus imbriqués puis détruit la fenetre: la barre possède son modèle,
+//la mémoire des menus doit revenir à son niveau de départ
+static void bench_menus() {
+    if (!bench_generer_menus(BENCH_FICHIER_MENUS, BENCH_PROFONDEUR_MENUS))
+        return;
+    FILE* file = fopen(BENCH_FICHIER_MENUS, "r");
+    if (!file) {
+        printf("ERREUR d'ouverture du fichier !!");
+        return;
+    }
+    gsize octets = memoire_octets(MEMOIRE_MENUS);
+    gint64 debut = g_get_monotonic_time();
+    creer_object(file, 0);
+    gint64 fin = g_get_monotonic_time();
+    fclose(file);
+    gsize octets_charges = memoire_octets(MEMOIRE_MENUS);
+    bench_vider_evenements();
+    gtk_widget_destroy(parents[0]);
+    bench_vider_evenements();
+
+    printf("\n=== Sous-menus imbriques (profondeur %d) ===\n", BENCH_PROFONDEUR_MENUS);
+    printf("Chargement XML                         : %8.2f ms\n", (fin - debut) / 1000.0);
+    printf("Memoire des menus chargee              : %8lu octets\n",
+           (unsigned long)(octets_charges - octets));
+    printf("Croissance apres destruction           : %+8ld octets\n",
+           (long)memoire_octets(MEMOIRE_MENUS) - (long)octets);
+}
+
+int main(int argc, char *argv[]) {
+    gtk_init(&argc, &argv);
+    bench_installer_hooks();
+
+    if (!bench_generer_layout(BENCH_FICHIER))
+        return -1;
+
+    //1) Chargement XML: boutons normaux, checkbox et listes de radios
+    FILE* file = fopen(BENCH_FICHIER, "r");
+    if (!file) {
+        printf("ERREUR d'ouverture du fichier !!");
+        return -1;
+    }
+    bench_debut_mesure();
+    guint passes_avant = affichages_nb_passes;
+    gint64 debut = g_get_monotonic_time();
+    creer_object(file, 0);
+    gint64 fin_chargement = g_get_monotonic_time();
+    fclose(file);
+
+    //window_xml affiche la fenetre une seule fois, à la fin du chargement
+    gint64 premiere_image = bench_attendre_image();
+    gint64 fin_affichage = g_get_monotonic_time();
+    guint allocations_xml = bench_nb_allocations;
+    guint passes_xml = affichages_nb_passes - passes_avant;
+
+    //2) Listes de checkbox et de radios stylisées
+    char* labels[BENCH_NB_BOUTONS / 2 + 1];
+    for (int i = 0; i < BENCH_NB_BOUTONS / 2; i++)
+        labels[i] = g_strdup_printf("l%d", i);
+    labels[BENCH_NB_BOUTONS / 2] = NULL;
+
+    Style* st = init_style("Consolas", hex_color_init("#F25ACE"), 12, 1, "#F2FAAE", 1, 3);
+    StyledBox* bx_checks = init_styled_box(GTK_ORIENTATION_VERTICAL, FALSE, 0, "", "", "", "",
+                                           cord(0, 0), dim(100, 100), parents[2]);
+    StyledBox* bx_radios = init_styled_box(GTK_ORIENTATION_VERTICAL, FALSE, 0, "", "", "", "",
+                                           cord(200, 0), dim(100, 100), parents[2]);
+    create_styled_box(bx_checks);
+    create_styled_box(bx_radios);
+
+    gint64 debut_listes = g_get_monotonic_time();
+    liste_checks(labels, st, bx_checks);
+    liste_radios(labels, st, bx_radios);
+    gtk_widget_show_all(parents[0]);
+    bench_vider_evenements();
+    gint64 fin_listes = g_get_monotonic_time();
+
+    //3) Ajouts un par un: affichage après chaque widget (avant) puis affichage différé (après)
+    gint64 duree_avant, duree_apres;
+    guint allocations_avant, allocations_apres;
+    bench_ajouts(TRUE, &duree_avant, &allocations_avant);
+    bench_ajouts(FALSE, &duree_apres, &allocations_apres);
+
+    printf("\n=== Bench %d boutons ===\n", BENCH_NB_BOUTONS);
+    printf("Chargement XML (button/checkbox/radio) : %8.2f ms\n", (fin_chargement - debut) / 1000.0);
+    printf("Affichage + calcul des styles          : %8.2f ms\n", (fin_affichage - fin_chargement) / 1000.0);
+    printf("liste_checks + liste_radios (%d)      : %8.2f ms\n", BENCH_NB_BOUTONS, (fin_listes - debut_listes) / 1000.0);
+    if (premiere_image)
+        printf("Debut du chargement -> premiere image  : %8.2f ms\n", (premiere_image - debut) / 1000.0);
+    else
+        printf("Debut du chargement -> premiere image  :   (aucune image)\n");
+    printf("Passes d'allocation (chargement XML)   : %8u\n", allocations_xml);
+    printf("Sous-arbres affiches en differe (XML)  : %8u\n", passes_xml);
+    printf("\n=== Ajouts un par un (%d widgets) ===\n", BENCH_NB_AJOUTS);
+    printf("Avant (show_all apres chaque widget)   : %8.2f ms, %u passe(s) d'allocation\n",
+           duree_avant / 1000.0, allocations_avant);
+    printf("Apres (affichage differe)              : %8.2f ms, %u passe(s) d'allocation\n",
+           duree_apres / 1000.0, allocations_apres);
+
+    for (int i = 0; i < BENCH_NB_BOUTONS / 2; i++)
+        g_free(labels[i]);
+    liberer_style(st);
+
+    //4) Grand canevas virtualisé
+    bench_virtuel();
+
+    //5) Chargements / destructions: aucune croissance de la mémoire attendue
+    bench_cycles();
+
+    //6) Sous-menus très imbriqués
+    bench_menus();
+    return 0;
+}
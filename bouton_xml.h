@@ -20,7 +20,8 @@ void window_xml(FILE *file)
     bgImage[0] = '\0';//initialisation
     int test, width_int,height_int;
     Mywindow* maFenetre =NULL;
-    maFenetre=(Mywindow*)malloc(sizeof(Mywindow));
+    // Mise à zéro: bgColor.color reste NULL, liberer_window() le libère à la destruction
+    maFenetre=(Mywindow*)memoire_allouer0(MEMOIRE_WIDGETS, sizeof(Mywindow));
     // Vérification de l'allocation de mémoire
     if(!maFenetre) exit(-1);
     //si on trouve property balise retourne 22
@@ -31,15 +32,16 @@ void window_xml(FILE *file)
         Epeurerblanc(file);
         fseek(file, 6, SEEK_CUR);//Sauter le mot "name="
         fscanf(file, "%s", mot);//Lire la proprité(name="proprieté")
-        printf("\nla 1ere propriété du window est: %s", mot);//le contenu(1ere balise property)
+        TRACER(TRACE_XML, TRACE_DEBUG, "la 1ere propriété du window est: %s", mot);//le contenu(1ere balise property)
         //recuperation du title
         //Si la propriété est un titre
         if (!(strcmp("title\"", mot)))
         {
             char title[MAX];
             lire_gchar_str(file,title);//Lire le contenu de la balise property
-            title_gchar = g_strdup(title);
+            title_gchar = memoire_strdup(MEMOIRE_PARSEUR, title);
             strcpy(maFenetre->title,title_gchar);
+            memoire_liberer(title_gchar);
         }
             //recuperation de width
         else if (!(strcmp("width\"", mot)))
@@ -48,7 +50,7 @@ void window_xml(FILE *file)
             lire_gchar_str(file,width);
             width_int=atoi(width);
             maFenetre->dim.width=width_int;
-            printf("width de window: %d",width_int);
+            TRACER(TRACE_XML, TRACE_DEBUG, "width de window: %d",width_int);
         }
             //recuperation de height
         else if (!(strcmp("height\"", mot)))
@@ -57,7 +59,7 @@ void window_xml(FILE *file)
             lire_gchar_str(file,height);
             height_int=atoi(height);
             maFenetre->dim.height=height_int;
-            printf("\nheight de window: %d",height_int);
+            TRACER(TRACE_XML, TRACE_DEBUG, "height de window: %d",height_int);
         }
             //recuperation de resizable
         else if (!(strcmp("resizable\"", mot)))
@@ -73,7 +75,7 @@ void window_xml(FILE *file)
             border_size= lire_gchar(file);
             //convertir en entier
             maFenetre->border_size=char_TO_int(border_size);
-            printf("\nborder size -> %d",char_TO_int(border_size));
+            TRACER(TRACE_XML, TRACE_DEBUG, "border size -> %d",char_TO_int(border_size));
         }
             //recuperation de position
         else if (!(strcmp("position\"", mot)))
@@ -103,17 +105,19 @@ void window_xml(FILE *file)
         {
             char bgColor[MAX];
             lire_gchar_str(file,bgColor);
-            bgColor_gchar = g_strdup(bgColor);
+            bgColor_gchar = memoire_strdup(MEMOIRE_PARSEUR, bgColor);
             //color=init_hexa_color(color,bgColor_gchar);
             //maFenetre->bgColor=*color;
+            memoire_liberer(bgColor_gchar);
         }
             //recuperation de l'icon
         else if (!(strcmp("icon\"", mot)))
         {
             char icon[MAX];
             lire_gchar_str(file,icon);
-            icon_gchar = g_strdup(icon);
+            icon_gchar = memoire_strdup(MEMOIRE_PARSEUR, icon);
             strcpy(maFenetre->icon_name,icon_gchar);
+            memoire_liberer(icon_gchar);
         }
             //recuperation choix concerant header bar
         else if (!(strcmp("headerBar\"", mot)))
@@ -138,8 +142,9 @@ void window_xml(FILE *file)
     HexColor* color=hex_color_init("#7d7d7d");
     gtk_widget_override_background_color(maFenetre->window, GTK_STATE_FLAG_NORMAL,
                                          color->color);
+    liberer_hex_color(color);
     if(strlen(bgImage)!=0) hasOverlay=1;
-    printf("===================================> %d",hasOverlay);
+    TRACER(TRACE_XML, TRACE_DEBUG, "fenetre avec image de fond: %d",hasOverlay);
     /*if(char_TO_int(avoirHeader)==1)
         ajouterHeader(maFenetre,50,900,
                       maFenetre->title,maFenetre->icon_name,50,50);
@@ -276,7 +281,7 @@ void init_btn_normal_xml(FILE *file, int parent){
                 expand[ind++] = car; // Lire le mot
             }
             expand[ind] = '\0';
-            printf("%s\n", expand);
+            TRACER(TRACE_XML, TRACE_DEBUG, "expand: %s", expand);
             fseek(file, 10, SEEK_CUR);
             expand_gchar = g_strdup(expand);
         }
@@ -290,21 +295,21 @@ void init_btn_normal_xml(FILE *file, int parent){
                 fill[ind++] = car; // Lire le mot
             }
             fill[ind] = '\0';
-            printf("%s\n", fill);
+            TRACER(TRACE_XML, TRACE_DEBUG, "fill: %s", fill);
             fseek(file, 10, SEEK_CUR);
             fill_gchar= g_strdup(fill);
         }
          */
     }//fin de while()
     //Creer le style
-    HexColor* h = hex_color_init(color);
-    Style* style = init_style(police, h, atoi(taille), atoi(gras), bgcolor, atoi(border), atoi(border_radius));
+    HexColor h = hex_color_valeur(color);
+    Style style = style_valeur(police, &h, atoi(taille), atoi(gras), bgcolor, atoi(border), atoi(border_radius));
 
     //Creer l'image du bouton
     MonImage* ima = NULL;//Initier l'image avec NULL
     //Creer l'image si le path est saisie
     if(strlen(icon) > 0){
-        ima = init_image(icon,*dim(24,24), *cord(0,0));
+        ima = init_image(icon, (dimension){24, 24}, (coordonnees){0, 0});
     }
 
     btn* mybtn = NULL;
@@ -326,8 +331,8 @@ void init_btn_normal_xml(FILE *file, int parent){
     }
     //Creer le bouton
     creer_button(mybtn);
-    //Appliquer le style au bouton
-    appliquer_style_button(style, mybtn);
+    //Appliquer le style au bouton (le bouton garde le style partagé, pas la copie locale)
+    appliquer_style_button(&style, mybtn);
 }
 
 
@@ -366,7 +371,7 @@ void button_xml(FILE *file, int parent) {
                 while (((car = fgetc(file)) != EOF) && (car != '<')) {
                     gras = car; // Lire le mot
                 }
-                printf("%c\n", gras);
+                TRACER(TRACE_XML, TRACE_DEBUG, "gras: %c", gras);
                 fseek(file, 13, SEEK_CUR);
                 // Convertir en entier
                 buttonStyle->gras = char_TO_int(gras);
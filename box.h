@@ -22,8 +22,8 @@ typedef struct {
     gchar *border_radius; // Rayon de bordure en CSS
     gchar *border; // Epaisseur de bordure en CSS
     GtkWidget *widget; // Le GtkBox lui-même
-    coordonnees* cord; //Position
-    dimension* dim;
+    coordonnees cord; //Position
+    dimension dim;
     GtkWidget* container;//Conteneur (fixed)
 } StyledBox;
 
@@ -32,7 +32,7 @@ typedef struct {
  * @return Un pointeur vers un StyledBox alloué ou NULL si l'allocation échoue.
  */
 StyledBox *allocate_styled_box() {
-    StyledBox *box = (StyledBox *)malloc(sizeof(StyledBox));
+    StyledBox *box = (StyledBox *)memoire_allouer(MEMOIRE_WIDGETS, sizeof(StyledBox));
     if (!box) {
         fprintf(stderr, "Erreur: Échec de l'allocation mémoire pour StyledBox.\n");
         return NULL;
@@ -54,8 +54,8 @@ StyledBox *allocate_styled_box() {
  * @param background_color Couleur de fond en CSS (peut être NULL).
  * @param border_radius Rayon de la bordure en CSS (peut être NULL).
  * @param border Epaisseur de la bordure en CSS (peut être NULL).
- * @param cord Position du box (x et y)
- * @param dim Dimension (width et height)
+ * @param cord Position du box (x et y), copiée
+ * @param dim Dimension (width et height), copiée
  * @param container Le conteneur (fixed)
  *
  * @return *box un pointeur vers le box initialisé
@@ -75,10 +75,30 @@ StyledBox *init_styled_box( GtkOrientation orientation, gboolean homogeneous, gi
     box->background_color = background_color ? g_strdup(background_color) : NULL;
     box->border_radius = border_radius ? g_strdup(border_radius) : NULL;
     box->border = border ? g_strdup(border) : NULL;
-    box->cord = cord ;
-    box->dim = dim;
+    box->cord = cord ? *cord : (coordonnees){0, 0};
+    box->dim = dim ? *dim : (dimension){-1, -1};
     box->widget = NULL; // Le widget sera créé dans une autre fonction
     box->container = container;
+    return box;
+}
+
+
+/**
+ * @brief Libère une structure StyledBox et ses chaines CSS.
+ *
+ * Appelée à la destruction du GtkBox (voir create_styled_box): le widget n'est plus
+ * utilisable à ce moment.
+ *
+ * @param data Pointeur vers la structure StyledBox.
+ */
+void liberer_styled_box(gpointer data) {
+    StyledBox *box = (StyledBox *)data;
+    if (!box) return;
+    g_free(box->css_classes);
+    g_free(box->background_color);
+    g_free(box->border_radius);
+    g_free(box->border);
+    memoire_liberer(box);
 }
 
 
@@ -92,10 +112,13 @@ StyledBox *init_styled_box( GtkOrientation orientation, gboolean homogeneous, gi
  */
 void create_styled_box(StyledBox *box) {
     if (!box) return; // Vérification de la validité du pointeur
+    TRACE_SPAN_DEBUT(debut);
 
     // Création du GtkBox avec les propriétés définies
     box->widget = gtk_box_new(box->orientation, box->spacing);
     gtk_box_set_homogeneous(GTK_BOX(box->widget), box->homogeneous);
+    // Le box possède sa structure: elle est libérée à sa destruction
+    memoire_attacher(box->widget, box, liberer_styled_box);
 
 
     // Récupération du contexte de style
@@ -108,12 +131,12 @@ void create_styled_box(StyledBox *box) {
 
     //Associé le box à un conteneur
     if(GTK_IS_FIXED(box->container)){
-        gtk_fixed_put(GTK_FIXED(box->container), box->widget, box->cord->x, box->cord->y);
+        gtk_fixed_put(GTK_FIXED(box->container), box->widget, box->cord.x, box->cord.y);
     }
     gtk_container_add(GTK_CONTAINER(box->container), box->widget);
 
     //Ajuster la dimension
-    gtk_widget_set_size_request(GTK_WIDGET(box->widget),box->dim->width,box->dim->height);
+    gtk_widget_set_size_request(GTK_WIDGET(box->widget),box->dim.width,box->dim.height);
 
 
     // Application des styles CSS si des valeurs sont fournies
@@ -134,6 +157,7 @@ void create_styled_box(StyledBox *box) {
         g_free(css);
         g_object_unref(provider);
     }
+    TRACE_SPAN_FIN(debut, TRACE_AFFICHAGE, "create_styled_box");
 }
 
 
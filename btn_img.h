@@ -24,15 +24,14 @@ void initBtnImage(BtnImage *btnimg, gchar imgPath[MAX_BTN_ICON_LENGTH], dimensio
 {
     //Initialiser les champs de l'icon
     //Copier le path
-    strncpy(imgPath, btnimg->imgPath, MAX_BTN_ICON_LENGTH);
+    g_strlcpy(btnimg->imgPath, imgPath, MAX_BTN_ICON_LENGTH);
     //Copier la dimension
     btnimg->imgDim=imgDim;
     //Copier la position
     btnimg->btnImgPos=btnImgPos;
     //Creer l'image et l'associer au bouton
-    GdkPixbuf *pixbuf = gdk_pixbuf_new_from_file_at_size(btnimg->imgPath, btnimg->imgDim.width, btnimg->imgDim.height, NULL);
-    btnimg->Image = gtk_image_new_from_pixbuf(pixbuf);
-    g_object_unref(pixbuf);//Liberer le pixbuf
+    //L'icon est partagée via le cache des pixbufs (un seul décodage par fichier et par taille)
+    btnimg->Image = cache_pixbuf_creer_image(btnimg->imgPath, btnimg->imgDim.width, btnimg->imgDim.height);
     //Ajuster la position de l'icon
     //gtk_button_set_image_position(GTK_BUTTON(btn->button), btnimg->btnImgPos);
 }
@@ -57,15 +57,8 @@ typedef enum
 
 
 /******************************Style************************************/
-typedef struct {
-    gchar* police;
-    HexColor* color;
-    gint taille;
-    gint gras;
-    char* bgcolor;
-    int border;
-    int border_radius;
-} Style;
+//La structure Style et les styles partagés sont définis dans style.h
+#include "style.h"
 
 
 //La structure définissant le bouton, comportant les differents parametres
@@ -80,24 +73,19 @@ typedef struct btn{
     // il faut qu'il soit précedé par '_' dans le label).
     gchar tooltip[MAX_LENGTH];//L'info-bulle du bouton( format: markup).
     MonImage* img;//Une image de type MonImage.
-    dimension* dim;//La dimension du bouton(hauteur, largeur).
+    dimension dim;//La dimension du bouton(hauteur, largeur).
     gboolean isFixed;//Boolean indiquant si le button est fixé (çad son conteneur doit être un widget: GtkFixed).
-    coordonnees* pos;//La position du bouton (! marche seulement si le conteneur est un GtkFixed ).
-    Margin* margin;//La marge d'un bouton.
+    coordonnees pos;//La position du bouton (! marche seulement si le conteneur est un GtkFixed ).
+    Margin margin;//La marge d'un bouton.
     gboolean isSensitive;//Boolean indiquant si le button est cliquable.
     GtkWidget* container;//Le conteneur du bouton.
     GtkWidget* groupeMember;//Un bouton radio qui appartient au même groupe(util juste pour les boutons radio).
     GtkAlign align;//L'alignement du bouton.
     double opacity;//l'opacité du bouton.
     gboolean isChecked;//Si le bouton est coché.
-    spinObj* sp;//L'objet contenant les parametres du button spin.
+    spinObj sp;//Les parametres du button spin.
     //style
-    Style* style; // style du bouton
-    gchar* police; // police du bouton
-    gchar* color; // couleur du bouton
-    gint taille; // taille de la police du bouton
-    gint gras; // épaisseur de la police du bouton
-    gchar* bgcolor;
+    SharedStyle* style; // style partagé du bouton (police, couleurs, taille, gras, bord)
     gchar* callback; // callback du bouton
 }btn;
 /**
@@ -133,26 +121,13 @@ typedef struct btn{
 //     return dest;
 // }
 
+//Associe au bouton le style partagé correspondant à 'src'. Les boutons ayant le meme
+//style pointent vers le meme objet au lieu d'en garder chacun une copie.
 void copy_style_to_btn(btn* b, const Style* src) {
     if (!b || !src) return;
-    b->police = src->police ? g_strdup(src->police) : g_strdup("Sans");
-    b->color = src->color ? g_strdup(src->color->hex_code) : g_strdup("black");
-    b->bgcolor = src->bgcolor ? g_strdup(src->bgcolor) : g_strdup("#FFFF");
-    b->taille = src->taille;
-    b->gras = src->gras;
-
-    b->style = (Style*)malloc(sizeof(Style));
-    if (!b->style) {
-        fprintf(stderr, "Erreur d'allocation mémoire pour le style du bouton\n");
-        return;
-    }
-    b->style->police = g_strdup(b->police);
-    b->style->color = src->color;
-    b->style->bgcolor = src->bgcolor ? g_strdup(src->bgcolor) : g_strdup("white");
-    b->style->taille = b->taille;
-    b->style->gras = b->gras;
-    b->style->border = src->border;
-    b->style->border_radius = src->border_radius;
+    SharedStyle* s = intern_style(src);
+    liberer_style_partage(b->style);
+    b->style = s;
 }
 
 /**************************************
@@ -164,7 +139,7 @@ void copy_style_to_btn(btn* b, const Style* src) {
 ***************************************/
 btn* allocateBtn()
 {
-    btn* mybtn=(btn*)malloc(sizeof(btn));//Allocation
+    btn* mybtn=(btn*)memoire_allouer0(MEMOIRE_WIDGETS, sizeof(btn));//Allocation (champs à zéro, style et callback à NULL)
     // mybtn->style = (Style*)malloc(sizeof(Style));
     //Retourner un message d'erreur et sortire du programme si l'allocation est échouée
     if(!mybtn)
@@ -187,6 +162,9 @@ btn* allocateBtn()
  *              Donner des valeurs par défauts à certains champs (dimension,position,marge).
  *              Retourner le bouton.
  *              !L'image passée doit etre initié par init_image
+ *              !Le bouton possède l'image passée: elle est libérée avec lui (voir liberer_btn).
+ *              La dimension, la position, la marge et le spin sont copiés (ils peuvent venir
+ *              des macros dim(), cord(), margin(), spinObj() sans allocation).
 ***************************************/
 //Initialiser le bouton
 btn* initBtn(BtnType btype,gchar nom[MAX_LENGTH],gchar label[MAX_LENGTH],
@@ -214,19 +192,19 @@ btn* initBtn(BtnType btype,gchar nom[MAX_LENGTH],gchar label[MAX_LENGTH],
     mybtn->hasMnemonic=hasMnemonic;
     // Copier la dimension
     if(dim)
-        mybtn->dim = dim;
+        mybtn->dim = *dim;
         //En cas d'abscence de la dimension prendre une par défaut .
     else
         mybtn->dim=DEFAULT_BTN_DIM;
     // Copier la position
     if(pos)
-        mybtn->pos = pos;
+        mybtn->pos = *pos;
         //En cas d'abscence de la position prendre une par défaut .
     else
         mybtn->pos=DEFAULT_BTN_POS;
     // copier la marge
     if(margin)
-        mybtn->margin = margin;
+        mybtn->margin = *margin;
         //En cas d'abscence de la marge prendre une par défaut .
     else
         mybtn->margin=DEFAULT_BTN_MARGIN;
@@ -238,7 +216,8 @@ btn* initBtn(BtnType btype,gchar nom[MAX_LENGTH],gchar label[MAX_LENGTH],
     mybtn->align = align; // Définir l'alignment
     mybtn->opacity=opacity;// Définir l'opacité
     mybtn->isChecked=isChecked;// Définir si le bouton (checkbox) est coché ou pas.
-    mybtn->sp=sp;//Copier l'objet contenant les parametres d'un bouton de type SPIN.
+    if(sp)
+        mybtn->sp=*sp;//Copier les parametres d'un bouton de type SPIN (zéro sinon).
     //assigner à l'image de bouton
     mybtn->img = img;
     if(img){
@@ -253,6 +232,26 @@ btn* initBtn(BtnType btype,gchar nom[MAX_LENGTH],gchar label[MAX_LENGTH],
 //L'utilité de retourner le btn c'est que lorsqu'on crée des boutons radios on doit
 //spécifier leurs peres donc on doit récuperer le pere après sa création
 
+/**************************************
+ * NOM: liberer_btn.
+ * ENTRÉS: gpointer data; pointeur vers un bouton (type btn)
+ * SORTIS: void
+ * DESCRIPTION: Libérer la structure d'un bouton et ce qu'elle possède (image, style partagé,
+ *              nom du callback).
+ *              Appelée à la destruction du GtkWidget (voir memoire_attacher dans creer_button):
+ *              le widget n'est plus utilisable à ce moment.
+***************************************/
+void liberer_btn(gpointer data)
+{
+    btn* b = (btn*)data;
+    if(!b)
+        return;
+    memoire_liberer(b->img);
+    liberer_style_partage(b->style);
+    g_free(b->callback);
+    memoire_liberer(b);
+}
+
 /**************************************
  * NOM: creer_button.
  * ENTRÉS: btn* mybtn; pointeur vers un bouton (type btn)
@@ -271,6 +270,7 @@ btn* creer_button(btn* mybtn)
         printf("La structure de bouton n'existe pas.\n");
         exit(-1);
     }
+    TRACE_SPAN_DEBUT(debut);
     //Creer le bouton selon le type
     switch (mybtn->btype) {
         case NORMAL:
@@ -287,12 +287,12 @@ btn* creer_button(btn* mybtn)
             break;
         case SPIN:
             // Créer le GtkSpinButton avec l'ajustement(adjustement a des valeurs par défaut pour le page_increment, page_size et le climb_rate)
-            mybtn->button = gtk_spin_button_new(gtk_adjustment_new(mybtn->sp->start,
-                                                                   mybtn->sp->borneInf,
-                                                                   mybtn->sp->borneSup,
-                                                                   mybtn->sp->step,
+            mybtn->button = gtk_spin_button_new(gtk_adjustment_new(mybtn->sp.start,
+                                                                   mybtn->sp.borneInf,
+                                                                   mybtn->sp.borneSup,
+                                                                   mybtn->sp.step,
                                                                    10.0, 0.0),
-                                                1.0, mybtn->sp->digits); // Incrément de 1, pas de décimales
+                                                1.0, mybtn->sp.digits); // Incrément de 1, pas de décimales
 
             break;
         case SWITCH:
@@ -303,6 +303,8 @@ btn* creer_button(btn* mybtn)
             mybtn->button = gtk_button_new(); // Default to a normal button
             break;
     }
+    //Le bouton possède sa structure: elle est libérée à sa destruction
+    memoire_attacher(mybtn->button, mybtn, liberer_btn);
 
     //Changer l'identifiant du bouton
     gtk_widget_set_name(mybtn->button, mybtn->nom);
@@ -325,25 +327,26 @@ btn* creer_button(btn* mybtn)
     //Ajuster l'opacité du bouton
     gtk_widget_set_opacity(mybtn->button, mybtn->opacity);
     //Ajuster la dimension du button
-    gtk_widget_set_size_request(mybtn->button, mybtn->dim->width, mybtn->dim->height);
+    gtk_widget_set_size_request(mybtn->button, mybtn->dim.width, mybtn->dim.height);
     //Fixer le bouton dans ce conteneur à une position bien définie(le conteneur doit etre fixed)
     if (mybtn->isFixed && mybtn->container) {
-        gtk_fixed_put(GTK_FIXED(mybtn->container), mybtn->button, mybtn->pos->x, mybtn->pos->y);
+        gtk_fixed_put(GTK_FIXED(mybtn->container), mybtn->button, mybtn->pos.x, mybtn->pos.y);
     }
     //Ajuster les margins du bouton
 
-    gtk_widget_set_margin_start(mybtn->button, mybtn->margin->mleft);
-    gtk_widget_set_margin_end(mybtn->button, mybtn->margin->mright);
-    gtk_widget_set_margin_top(mybtn->button, mybtn->margin->mtop);
-    gtk_widget_set_margin_bottom(mybtn->button, mybtn->margin->mbottom);
-    printf("\nMargins: %d %d %d %d", mybtn->margin->mleft,mybtn->margin->mright,mybtn->margin->mtop,mybtn->margin->mbottom);
+    gtk_widget_set_margin_start(mybtn->button, mybtn->margin.mleft);
+    gtk_widget_set_margin_end(mybtn->button, mybtn->margin.mright);
+    gtk_widget_set_margin_top(mybtn->button, mybtn->margin.mtop);
+    gtk_widget_set_margin_bottom(mybtn->button, mybtn->margin.mbottom);
+    TRACER(TRACE_AFFICHAGE, TRACE_DEBUG, "marges: %d %d %d %d", mybtn->margin.mleft, mybtn->margin.mright,
+           mybtn->margin.mtop, mybtn->margin.mbottom);
     //Activer ou désactiver la sensibilitée
     gtk_widget_set_sensitive(mybtn->button, mybtn->isSensitive);
     // Donner le focus au bouton
     gtk_widget_grab_focus(mybtn->button);
     //Ajouter le bouton au conteneur, s'il ne s'agit d'un conteneur fixe
     if((!mybtn->isFixed) && ((mybtn->container)!=NULL))
-    {   g_print("Containersa dsadvsjahdvasjdhjasdvashdvashdavds({{{{{}}}}}): %s\n", gtk_widget_get_name(mybtn->container));
+    {   TRACER(TRACE_AFFICHAGE, TRACE_DEBUG, "bouton ajouté au conteneur %s", gtk_widget_get_name(mybtn->container));
         gtk_container_add(GTK_CONTAINER(mybtn->container), mybtn->button);
         gtk_box_pack_start(GTK_BOX(mybtn->container), mybtn->button, TRUE, TRUE, 0);
 
@@ -387,11 +390,33 @@ btn* creer_button(btn* mybtn)
             g_signal_connect(mybtn->button, "clicked", G_CALLBACK(open_dialog), NULL);
         }
     }
+    TRACE_SPAN_FIN(debut, TRACE_AFFICHAGE, "creer_button");
     return(btn*) mybtn;
 }
 
 
 
+//Meme regles que init_style() mais le style est rendu par valeur: a utiliser pour les
+//styles temporaires (chargement XML, dialogues) qui ne servent qu'a intern_style().
+Style style_valeur(gchar* police, HexColor* color, gint taille,
+                   gint gras, char* bgcolor, int border, int border_radius) {
+    Style stl;
+    //Initier les attributs de style
+    stl.police = stl.bgcolor = NULL;
+    //Si la police est non vide alors copier la
+    if(police && police[0] != '\0')
+        stl.police = police;
+    //Si la bgcolor est non vide alors copier la
+    if(bgcolor && bgcolor[0] != '\0')
+        stl.bgcolor = bgcolor;
+    stl.color = color;
+    stl.taille = taille;
+    stl.gras = gras;
+    stl.border = border;
+    stl.border_radius = border_radius;
+    return stl;
+}
+
 /**********************************************************************************************************
  Nom            : init_style()
  Entrée         : police - Police à assigner au style
@@ -407,79 +432,25 @@ btn* creer_button(btn* mybtn)
 Style *init_style(gchar police[50], HexColor* color, gint taille,
                   gint gras, char* bgcolor, int border, int border_radius) {
     // Allouer de la mémoire pour le style s'il n'existe pas
-        Style* stl = (Style*)malloc(sizeof(Style));
+        Style* stl = (Style*)memoire_allouer(MEMOIRE_STYLES, sizeof(Style));
         if (!stl) {
             fprintf(stderr, "Erreur d'allocation mémoire\n");
             return NULL;
         }
-
-    //Initier les attributs de style
-        stl->police = stl->bgcolor = NULL;
-    //Si la police est non vide alors copier la
-    if(police)
-        if(police[0] != '\0' )
-            stl->police = police;
-    //Si la bgcolor est non vide alors copier la
-    if(bgcolor)
-        if(bgcolor[0] != '\0')
-            stl->bgcolor = bgcolor;
-    //Copier la couleur
-    stl->color = color;
-    //Copier la taille
-    stl->taille = taille;
-    //Copier le gras
-    stl->gras = gras;
-    //Copier le border
-    stl->border = border;
-    //Copier le border_radius
-    stl->border_radius = border_radius;
+    *stl = style_valeur(police, color, taille, gras, bgcolor, border, border_radius);
     return (Style *)stl;
 }
 
 //Prend un bouton et un style et applique les propriétés qui sont "deprecated" en
-//utilisant le css (border, border-radius, background-color)
+//utilisant le css (border, border-radius, background-color).
+//Le bouton rejoint la classe CSS du style partagé: aucune règle n'est créée par widget.
 void regler_css(btn *b, Style* stl) {
-    // Create a new CSS provider
-    GtkCssProvider *provider = gtk_css_provider_new();
-
-    // Construct the dynamic CSS string
-    //BAckground
-    printf("#%s { background: %s;}", b->nom,stl->bgcolor);
-    char* bgcolor = NULL;
-    if(stl->bgcolor){
-        bgcolor = strdup(stl->bgcolor);
-    }else{
-        bgcolor = "";
-    }
-    gchar *css ;
-    //Si le 'bgcolor' est une image(contient une extension) alors appliquer l'image comme background
-    if (strchr(bgcolor, '.')) {
-        css = g_strdup_printf("#%s { background: url('%s') no-repeat center center ; \
-                                        background-size: cover;\
-                                        border: %dpx solid black; \
-                                        border-radius: %dpx;}",
-                              b->nom, bgcolor, stl->border, stl->border_radius);
-    }
-        //Si le 'bgcolor' est une background color
-    else{
-        css = g_strdup_printf("#%s { background: %s ; \
-                                        border: %dpx solid black; \
-                                        border-radius: %dpx;}",
-                              b->nom, bgcolor, stl->border, stl->border_radius);
-    }
-
-    // Load the CSS into the provider
-    gtk_css_provider_load_from_data(provider, css, -1, NULL);
-
-    // Get the style context of the button
-    GtkStyleContext *context = gtk_widget_get_style_context(b->button);
-    gtk_style_context_add_provider(context,
-                                   GTK_STYLE_PROVIDER(provider),
-                                   GTK_STYLE_PROVIDER_PRIORITY_USER);
-
-    // Free allocated memory
-    g_free(css);
-    g_object_unref(provider);
+    if (!b || !stl) return;
+    //La nouvelle classe est appliquée avant de lâcher l'ancien style
+    SharedStyle* ancien = b->style;
+    b->style = intern_style(stl);
+    appliquer_style_partage(b->button, b->style);
+    liberer_style_partage(ancien);
 }
 
 
@@ -493,45 +464,23 @@ void regler_css(btn *b, Style* stl) {
                   une couleur de texte, etc(si ses attributs sont non vides(!= -1 pour les entiers et != NULL pour les strings ).
 **********************************************************************************************************/
 void appliquer_style_button(Style *monStyle, btn *b) {
-    //font
-    {
-        // Création d'une nouvelle description de police Pango
-        PangoFontDescription *font_desc = pango_font_description_new();
-
-        // Appliquer la famille de police spécifiée dans le style
-        if(monStyle -> police){
-            pango_font_description_set_family(font_desc, monStyle->police);
-            // Appliquer la police au widget du bouton
-            gtk_widget_override_font(b->button, font_desc);
-        }
-        // Appliquer la taille de police spécifiée dans le style
-        if(monStyle -> taille > -1){
-            pango_font_description_set_size(font_desc, monStyle->taille * PANGO_SCALE);
-            // Appliquer la police au widget du bouton
-            gtk_widget_override_font(b->button, font_desc);
-        }
-        //Mettre le text en gras
-        if (monStyle->gras == 1){
-            pango_font_description_set_weight(font_desc, PANGO_WEIGHT_BOLD);
-            pango_font_description_set_size(font_desc, monStyle->taille * PANGO_SCALE);
-            // Appliquer le gras au widget du bouton
-            gtk_widget_override_font(b->button, font_desc);
-        }
-
-        // Libérer la mémoire allouée pour la description de police
-        pango_font_description_free(font_desc);
-    }
-    // Récupérer le label du bouton
-    GtkWidget *lab = gtk_bin_get_child(GTK_BIN(b->button));
-
-    // Modifier la couleur du texte
-    if(monStyle->color)
-        gtk_widget_override_color(lab, GTK_STATE_FLAG_NORMAL, monStyle->color->color);
-
-    //Modifier le background et le border radius(tout ce qui est css)
+    if(!monStyle || !b || !b->button) return;
+    //La police (famille, taille, gras), la couleur du texte, le background et le bord sont
+    //calculés une seule fois dans la classe du style partagé: le bouton ne subit qu'une
+    //seule mise à jour de style au lieu d'un appel 'override' par propriété.
     regler_css(b, monStyle);
 }
 
+//Associe un style partagé déjà interné à un bouton (utile pour styliser une liste de
+//boutons avec un seul intern_style()).
+void attacher_style_button(btn* b, SharedStyle* s) {
+    if(!b) return;
+    SharedStyle* ancien = b->style;
+    b->style = ref_style_partage(s);
+    appliquer_style_partage(b->button, s);
+    liberer_style_partage(ancien);
+}
+
 
 /////////box des boutons
 #include "fixed.h"
@@ -581,12 +530,12 @@ btn** liste_radios(char* labels[256], Style* st, StyledBox* bx) {
     //Ajouter le pere au box
     //gtk_box_pack_start(GTK_BOX(box), pere->button, TRUE, TRUE, 0);
 
+    //Le style est calculé une seule fois pour toute la liste
+    SharedStyle* partage = intern_style(st);
+
     //appliquer le style au bouton pere
-    if(st){
-        // pere->style = *st;
-        copy_style_to_btn(pere, st);
-        appliquer_style_button(st, pere);
-    }
+    if(partage)
+        attacher_style_button(pere, partage);
     buttons[0] = pere; // Store the parent button
     //Creer les autres boutons
         // Create the child radio buttons
@@ -594,10 +543,8 @@ btn** liste_radios(char* labels[256], Style* st, StyledBox* bx) {
             btn* b = btnRadio(labels[j], labels[j], labels[j], bx->widget, margin(0, 0, 0, 0), pere->button, NULL);
             creer_button(b);
             gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(b->button), FALSE);
-            if (st){ 
-                copy_style_to_btn(b, st);
-                appliquer_style_button(st, b);
-            }
+            if (partage)
+                attacher_style_button(b, partage);
             buttons[j] = b; // Store the child button
         }
     /*
@@ -618,6 +565,7 @@ btn** liste_radios(char* labels[256], Style* st, StyledBox* bx) {
 
     }
     */
+   liberer_style_partage(partage);
    buttons[count] = NULL; // NULL-terminate the array
     gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(pere->button), TRUE); // Select the radio button
         return buttons;
@@ -648,6 +596,9 @@ btn** liste_radios(char* labels[256], Style* st, StyledBox* bx) {
  */
 void liste_checks(char* labels[256], Style* st, StyledBox* bx) {
 
+    //Le style est calculé une seule fois pour toute la liste
+    SharedStyle* partage = intern_style(st);
+
     //Creer les autres boutons
     int j = -1;//Commencer par le 1er label
     while(labels[++j]){
@@ -656,12 +607,13 @@ void liste_checks(char* labels[256], Style* st, StyledBox* bx) {
                           bx->widget, FALSE, NULL);
         creer_button(b);//Creer le pere
         //appliquer le style au bouton
-        if(st)
-            appliquer_style_button(st, b);
+        if(partage)
+            attacher_style_button(b, partage);
         //Ajouter le bouton au box
         //gtk_box_pack_start(GTK_BOX(box), b->button, TRUE, TRUE, 0);
 
     }
+    liberer_style_partage(partage);
 }
 
 
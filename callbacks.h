@@ -6,6 +6,7 @@
 #include "app_data.h"
 #include "widget_types.h"
 #include "entry.h"
+#include "perf_panel.h"
 
 // Function to handle drag data received
 static void on_drag_data_received(GtkWidget *widget, GdkDragContext *context, gint x, gint y,
@@ -40,7 +41,7 @@ static void on_drag_data_received(GtkWidget *widget, GdkDragContext *context, gi
     if (new_widget)
     {
         gtk_grid_attach(GTK_GRID(widget), new_widget, x / 100, y / 50, 1, 1);
-        gtk_widget_show_all(widget);
+        gtk_widget_show_all(new_widget);
     }
 
     gtk_drag_finish(context, TRUE, FALSE, time);
@@ -64,7 +65,7 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
     }
 
     // Debug info
-    g_print("Processing node: %s, type: %s, has widget_data: %s\n",
+    TRACER(TRACE_ARBRE, TRACE_DEBUG, "Processing node: %s, type: %s, has widget_data: %s",
             racine->nom,
             widget_type_to_string(racine->type),
             racine->widget_data ? "YES" : "NO");
@@ -82,7 +83,7 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
     // Output properties directly from structure based on widget type
     if (racine->widget_data)
     {
-        g_print("\n\n racine type: %d", racine->type);
+        TRACER(TRACE_ARBRE, TRACE_DEBUG, "racine type: %d", racine->type);
         switch (racine->type)
         {
         case WIDGET_TEXTVIEW:
@@ -130,9 +131,9 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
         case WIDGET_ENTRY_BASIC:
         {
             entry_type_basic *entry = (entry_type_basic *)racine->widget_data;
-            g_print("  Entry basic properties - w:%d h:%d x:%d y:%d\n",
-                    entry->dim->width, entry->dim->height,
-                    entry->cord->x, entry->cord->y);
+            TRACER(TRACE_ARBRE, TRACE_DEBUG, "  Entry basic properties - w:%d h:%d x:%d y:%d",
+                    entry->dim.width, entry->dim.height,
+                    entry->cord.x, entry->cord.y);
 
             // Open entry tag
             for (int j = 0; j < indent + 2; j++)
@@ -164,19 +165,19 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
             // Position and size properties
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", entry->cord->x);
+            g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", entry->cord.x);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", entry->cord->y);
+            g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", entry->cord.y);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"width\" >%d</property>\n", entry->dim->width);
+            g_string_append_printf(string, "<property name=\"width\" >%d</property>\n", entry->dim.width);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"height\" >%d</property>\n", entry->dim->height);
+            g_string_append_printf(string, "<property name=\"height\" >%d</property>\n", entry->dim.height);
 
             // maxCaracteres renamed to max to match sample
             for (int j = 0; j < indent + 2; j++)
@@ -201,9 +202,9 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
         case WIDGET_ENTRY_PASSWORD:
         {
             entry_type_password *entry = (entry_type_password *)racine->widget_data;
-            g_print("  Entry password properties - w:%d h:%d x:%d y:%d\n",
-                    entry->dim->width, entry->dim->height,
-                    entry->cord->x, entry->cord->y);
+            TRACER(TRACE_ARBRE, TRACE_DEBUG, "  Entry password properties - w:%d h:%d x:%d y:%d",
+                    entry->dim.width, entry->dim.height,
+                    entry->cord.x, entry->cord.y);
 
             // Open entry tag
             for (int j = 0; j < indent + 2; j++)
@@ -235,19 +236,19 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
             // Position and size properties
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", entry->cord->x);
+            g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", entry->cord.x);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", entry->cord->y);
+            g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", entry->cord.y);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"width\" >%d</property>\n", entry->dim->width);
+            g_string_append_printf(string, "<property name=\"width\" >%d</property>\n", entry->dim.width);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"height\" >%d</property>\n", entry->dim->height);
+            g_string_append_printf(string, "<property name=\"height\" >%d</property>\n", entry->dim.height);
 
             // Add max property to match sample (using a default value or from struct if available)
             for (int j = 0; j < indent + 2; j++)
@@ -270,8 +271,8 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
         // {
         //     btn *button = (btn*)racine->widget_data;
         //     g_print("  Button normal properties - x:%d y:%d\n",
-        //            button->pos ? button->pos->x : 0,
-        //            button->pos ? button->pos->y : 0);
+        //            button->pos.x,
+        //            button->pos.y);
 
         //     // Position and size properties
         //     if (button->pos) {
@@ -279,18 +280,18 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
         //         g_string_append(string, "<button>\n");
 
         //         for (int j = 0; j < indent + 2; j++) g_string_append(string, "  ");
-        //         g_string_append_printf(string, "<property name=\"x\">%d</property>\n", button->pos->x);
+        //         g_string_append_printf(string, "<property name=\"x\">%d</property>\n", button->pos.x);
 
         //         for (int j = 0; j < indent + 2; j++) g_string_append(string, "  ");
-        //         g_string_append_printf(string, "<property name=\"y\">%d</property>\n", button->pos->y);
+        //         g_string_append_printf(string, "<property name=\"y\">%d</property>\n", button->pos.y);
         //     }
 
         //     if (button->dim) {
         //         for (int j = 0; j < indent + 2; j++) g_string_append(string, "  ");
-        //         g_string_append_printf(string, "<property name=\"width\">%d</property>\n", button->dim->width);
+        //         g_string_append_printf(string, "<property name=\"width\">%d</property>\n", button->dim.width);
 
         //         for (int j = 0; j < indent + 2; j++) g_string_append(string, "  ");
-        //         g_string_append_printf(string, "<property name=\"height\">%d</property>\n", button->dim->height);
+        //         g_string_append_printf(string, "<property name=\"height\">%d</property>\n", button->dim.height);
         //     }
 
         //     // Button-specific properties
@@ -312,25 +313,22 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
         case WIDGET_CHECKBOX:
         {
             btn *button = (btn *)racine->widget_data;
-            g_print("  Checkbox properties - x:%d y:%d checked:%d\n",
-                    button->pos ? button->pos->x : 0,
-                    button->pos ? button->pos->y : 0,
+            TRACER(TRACE_ARBRE, TRACE_DEBUG, "  Checkbox properties - x:%d y:%d checked:%d",
+                    button->pos.x,
+                    button->pos.y,
                     button->isChecked);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
             g_string_append(string, "<checkbox>\n");
             // Position and size properties
-            if (button->pos)
-            {
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", button->pos->x);
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", button->pos.x);
 
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", button->pos->y);
-            }
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", button->pos.y);
 
             // Checkbox-specific properties
             if (button->label)
@@ -362,18 +360,16 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
         case WIDGET_BUTTON_RADIO:
         {
             btn *button = (btn*)racine->widget_data;
-            g_print("  Radio button properties - x:%d y:%d\n",
-                   button->pos ? button->pos->x : 0,
-                   button->pos ? button->pos->y : 0);
+            TRACER(TRACE_ARBRE, TRACE_DEBUG, "  Radio button properties - x:%d y:%d",
+                   button->pos.x,
+                   button->pos.y);
 
             // Position and size properties
-            if (button->pos) {
-                for (int j = 0; j < indent + 2; j++) g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"x\">%d</property>\n", button->pos->x);
+            for (int j = 0; j < indent + 2; j++) g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"x\">%d</property>\n", button->pos.x);
 
-                for (int j = 0; j < indent + 2; j++) g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"y\">%d</property>\n", button->pos->y);
-            }
+            for (int j = 0; j < indent + 2; j++) g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"y\">%d</property>\n", button->pos.y);
 
             // Radio button-specific properties
             if (button->label) {
@@ -398,36 +394,30 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
         case WIDGET_BUTTON_TOGGLE:
         {
             btn *button = (btn *)racine->widget_data;
-            g_print("  Toggle button properties - x:%d y:%d checked:%d\n",
-                    button->pos ? button->pos->x : 0,
-                    button->pos ? button->pos->y : 0,
+            TRACER(TRACE_ARBRE, TRACE_DEBUG, "  Toggle button properties - x:%d y:%d checked:%d",
+                    button->pos.x,
+                    button->pos.y,
                     button->isChecked);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
             g_string_append(string, "<button>\n");
             // Position and size properties
-            if (button->pos)
-            {
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"x\">%d</property>\n", button->pos->x);
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"x\">%d</property>\n", button->pos.x);
 
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"y\">%d</property>\n", button->pos->y);
-            }
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"y\">%d</property>\n", button->pos.y);
 
-            if (button->dim)
-            {
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"width\">%d</property>\n", button->dim->width);
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"width\">%d</property>\n", button->dim.width);
 
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"height\">%d</property>\n", button->dim->height);
-            }
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"height\">%d</property>\n", button->dim.height);
 
             // Toggle button-specific properties
             if (button->label)
@@ -459,9 +449,9 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
         case WIDGET_BUTTON_SWITCH:
         {
             btn *button = (btn *)racine->widget_data;
-            g_print("  Switch button properties - x:%d y:%d active:%d\n",
-                    button->pos ? button->pos->x : 0,
-                    button->pos ? button->pos->y : 0,
+            TRACER(TRACE_ARBRE, TRACE_DEBUG, "  Switch button properties - x:%d y:%d active:%d",
+                    button->pos.x,
+                    button->pos.y,
                     button->isChecked);
 
             for (int j = 0; j < indent + 2; j++)
@@ -469,27 +459,21 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
             g_string_append(string, "<button>\n");
 
             // Position and size properties
-            if (button->pos)
-            {
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"x\">%d</property>\n", button->pos->x);
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"x\">%d</property>\n", button->pos.x);
 
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"y\">%d</property>\n", button->pos->y);
-            }
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"y\">%d</property>\n", button->pos.y);
 
-            if (button->dim)
-            {
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"width\">%d</property>\n", button->dim->width);
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"width\">%d</property>\n", button->dim.width);
 
-                for (int j = 0; j < indent + 2; j++)
-                    g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"height\">%d</property>\n", button->dim->height);
-            }
+            for (int j = 0; j < indent + 2; j++)
+                g_string_append(string, "  ");
+            g_string_append_printf(string, "<property name=\"height\">%d</property>\n", button->dim.height);
 
             // Switch-specific properties
             if (button->tooltip)
@@ -531,8 +515,8 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
             // }
 
             // g_print("  Spin button properties - x:%d y:%d min:%f max:%f step:%f digits:%u start:%f\n",
-            //         button->pos ? button->pos->x : 0,
-            //         button->pos ? button->pos->y : 0,
+            //         button->pos.x,
+            //         button->pos.y,
             //         sp->borneInf, sp->borneSup, sp->step, sp->digits, sp->start);
 
             // // Changed from <button> to <spin> to match parser's expected format
@@ -550,22 +534,22 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
             // {
             //     for (int j = 0; j < indent + 2; j++)
             //         g_string_append(string, "  ");
-            //     g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", button->pos->x);
+            //     g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", button->pos.x);
 
             //     for (int j = 0; j < indent + 2; j++)
             //         g_string_append(string, "  ");
-            //     g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", button->pos->y);
+            //     g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", button->pos.y);
             // }
 
             // if (button->dim)
             // {
             //     for (int j = 0; j < indent + 2; j++)
             //         g_string_append(string, "  ");
-            //     g_string_append_printf(string, "<property name=\"width\" >%d</property>\n", button->dim->width);
+            //     g_string_append_printf(string, "<property name=\"width\" >%d</property>\n", button->dim.width);
 
             //     for (int j = 0; j < indent + 2; j++)
             //         g_string_append(string, "  ");
-            //     g_string_append_printf(string, "<property name=\"height\" >%d</property>\n", button->dim->height);
+            //     g_string_append_printf(string, "<property name=\"height\" >%d</property>\n", button->dim.height);
             // }
 
             // // Spin button-specific properties - align names with parser expectations
@@ -612,8 +596,9 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
 
         case WIDGET_RADIO:
         {
-            g_print("\ndans le case du radio");
+            TRACER(TRACE_ARBRE, TRACE_DEBUG, "dans le case du radio");
             btn *radio = (btn *)racine->widget_data;
+            SharedStyle *radio_style = style_partage_effectif(radio->style);
             // g_print("\n\n\n==Radio widget %d", radio->dim->width);
             // g_print("Radio widget properties - text: %s, mnemonic: %d, police: %s, color: %s, taille: %d, gras: %d\n",
             //         radio->label, radio->hasMnemonic, radio->style->police, radio->style->color, radio->style->taille, radio->style->gras);
@@ -634,19 +619,19 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"police\" >%s</property>\n", radio->police);
+            g_string_append_printf(string, "<property name=\"police\" >%s</property>\n", (radio_style && radio_style->police) ? radio_style->police : "Sans");
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"color\" >%s</property>\n", radio->color);
+            g_string_append_printf(string, "<property name=\"color\" >%s</property>\n", (radio_style && radio_style->color[0]) ? radio_style->color : "black");
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"taille\" >%d</property>\n", radio->taille);
+            g_string_append_printf(string, "<property name=\"taille\" >%d</property>\n", radio_style ? radio_style->taille : -1);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"gras\" >%d</property>\n", radio->gras);
+            g_string_append_printf(string, "<property name=\"gras\" >%d</property>\n", radio_style ? radio_style->gras : -1);
 
             // Close </radio> tag
             for (int j = 0; j < indent + 2; j++)
@@ -659,6 +644,7 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
         case WIDGET_BUTTON:
         {
             btn *button = (btn *)racine->widget_data;
+            SharedStyle *button_style = style_partage_effectif(button->style);
             // // Open <button> tag
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
@@ -679,39 +665,39 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"police\" >%s</property>\n", button->police);
+            g_string_append_printf(string, "<property name=\"police\" >%s</property>\n", (button_style && button_style->police) ? button_style->police : "Sans");
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"color\" >%s</property>\n", button->color);
+            g_string_append_printf(string, "<property name=\"color\" >%s</property>\n", (button_style && button_style->color[0]) ? button_style->color : "black");
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"taille\" >%d</property>\n", button->taille);
+            g_string_append_printf(string, "<property name=\"taille\" >%d</property>\n", button_style ? button_style->taille : -1);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", button->pos->x);
+            g_string_append_printf(string, "<property name=\"x\" >%d</property>\n", button->pos.x);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", button->pos->y);
+            g_string_append_printf(string, "<property name=\"y\" >%d</property>\n", button->pos.y);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"width\" >%d</property>\n", button->dim->width);
+            g_string_append_printf(string, "<property name=\"width\" >%d</property>\n", button->dim.width);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"height\" >%d</property>\n", button->dim->height);
+            g_string_append_printf(string, "<property name=\"height\" >%d</property>\n", button->dim.height);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<property name=\"gras\" >%d</property>\n", button->gras);
+            g_string_append_printf(string, "<property name=\"gras\" >%d</property>\n", button_style ? button_style->gras : -1);
 
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-                g_string_append_printf(string, "<property name=\"bgcolor\" >%s</property>\n", button->bgcolor);
+                g_string_append_printf(string, "<property name=\"bgcolor\" >%s</property>\n", (button_style && button_style->bgcolor) ? button_style->bgcolor : "#FFFF");
 
             // // Close </button> tag
             for (int j = 0; j < indent + 2; j++)
@@ -728,7 +714,7 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
             // Generate the opening tag for <radioList> with x and y attributes
             for (int j = 0; j < indent + 2; j++)
                 g_string_append(string, "  ");
-            g_string_append_printf(string, "<radioList x=%d y=%d >\n", radioList->cord->x, radioList->cord->y);
+            g_string_append_printf(string, "<radioList x=%d y=%d >\n", radioList->cord.x, radioList->cord.y);
 
             // generate the radio buttons
             generate_xml_from_arbre(string, racine->fils, indent + 4);
@@ -744,13 +730,13 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
             /// add cases for ur widgets here
 
         default:
-            g_print("  Unknown widget type: %d\n", racine->type);
+            TRACER(TRACE_ARBRE, TRACE_AVERT, "  Unknown widget type: %d", racine->type);
             break;
         }
     }
     else
     {
-        g_print("  No widget_data present\n");
+        TRACER(TRACE_ARBRE, TRACE_DEBUG, "  No widget_data present");
     }
 
     // Also output any properties directly stored in the Arbre node
@@ -812,10 +798,43 @@ void generate_xml_from_arbre(GString *string, Arbre *racine, int indent)
     // g_string_append_printf(string, "</%s>\n", widget_type);
 }
 
+// File written by export_to_xml() in the worker pool
+typedef struct {
+    gchar *path;
+    GString *xml;
+    gboolean ok;
+    GError *error;
+} ExportWrite;
+
+// Worker thread: write the whole file at once (a reader never sees a half-written file)
+static void export_write_thread(gpointer data, GCancellable *cancellable)
+{
+    ExportWrite *job = (ExportWrite *)data;
+    TRACE_SPAN_DEBUT(debut_ecriture);
+    job->ok = g_file_set_contents(job->path, job->xml->str, job->xml->len, &job->error);
+    TRACE_SPAN_FIN(debut_ecriture, TRACE_ARBRE, "file write");
+}
+
+static void export_write_done(gpointer data)
+{
+    ExportWrite *job = (ExportWrite *)data;
+    if (job->ok)
+        g_print("XML exported to %s\n", job->path);
+    else
+        g_print("Error: Could not save to %s: %s\n", job->path,
+                job->error ? job->error->message : "not written");
+    g_clear_error(&job->error);
+    g_string_free(job->xml, TRUE);
+    g_free(job->path);
+    g_free(job);
+}
+
 // Export to XML function
 void export_to_xml(GtkWidget *widget, gpointer data)
 {
     AppData *app_data = (AppData *)data;
+    gint64 op_start = perf_op_begin();
+    TRACE_SPAN_DEBUT(debut);
 
     // Open a memory stream to write XML
     GString *xml_string = g_string_new("");
@@ -843,7 +862,9 @@ void export_to_xml(GtkWidget *widget, gpointer data)
     // Generate XML for all widgets in the tree
     if (app_data->widget_tree)
     {
+        TRACE_SPAN_DEBUT(debut_generation);
         generate_xml_from_arbre(xml_string, app_data->widget_tree, 4);
+        TRACE_SPAN_FIN(debut_generation, TRACE_ARBRE, "generate_xml_from_arbre");
     }
 
     // Close the XML structure
@@ -858,18 +879,13 @@ void export_to_xml(GtkWidget *widget, gpointer data)
     // Set the text in the buffer
     gtk_text_buffer_set_text(buffer, xml_string->str, -1);
 
-    // Save to file demo.html
-    FILE *file = fopen("demo.html", "w");
-    if (file)
-    {
-        fputs(xml_string->str, file);
-        fclose(file);
-        g_print("XML exported to demo.html\n");
-    }
-    else
-    {
-        g_print("Error: Could not save to demo.html\n");
-    }
+    // Save to file demo.html from the worker pool (the string is freed once written)
+    ExportWrite *job = g_new0(ExportWrite, 1);
+    job->path = g_strdup("demo.html");
+    job->xml = xml_string;
+    travail_lancer(TRAVAIL_FOND, export_write_thread, export_write_done, job, NULL);
+    TRACE_SPAN_FIN(debut, TRACE_ARBRE, "export XML");
+    perf_op_end(PERF_OP_EXPORT, op_start);
 
     // // Free the GString
     // g_string_free(xml_string, TRUE);
@@ -949,6 +965,42 @@ void export_to_xml(GtkWidget *widget, gpointer data)
     // gtk_widget_destroy(dialog);
 }
 
+// Show live memory by subsystem and the allocation sites still holding memory
+void on_memory_report_clicked(GtkWidget *widget, gpointer data)
+{
+    AppData *app_data = (AppData *)data;
+    GString *report = g_string_new("");
+
+    memoire_rapport_texte(report);
+    // Decoded pixels are owned by GdkPixbuf, not by the counted allocations
+    g_string_append_printf(report, "\nPixbuf cache: %u image(s), %" G_GSIZE_FORMAT " bytes retained\n",
+                           cache_pixbuf_nombre(), cache_pixbuf_memoire());
+
+    GtkWidget *dialog = gtk_dialog_new_with_buttons("Memory Report",
+                                                    GTK_WINDOW(app_data->window),
+                                                    GTK_DIALOG_MODAL,
+                                                    "Close", GTK_RESPONSE_CLOSE,
+                                                    NULL);
+    GtkWidget *content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+    GtkWidget *scroll = gtk_scrolled_window_new(NULL, NULL);
+    GtkWidget *text_view = gtk_text_view_new();
+
+    gtk_text_view_set_editable(GTK_TEXT_VIEW(text_view), FALSE);
+    gtk_text_view_set_monospace(GTK_TEXT_VIEW(text_view), TRUE);
+    gtk_text_buffer_set_text(gtk_text_view_get_buffer(GTK_TEXT_VIEW(text_view)), report->str, -1);
+    gtk_widget_set_size_request(scroll, 700, 400);
+    gtk_container_add(GTK_CONTAINER(scroll), text_view);
+    gtk_container_add(GTK_CONTAINER(content_area), scroll);
+
+    // Also print to console so it can be diffed between two moments of a session
+    g_print("=== Memory report ===\n%s", report->str);
+    g_string_free(report, TRUE);
+
+    gtk_widget_show_all(dialog);
+    gtk_dialog_run(GTK_DIALOG(dialog));
+    gtk_widget_destroy(dialog);
+}
+
 // Update UI in response to a new container being selected
 static void update_ui_for_container(AppData *app_data)
 {
@@ -957,13 +1009,13 @@ static void update_ui_for_container(AppData *app_data)
     if (!container)
     {
         // Default case, show widgets for the preview area
-        g_print("Showing widgets for preview area\n");
+        TRACER(TRACE_EVENEMENTS, TRACE_DEBUG, "Showing widgets for preview area");
     }
     else
     {
         // Show widgets for the selected container
         const gchar *name = gtk_widget_get_name(container);
-        g_print("Showing widgets for container: %s\n", name);
+        TRACER(TRACE_EVENEMENTS, TRACE_DEBUG, "Showing widgets for container: %s", name);
     }
 }
 
@@ -83,7 +83,7 @@ btn* init_checkbox_xml(FILE *file, int parent){
                 expand[ind++] = car; // Lire le mot
             }
             expand[ind] = '\0';
-            printf("%s\n", expand);
+            TRACER(TRACE_XML, TRACE_DEBUG, "expand: %s", expand);
             fseek(file, 10, SEEK_CUR);
             expand_gchar = g_strdup(expand);
         }
@@ -97,7 +97,7 @@ btn* init_checkbox_xml(FILE *file, int parent){
                 fill[ind++] = car; // Lire le mot
             }
             fill[ind] = '\0';
-            printf("%s\n", fill);
+            TRACER(TRACE_XML, TRACE_DEBUG, "fill: %s", fill);
             fseek(file, 10, SEEK_CUR);
             fill_gchar= g_strdup(fill);
         }
@@ -107,7 +107,7 @@ btn* init_checkbox_xml(FILE *file, int parent){
     MonImage* ima = NULL;//Initier l'image avec NULL
     //Creer l'image si le path est saisie
     if(strlen(icon) > 0){
-        ima = init_image(icon,*dim(24,24), *cord(0,0));
+        ima = init_image(icon, (dimension){24, 24}, (coordonnees){0, 0});
     }
 
     btn* mybtn = NULL;
@@ -159,7 +159,7 @@ void checkbox_xml(FILE *file, int parent) {
             while (((car = fgetc(file)) != EOF) && (car != '<')) {
                 gras = car; // Lire le mot
             }
-            printf("%c\n", gras);
+            TRACER(TRACE_XML, TRACE_DEBUG, "gras: %c", gras);
             fseek(file, 13, SEEK_CUR);
             // Convertir en entier
             buttonStyle->gras = char_TO_int(gras);
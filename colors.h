@@ -21,15 +21,15 @@ HexColor *hex_color_init(const gchar *hex_code) {
     }
 
     HexColor *new_color ;
-    new_color =(HexColor*) malloc(sizeof(HexColor));
+    new_color =(HexColor*) memoire_allouer(MEMOIRE_STYLES, sizeof(HexColor));
     if (!new_color) {
         g_print( "Erreur d'allocation mémoire pour HexColor\n");
         return NULL;
     }
-    new_color->color =(GdkRGBA*) malloc(sizeof(GdkRGBA));
+    new_color->color =(GdkRGBA*) memoire_allouer(MEMOIRE_STYLES, sizeof(GdkRGBA));
     if (!new_color->color) {
        g_print( "Erreur d'allocation mémoire pour GdkRGBA\n");
-        free(new_color);
+        memoire_liberer(new_color);
         return NULL;
     }
 
@@ -46,4 +46,20 @@ HexColor *hex_color_init(const gchar *hex_code) {
 
 
 
+// Couleur rendue par valeur, sans GdkRGBA: suffit aux styles temporaires puisque
+// intern_style() ne lit que hex_code
+HexColor hex_color_valeur(const gchar *hex_code) {
+    HexColor couleur = { .color = NULL };
+    g_strlcpy(couleur.hex_code, hex_code ? hex_code : "", sizeof(couleur.hex_code));
+    return couleur;
+}
+
+// Fonction pour libérer une couleur créée par hex_color_init (NULL accepté)
+void liberer_hex_color(HexColor *couleur) {
+    if (!couleur)
+        return;
+    memoire_liberer(couleur->color);
+    memoire_liberer(couleur);
+}
+
 #endif //PROJET_GTK_COLORS_H
@@ -7,57 +7,112 @@
 #include "tree_sync.h"
 #include "container_utils.h"
 
+// Model shared by every container combo box: one row per container, the
+// first row being the preview area (NULL container). Containers are added and
+// removed one row at a time, so the combos never need to be rebuilt.
+GtkListStore *get_container_store(AppData *app_data) {
+    if (!app_data->container_store) {
+        app_data->container_store = gtk_list_store_new(CONTAINER_N_COLUMNS,
+                                                       G_TYPE_STRING, G_TYPE_POINTER);
+        gtk_list_store_insert_with_values(app_data->container_store, NULL, -1,
+                                          CONTAINER_COL_NAME, "Window (Default)",
+                                          CONTAINER_COL_WIDGET, NULL, -1);
+    }
+    return app_data->container_store;
+}
+
+// Find the row of a container in the shared model
+static gboolean find_container_row(AppData *app_data, GtkWidget *container, GtkTreeIter *row) {
+    GtkTreeModel *model = GTK_TREE_MODEL(get_container_store(app_data));
+    gboolean valid = gtk_tree_model_get_iter_first(model, row);
+    while (valid) {
+        GtkWidget *widget = NULL;
+        gtk_tree_model_get(model, row, CONTAINER_COL_WIDGET, &widget, -1);
+        if (widget == container && container) return TRUE;
+        valid = gtk_tree_model_iter_next(model, row);
+    }
+    return FALSE;
+}
+
+// Register a new container: appends it to the containers list and to the combos
+void add_container(AppData *app_data, GtkWidget *container) {
+    app_data->containers = g_list_append(app_data->containers, container);
+    gtk_list_store_insert_with_values(get_container_store(app_data), NULL, -1,
+                                      CONTAINER_COL_NAME, gtk_widget_get_name(container),
+                                      CONTAINER_COL_WIDGET, container, -1);
+}
+
+// Forget a container (no-op if it is not one)
+void remove_container(AppData *app_data, GtkWidget *container) {
+    GList *link = g_list_find(app_data->containers, container);
+    if (link == NULL) return;
+    app_data->containers = g_list_delete_link(app_data->containers, link);
+
+    GtkTreeIter row;
+    if (find_container_row(app_data, container, &row))
+        gtk_list_store_remove(app_data->container_store, &row);
+    if (app_data->selected_container == container)
+        app_data->selected_container = NULL;
+}
+
+// Create a combo box over the shared container model, showing the current container
+GtkWidget *create_container_combo(AppData *app_data) {
+    GtkWidget *combo = gtk_combo_box_new_with_model(GTK_TREE_MODEL(get_container_store(app_data)));
+    GtkCellRenderer *renderer = gtk_cell_renderer_text_new();
+    gtk_cell_layout_pack_start(GTK_CELL_LAYOUT(combo), renderer, TRUE);
+    gtk_cell_layout_set_attributes(GTK_CELL_LAYOUT(combo), renderer,
+                                   "text", CONTAINER_COL_NAME, NULL);
+
+    select_current_container(GTK_COMBO_BOX(combo), app_data);
+    return combo;
+}
+
+// Point a container combo at the current container (the default row if there is none)
+void select_current_container(GtkComboBox *combo, AppData *app_data) {
+    GtkTreeIter row;
+    if (app_data->selected_container && find_container_row(app_data, app_data->selected_container, &row))
+        gtk_combo_box_set_active_iter(combo, &row);
+    else
+        gtk_combo_box_set_active(combo, 0);
+}
+
+// The container chosen in a container combo, the preview area for the default row
+GtkWidget *get_selected_container(GtkComboBox *combo, AppData *app_data) {
+    GtkWidget *container = NULL;
+    GtkTreeIter row;
+    if (gtk_combo_box_get_active_iter(combo, &row))
+        gtk_tree_model_get(gtk_combo_box_get_model(combo), &row, CONTAINER_COL_WIDGET, &container, -1);
+    return container ? container : app_data->preview_area;
+}
+
 // Helper function to update container selection combo box
 void update_container_combo(AppData *app_data) {
-    GtkComboBoxText *combo = GTK_COMBO_BOX_TEXT(app_data->container_combo);
-    
-    // Clear existing items
-    gtk_combo_box_text_remove_all(combo);
-    
-    // Add default option (preview area)
-    gtk_combo_box_text_append_text(combo, "Window (Default)");
-    
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next) {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(combo, name);
-    }
-    
-    // Select default option
-    gtk_combo_box_set_active(GTK_COMBO_BOX(combo), 0);
+    // The model is kept up to date by add_container/remove_container:
+    // only go back to the default option
+    gtk_combo_box_set_active(GTK_COMBO_BOX(app_data->container_combo), 0);
 }
 
 // Callback for container selection
 static void on_container_selected(GtkComboBox *combo, gpointer user_data) {
     AppData *app_data = (AppData *)user_data;
-    gint active = gtk_combo_box_get_active(combo);
+    GtkTreeIter row;
+    GtkWidget *container = NULL;
     
-    if (active == 0) {
+    if (gtk_combo_box_get_active_iter(combo, &row)) {
+        gtk_tree_model_get(gtk_combo_box_get_model(combo), &row, CONTAINER_COL_WIDGET, &container, -1);
+    }
+    
+    if (container == NULL) {
         // Default option (preview area)
         app_data->selected_container = NULL;
-        g_print("Selected container: Preview Area\n");
+        TRACER(TRACE_EVENEMENTS, TRACE_DEBUG, "Selected container: Preview Area");
     } else {
         // Get the selected container
-        app_data->selected_container = g_list_nth_data(app_data->containers, active - 1);
+        app_data->selected_container = container;
         
-        if (app_data->selected_container) {
-            // Print info about the selected container for debugging
-            const gchar *name = gtk_widget_get_name(app_data->selected_container);
-            g_print("Selected container: %s (%p)\n", name ? name : "unnamed", app_data->selected_container);
-            
-            // Print container type for debugging
-            if (GTK_IS_BOX(app_data->selected_container)) {
-                g_print("Container type: Box\n");
-            } else if (GTK_IS_GRID(app_data->selected_container)) {
-                g_print("Container type: Grid\n");
-            } else if (GTK_IS_FIXED(app_data->selected_container)) {
-                g_print("Container type: Fixed\n");
-            } else {
-                g_print("Container type: Other\n");
-            }
-        }
+        const gchar *name = gtk_widget_get_name(container);
+        TRACER(TRACE_EVENEMENTS, TRACE_DEBUG, "Selected container: %s (%s, %p)", name ? name : "unnamed",
+               G_OBJECT_TYPE_NAME(container), (void *)container);
     }
 }
 
@@ -92,25 +147,7 @@ static void create_box_container(GtkWidget *widget, gpointer data) {
     
     // Add container selection at the top of the dialog
     GtkWidget *parent_container_label = gtk_label_new("Add to Container:");
-    GtkWidget *parent_container_combo = gtk_combo_box_text_new();
-    
-    // Add default option (preview area)
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(parent_container_combo), "Window (Default)");
-    
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next) {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(parent_container_combo), name);
-    }
-    
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container) {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
-    }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(parent_container_combo), active_index);
+    GtkWidget *parent_container_combo = create_container_combo(app_data);
     
     // Add container selection to the top of the form
     gtk_grid_attach(GTK_GRID(grid), parent_container_label, 0, 0, 1, 1);
@@ -188,14 +225,7 @@ static void create_box_container(GtkWidget *widget, gpointer data) {
                                      GTK_ORIENTATION_HORIZONTAL : GTK_ORIENTATION_VERTICAL;
         
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(parent_container_combo));
-        GtkWidget *target_container = NULL;
-        
-        if (container_index > 0) {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        } else {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(parent_container_combo), app_data);
         
         // Create the box container
         GtkWidget *box = gtk_box_new(orientation, spacing);
@@ -217,7 +247,7 @@ static void create_box_container(GtkWidget *widget, gpointer data) {
         }
         
         // Add the container to our list
-        app_data->containers = g_list_append(app_data->containers, box);
+        add_container(app_data, box);
         
         // Add to both tree structures
         add_widget_to_both_trees(app_data, box, g_strdup_printf("Box: %s", name), 
@@ -227,7 +257,7 @@ static void create_box_container(GtkWidget *widget, gpointer data) {
         update_container_combo(app_data);
         
         // Show the box
-        gtk_widget_show_all(app_data->preview_area);
+        afficher_en_attente();
     }
     
     gtk_widget_destroy(dialog);
@@ -267,25 +297,7 @@ static void create_styled_box_container(GtkWidget *widget, gpointer data) {
     
     // Add container selection at the top of the dialog
     GtkWidget *parent_container_label = gtk_label_new("Add to Container:");
-    GtkWidget *parent_container_combo = gtk_combo_box_text_new();
-    
-    // Add default option (preview area)
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(parent_container_combo), "Window (Default)");
-    
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next) {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(parent_container_combo), name);
-    }
-    
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container) {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
-    }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(parent_container_combo), active_index);
+    GtkWidget *parent_container_combo = create_container_combo(app_data);
     
     // Add container selection to the top of the form
     gtk_grid_attach(GTK_GRID(grid), parent_container_label, 0, 0, 1, 1);
@@ -401,18 +413,11 @@ static void create_styled_box_container(GtkWidget *widget, gpointer data) {
         const gchar *border = gtk_entry_get_text(GTK_ENTRY(border_entry));
         
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(parent_container_combo));
-        GtkWidget *target_container = NULL;
-        
-        if (container_index > 0) {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        } else {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(parent_container_combo), app_data);
         
-        // Create position and dimension structures
-        coordonnees *pos = cord(x, y);
-        dimension *dim = dim(width, height);
+        // Position and dimension are stored by value in the box
+        coordonnees pos = {x, y};
+        dimension dim = {height, width};
         
         // Create the styled box container
         StyledBox *styled_box = allocate_styled_box();
@@ -467,7 +472,7 @@ static void create_styled_box_container(GtkWidget *widget, gpointer data) {
         }
         
         // Add the container to our list
-        app_data->containers = g_list_append(app_data->containers, styled_box->widget);
+        add_container(app_data, styled_box->widget);
         
         // Add to both tree structures
         add_widget_to_both_trees(app_data, styled_box->widget, g_strdup_printf("StyledBox: %s", name), 
@@ -477,7 +482,7 @@ static void create_styled_box_container(GtkWidget *widget, gpointer data) {
         update_container_combo(app_data);
         
         // Show the styled box
-        gtk_widget_show_all(app_data->preview_area);
+        afficher_en_attente();
     }
     
     gtk_widget_destroy(dialog);
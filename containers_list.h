@@ -18,6 +18,7 @@
 #define MAX_PROPS 20        // Maximum number of properties
 #define MAX_PROP_NAME 64    // Maximum property name length
 #define MAX_PROP_VALUE 256  // Maximum property value length
+#define ARBRE_CLE_NOEUD "noeud_arbre"  // Donnée d'un widget: son noeud Arbre (voir noeud_du_widget)
 
 // Structure pour stocker une propriété avec un nom et une valeur
 typedef struct {
@@ -68,6 +69,43 @@ void add_style_property_to_node(Arbre* node, const char* name, const char* value
     }
 }
 
+// Fonction pour lire une propriété d'un noeud Arbre (NULL si elle n'existe pas)
+const char* get_property_of_node(Arbre* node, const char* name) {
+    for (int i = 0; i < node->prop_count; i++)
+        if (strcmp(node->properties[i].name, name) == 0)
+            return node->properties[i].value;
+    return NULL;
+}
+
+// Fonction pour modifier une propriété d'un noeud Arbre (ajoutée si elle n'existe pas encore)
+void set_property_of_node(Arbre* node, const char* name, const char* value) {
+    for (int i = 0; i < node->prop_count; i++)
+        if (strcmp(node->properties[i].name, name) == 0) {
+            strncpy(node->properties[i].value, value, MAX_PROP_VALUE-1);
+            return;
+        }
+    add_property_to_node(node, name, value);
+}
+
+/**
+ * @brief Lit la position et la taille d'un noeud depuis ses propriétés x, y, width et height.
+ *
+ * @param node Le noeud à lire.
+ * @param rect Rempli avec la géométrie du noeud. width/height valent -1 s'ils ne sont pas renseignés.
+ * @return bool true si le noeud a une position (x et y), false sinon.
+ */
+bool get_node_geometry(Arbre* node, GdkRectangle* rect) {
+    const char* x = get_property_of_node(node, "x");
+    const char* y = get_property_of_node(node, "y");
+    const char* w = get_property_of_node(node, "width");
+    const char* h = get_property_of_node(node, "height");
+    rect->x = x ? atoi(x) : 0;
+    rect->y = y ? atoi(y) : 0;
+    rect->width = w ? atoi(w) : -1;
+    rect->height = h ? atoi(h) : -1;
+    return x && y;
+}
+
 // Changed: Updated to set enum type instead of string
 void set_widget_type(Arbre* node, WidgetType type) {
     node->type = type;
@@ -82,7 +120,7 @@ void set_widget_type(Arbre* node, WidgetType type) {
  */
 Arbre* allouer_arbre(char* nom, GtkWidget* widget, Arbre* frere, Arbre* fils, bool is_container) {
     // Allocation mémoire pour le noeud
-    Arbre* nouveau_noeud = (Arbre*)malloc(sizeof(Arbre));
+    Arbre* nouveau_noeud = (Arbre*)memoire_allouer(MEMOIRE_ARBRE, sizeof(Arbre));
 
     // Vérification si l'allocation a échoué
     if (nouveau_noeud == NULL) {
@@ -123,30 +161,30 @@ Arbre* insererArbre(Arbre* racine, Arbre* elem, const char* nomDuPere){
         perror("errr");
         exit(-1);
     }
-    Arbre* temp = racine;
-    if((strcmp(nomDuPere, temp->nom) == 0) && temp->is_container){
-        //Inserer comme frere du premier fils
-        if(temp->fils){
-            temp = temp->fils;
-            //Parcourir les freres
-            while(temp->frere){
-                temp = temp->frere;
+    //Les frères sont parcourus en boucle: une longue liste ne creuse pas la pile
+    for(Arbre* noeud = racine; noeud; noeud = noeud->frere){
+        if((strcmp(nomDuPere, noeud->nom) == 0) && noeud->is_container){
+            Arbre* temp = noeud;
+            //Inserer comme frere du premier fils
+            if(temp->fils){
+                temp = temp->fils;
+                //Parcourir les freres
+                while(temp->frere){
+                    temp = temp->frere;
+                }
+                //Inserer dans freres
+                temp->frere = elem;
             }
-            //Inserer dans freres
-            temp->frere = elem;
-        }
-        else {
-            //inserer comme premier fils
-            temp->fils = elem;
+            else {
+                //inserer comme premier fils
+                temp->fils = elem;
+            }
+            break;
         }
-        return racine;
-    }
-
-    if(racine->fils)
-        insererArbre(racine->fils, elem, nomDuPere);
 
-    if(racine->frere)
-        insererArbre(racine->frere, elem, nomDuPere);
+        if(noeud->fils)
+            insererArbre(noeud->fils, elem, nomDuPere);
+    }
 
     return racine;
 }
@@ -305,29 +343,83 @@ GtkWidget* creer_arborescence_visuelle(Arbre *racine) {
 }
 
 
+/**
+ * @brief Retourne le noeud de l'arbre associé au widget donné.
+ *
+ * Parcourt tout l'arbre: quand le noeud a été enregistré sur le widget (lier_noeud_widget),
+ * noeud_du_widget() le rend directement.
+ *
+ * @param racine La racine de l'arbre à parcourir.
+ * @param widget Le widget recherché.
+ * @return Arbre* Le noeud du widget, ou NULL s'il n'est pas trouvé.
+ */
+Arbre* getNoeudByWidget(Arbre *racine, GtkWidget *widget) {
+    //Les frères sont parcourus en boucle: une longue liste ne creuse pas la pile
+    for (Arbre *noeud = racine; noeud != NULL; noeud = noeud->frere) {
+        if (noeud->widget == widget)
+            return noeud;
+        Arbre *resultat = getNoeudByWidget(noeud->fils, widget);
+        if (resultat != NULL)
+            return resultat;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Enregistre le noeud sur son widget, pour le retrouver sans parcourir l'arbre.
+ *
+ * La donnée est effacée par supprimer_noeud() et disparait avec le widget.
+ *
+ * @param noeud Le noeud (son champ widget peut etre NULL: rien n'est fait).
+ */
+void lier_noeud_widget(Arbre *noeud) {
+    if (noeud != NULL && noeud->widget != NULL)
+        g_object_set_data(G_OBJECT(noeud->widget), ARBRE_CLE_NOEUD, noeud);
+}
+
+/**
+ * @brief Retourne le noeud enregistré sur le widget par lier_noeud_widget(), en O(1).
+ *
+ * @param widget Le widget.
+ * @return Arbre* Son noeud, ou NULL s'il n'en a pas.
+ */
+Arbre* noeud_du_widget(GtkWidget *widget) {
+    return widget != NULL ? g_object_get_data(G_OBJECT(widget), ARBRE_CLE_NOEUD) : NULL;
+}
+
+
+/**
+ * @brief Compte les noeuds d'un arbre (la racine, ses frères et tous leurs descendants).
+ *
+ * @param racine La racine de l'arbre (peut etre NULL).
+ * @return int Le nombre de noeuds.
+ */
+int compterNoeuds(Arbre *racine) {
+    int nombre = 0;
+    //Les frères sont parcourus en boucle: une longue liste ne creuse pas la pile
+    for (Arbre *noeud = racine; noeud != NULL; noeud = noeud->frere)
+        nombre += 1 + compterNoeuds(noeud->fils);
+    return nombre;
+}
+
+
 /**
  * @brief Recherche dans l'arbre le nom du conteneur associé au widget donné.
  *
- * La fonction parcourt récursivement l'arbre à partir de la racine et compare le champ
- * 'widget' de chaque noeud avec le widget fourni. Si une correspondance est trouvée, le
- * nom du conteneur (le champ 'nom') est retourné.
+ * Le noeud enregistré sur le widget (lier_noeud_widget) est utilisé s'il existe; sinon la
+ * fonction parcourt l'arbre à partir de la racine et compare le champ 'widget' de chaque
+ * noeud avec le widget fourni. Si une correspondance est trouvée, le nom du conteneur
+ * (le champ 'nom') est retourné.
  *
  * @param racine La racine de l'arbre dans lequel effectuer la recherche.
  * @param widget Le widget du conteneur recherché.
  * @return char* Le nom du conteneur correspondant, ou NULL s'il n'est pas trouvé.
  */
 char* getNomConteneurByWidget(Arbre *racine, GtkWidget *widget) {
-    if (racine == NULL)
-        return NULL;
-
-    if (racine->widget == widget)
-        return racine->nom;
-
-    char *resultat = getNomConteneurByWidget(racine->fils, widget);
-    if (resultat != NULL)
-        return resultat;
-
-    return getNomConteneurByWidget(racine->frere, widget);
+    Arbre *noeud = noeud_du_widget(widget);
+    if (noeud == NULL)
+        noeud = getNoeudByWidget(racine, widget);
+    return noeud != NULL ? noeud->nom : NULL;
 }
 
 
@@ -359,25 +451,29 @@ int getIndice(char *tableau[], char *chaine) {
 /**
  * @brief Supprime un noeud de l'arbre ainsi que tous ses descendants.
  *
- * Cette fonction libère récursivement la mémoire allouée pour le noeud passé en paramètre,
+ * Cette fonction libère la mémoire allouée pour le noeud passé en paramètre,
  * ainsi que pour tous ses fils et frères. Elle doit être utilisée pour supprimer un noeud
  * détaché de l'arbre ou pour supprimer l'intégralité d'un sous-arbre.
+ * Les widgets des noeuds doivent encore exister: le noeud enregistré sur eux est effacé.
  *
  * @param noeud Pointeur vers le noeud à supprimer.
  */
 void supprimer_noeud(Arbre *noeud) {
-    if (noeud == NULL) {
-        return;
+    //Les frères sont parcourus en boucle: une longue liste ne creuse pas la pile
+    while (noeud != NULL) {
+        Arbre *suivant = noeud->frere;
+        
+        // Supprimer récursivement le sous-arbre des fils
+        supprimer_noeud(noeud->fils);
+        
+        // Le widget ne doit plus désigner le noeud libéré
+        if (noeud_du_widget(noeud->widget) == noeud)
+            g_object_set_data(G_OBJECT(noeud->widget), ARBRE_CLE_NOEUD, NULL);
+        
+        // Libérer le noeud courant
+        memoire_liberer(noeud);
+        noeud = suivant;
     }
-    
-    // Supprimer récursivement le sous-arbre des fils
-    supprimer_noeud(noeud->fils);
-    
-    // Supprimer récursivement le sous-arbre des frères
-    supprimer_noeud(noeud->frere);
-    
-    // Libérer le noeud courant
-    free(noeud);
 }
 
 
@@ -400,6 +496,7 @@ Arbre* supprimerNoeudParNom(Arbre* racine, const char* nom) {
     // Si le noeud courant correspond au nom recherché, le supprimer
     if (strcmp(racine->nom, nom) == 0) {
         Arbre* nouveau = racine->frere;  // Sauvegarder la suite de la liste au même niveau
+        racine->frere = NULL;            // Détacher le noeud: ses frères restent dans l'arbre
         supprimer_noeud(racine);         // Libérer la mémoire du noeud et de ses descendants
         return nouveau;
     }
@@ -411,4 +508,38 @@ Arbre* supprimerNoeudParNom(Arbre* racine, const char* nom) {
     return racine;
 }
 
+
+//Cherche le noeud du widget parmi *lien, ses frères et leurs descendants; le détache et le
+//libère. Retourne vrai si le noeud a été trouvé.
+static bool supprimer_noeud_widget(Arbre** lien, GtkWidget* widget) {
+    //Les frères sont parcourus en boucle: une longue liste ne creuse pas la pile
+    for (; *lien != NULL; lien = &(*lien)->frere) {
+        Arbre* noeud = *lien;
+        if (noeud->widget == widget) {
+            *lien = noeud->frere;
+            noeud->frere = NULL;
+            supprimer_noeud(noeud);
+            return true;
+        }
+        if (supprimer_noeud_widget(&noeud->fils, widget))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Retire de l'arbre le noeud associé au widget donné et libère ce noeud avec ses descendants.
+ *
+ * Les frères du noeud restent dans l'arbre. La structure du widget (widget_data) n'est pas
+ * libérée ici: elle appartient au widget et disparait avec lui (voir memoire_attacher).
+ *
+ * @param racine La racine de l'arbre ou du sous-arbre à traiter.
+ * @param widget Le widget dont le noeud doit etre supprimé.
+ * @return Arbre* Le nouvel arbre (ou sous-arbre) après suppression du noeud.
+ */
+Arbre* supprimerNoeudParWidget(Arbre* racine, GtkWidget* widget) {
+    supprimer_noeud_widget(&racine, widget);
+    return racine;
+}
+
 #endif //XML_TAHA_CONTAINERS_LIST_H
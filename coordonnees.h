@@ -15,7 +15,7 @@ typedef struct cd
 coordonnees* create_coordonnees(gint x, gint y)
 {
     // Allocation dynamique de mémoire
-    coordonnees *cord = (coordonnees*)malloc(sizeof(coordonnees));
+    coordonnees *cord = (coordonnees*)memoire_allouer(MEMOIRE_WIDGETS, sizeof(coordonnees));
     if (cord == NULL)
     {
         // Gestion de l'échec d'allocation mémoire
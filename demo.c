@@ -12,6 +12,8 @@
 #include "widget_types.h"  // Add the widget type enum header
 // #include "forms.h"         // Add the forms system header
 #include "widget_props.h"  // Add the widget properties header
+#include "perf_panel.h"
+#include "open_layout.h"
 #include "entry_editing.h"  // Include this header last
 
 void run_demo(GtkWidget *widget, gpointer data) {
@@ -24,18 +26,23 @@ void run_demo(GtkWidget *widget, gpointer data) {
     if (!file) {
         printf("ERREUR d'ouverture du fichier !!");
     }
+    gint64 op_start = perf_op_begin();
     creer_object(file, 0);
+    perf_op_end(PERF_OP_LOAD, op_start);
     
 }
 
 int main(int argc, char *argv[]) {
     // Initialize GTK
     gtk_init(&argc, &argv);
+    // --memory-report: print live memory by subsystem at exit
+    memoire_lire_options(argc, argv);
     
     // App data structure to hold our widgets
     AppData app_data;
     // Initialize container management in AppData
     app_data.containers = NULL;
+    app_data.container_store = NULL;
     app_data.selected_container = NULL;
 
     // Window dimensions and coordinates
@@ -183,7 +190,8 @@ int main(int argc, char *argv[]) {
     // gtk_widget_set_size_request(hierarchy_scroll, -1, 150);  // Reduced height to make room
     
     // Create tree view for hierarchy
-    app_data.hierarchy_store = gtk_tree_store_new(2, G_TYPE_STRING, G_TYPE_POINTER);
+    app_data.hierarchy_store = gtk_tree_store_new(HIERARCHY_N_COLUMNS, G_TYPE_STRING, G_TYPE_POINTER,
+                                                  G_TYPE_POINTER, G_TYPE_POINTER);
     app_data.hierarchy_view = gtk_tree_view_new_with_model(GTK_TREE_MODEL(app_data.hierarchy_store));
     
     GtkCellRenderer *renderer = gtk_cell_renderer_text_new();
@@ -220,9 +228,7 @@ int main(int argc, char *argv[]) {
     
     // Add container selection to main UI
     GtkWidget *container_frame = gtk_frame_new("Current Container");
-    app_data.container_combo = gtk_combo_box_text_new();
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(app_data.container_combo), "Window (Default)");
-    gtk_combo_box_set_active(GTK_COMBO_BOX(app_data.container_combo), 0);
+    app_data.container_combo = create_container_combo(&app_data);
     g_signal_connect(app_data.container_combo, "changed", G_CALLBACK(on_container_selected), &app_data);
     
     GtkWidget *container_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
@@ -282,6 +288,13 @@ int main(int argc, char *argv[]) {
         app_data.arbre_view = arbre_view;  // Store for later updates
     }
     
+    // Live performance stats, right below the Arbre view (collapsed by default)
+    GtkWidget *perf_panel = create_perf_panel(app_data.preview_area,
+                                              GTK_TREE_MODEL(app_data.hierarchy_store),
+                                              &app_data.widget_tree);
+    gtk_box_pack_start(GTK_BOX(left_panel), perf_panel, FALSE, FALSE, 0);
+    gtk_box_reorder_child(GTK_BOX(left_panel), perf_panel, 4);
+    
     // Create right properties panel with explicit size and frame
     GtkWidget *properties_frame = gtk_frame_new("Properties");
     app_data.properties_panel = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
@@ -298,19 +311,26 @@ int main(int argc, char *argv[]) {
     GtkWidget *button_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
     gtk_container_set_border_width(GTK_CONTAINER(button_box), 5);
     
+    GtkWidget *open_button = gtk_button_new_with_label("Open Layout");
     GtkWidget *export_button = gtk_button_new_with_label("Export XML");
     GtkWidget *run_button = gtk_button_new_with_label("Run Demo");
     GtkWidget *debug_button = gtk_button_new_with_label("Debug Tree Structure");
+    GtkWidget *memory_button = gtk_button_new_with_label("Memory Report");
     GtkWidget *exit_button = gtk_button_new_with_label("Exit");
     
+    g_signal_connect(open_button, "clicked", G_CALLBACK(on_open_layout_clicked), &app_data);
     g_signal_connect(export_button, "clicked", G_CALLBACK(export_to_xml), &app_data);
     g_signal_connect(run_button, "clicked", G_CALLBACK(run_demo), &app_data);
     g_signal_connect(debug_button, "clicked", G_CALLBACK(on_show_arbre_clicked), &app_data);
+    g_signal_connect(memory_button, "clicked", G_CALLBACK(on_memory_report_clicked), &app_data);
     g_signal_connect(exit_button, "clicked", G_CALLBACK(gtk_main_quit), NULL);
     
+    gtk_box_pack_start(GTK_BOX(button_box), open_button, FALSE, FALSE, 2);
+    gtk_box_pack_start(GTK_BOX(button_box), create_open_layout_bar(), FALSE, FALSE, 2);
     gtk_box_pack_start(GTK_BOX(button_box), export_button, FALSE, FALSE, 2);
     gtk_box_pack_start(GTK_BOX(button_box), run_button, FALSE, FALSE, 2);
     gtk_box_pack_start(GTK_BOX(button_box), debug_button, FALSE, FALSE, 2);
+    gtk_box_pack_start(GTK_BOX(button_box), memory_button, FALSE, FALSE, 2);
     gtk_box_pack_start(GTK_BOX(button_box), exit_button, FALSE, FALSE, 2);
     
     // Add test functions button
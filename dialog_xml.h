@@ -122,8 +122,10 @@ void BoiteDialog_xml(FILE *file,int parent)
             //Récuperer le path de l'image
             lire_gchar_str(file,iconMessage);
             //Creer l'image
-            MonImage* ima = init_image(iconMessage,*dim(48,48), *cord(32,32));
+            MonImage* ima = init_image(iconMessage, (dimension){48, 48}, (coordonnees){32, 32});
             creer_image(ima);
+            //L'image possède sa structure: elle est libérée à sa destruction
+            memoire_attacher(ima->Image, ima, memoire_liberer);
             //Ajouter l'image au conteneur (contentArea)
             gtk_box_pack_start(GTK_BOX(contentArea), ima->Image, TRUE, TRUE, 0);
         }
@@ -202,6 +204,7 @@ void BoiteDialog_xml(FILE *file,int parent)
     if(color)
         gtk_widget_override_background_color(boite->dialog, GTK_STATE_FLAG_NORMAL,
                                              color->color);
+    liberer_hex_color(color);
     //Ajouter les bouton au actionArea s'ils existent
     if(btnOk )
         addActionWidget(boite, btnOk, GTK_RESPONSE_OK);
@@ -16,6 +16,72 @@ static gchar *generate_unique_id()
     return unique_id;
 }
 
+/**
+ * Creation dialogs are built on first use and kept for the whole session.
+ * They are not modal: OK/Cancel go through the "response" signal, closing
+ * only hides the window, and each show resets the form before presenting it
+ * again, so the main loop (and the preview) keeps running while one is open.
+ *
+ * @param title Title of the dialog
+ * @param app_data The application data (parent window, passed to on_response)
+ * @param slot Where the dialog is cached, cleared if the dialog is destroyed
+ * @param on_response Handler of the "response" signal
+ * @return GtkWidget* the new dialog, still hidden
+ */
+static GtkWidget *create_property_dialog(const gchar *title, AppData *app_data,
+                                         GtkWidget **slot, GCallback on_response)
+{
+    GtkWidget *dialog = gtk_dialog_new_with_buttons(title,
+                                                    GTK_WINDOW(app_data->window),
+                                                    GTK_DIALOG_DESTROY_WITH_PARENT,
+                                                    "OK", GTK_RESPONSE_ACCEPT,
+                                                    "Cancel", GTK_RESPONSE_CANCEL,
+                                                    NULL);
+    *slot = dialog;
+    g_signal_connect(dialog, "delete-event", G_CALLBACK(gtk_widget_hide_on_delete), NULL);
+    g_signal_connect(dialog, "destroy", G_CALLBACK(gtk_widget_destroyed), slot);
+    g_signal_connect(dialog, "response", on_response, app_data);
+    return dialog;
+}
+
+// Remember the form fields of a dialog: NULL-terminated list of key, widget pairs
+static void set_dialog_fields(GtkWidget *dialog, const gchar *first_key, ...)
+{
+    va_list args;
+    va_start(args, first_key);
+    for (const gchar *key = first_key; key != NULL; key = va_arg(args, const gchar *))
+        g_object_set_data(G_OBJECT(dialog), key, va_arg(args, GtkWidget *));
+    va_end(args);
+}
+
+// A form field stored by set_dialog_fields
+static GtkWidget *dialog_field(gpointer dialog, const gchar *key)
+{
+    return GTK_WIDGET(g_object_get_data(G_OBJECT(dialog), key));
+}
+
+// Helpers used to put a form back to its default values
+static void reset_dialog_entry(GtkWidget *dialog, const gchar *key, const gchar *text)
+{
+    gtk_entry_set_text(GTK_ENTRY(dialog_field(dialog, key)), text);
+}
+
+static void reset_dialog_check(GtkWidget *dialog, const gchar *key, gboolean active)
+{
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(dialog_field(dialog, key)), active);
+}
+
+static void reset_dialog_color(GtkWidget *dialog, const gchar *key, gdouble red, gdouble green, gdouble blue)
+{
+    GdkRGBA color = {red, green, blue, 1.0};
+    gtk_color_chooser_set_rgba(GTK_COLOR_CHOOSER(dialog_field(dialog, key)), &color);
+}
+
+static void reset_dialog_container(GtkWidget *dialog, AppData *app_data)
+{
+    select_current_container(GTK_COMBO_BOX(dialog_field(dialog, "container_combo")), app_data);
+}
+
 /**
  * @brief Creer un choix, contenant un combobox et un label
  * @param label Le label à donnée au choix (exemple: color, texte...)
@@ -54,214 +120,53 @@ GtkWidget *inputCombo(char *label, coordonnees *cord, GtkWidget *container, char
 // Function to show properties dialog
 static void show_properties_dialog(GtkWidget *widget, gpointer data)
 {
-    GtkWidget *dialog, *content_area, *label;
-    GtkDialogFlags flags = GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT;
-
-    dialog = gtk_dialog_new_with_buttons("Widget Properties",
-                                         GTK_WINDOW(data),
-                                         flags,
-                                         "_OK",
-                                         GTK_RESPONSE_OK,
-                                         "_Cancel",
-                                         GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-    label = gtk_label_new("Enter properties for the widget:");
-    gtk_container_add(GTK_CONTAINER(content_area), label);
-
-    gtk_widget_show_all(dialog);
-    gtk_dialog_run(GTK_DIALOG(dialog));
-    gtk_widget_destroy(dialog);
-}
-
-// Functions for buttons
-static void show_properties_dialog_btn_normal(AppData *app_data)
-{
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-    GtkWidget *name_label, *label_label, *tooltip_label;
-    GtkWidget *name_entry, *label_entry, *tooltip_entry;
-    GtkWidget *x_label, *y_label, *width_label, *height_label;
-    GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
-    GtkWidget *image_path_label, *image_path_entry;
-    GtkWidget *has_mnemonic_check;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Normal Button Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+    static GtkWidget *dialog = NULL;
+    GtkWidget *content_area, *label;
 
-    // Add container selection at the top of the dialog
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-    // Add default option (preview area)
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
-
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
+    if (dialog == NULL)
     {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
+        dialog = gtk_dialog_new_with_buttons("Widget Properties",
+                                             GTK_WINDOW(data),
+                                             GTK_DIALOG_DESTROY_WITH_PARENT,
+                                             "_OK",
+                                             GTK_RESPONSE_OK,
+                                             "_Cancel",
+                                             GTK_RESPONSE_CANCEL,
+                                             NULL);
+        g_signal_connect(dialog, "delete-event", G_CALLBACK(gtk_widget_hide_on_delete), NULL);
+        g_signal_connect(dialog, "destroy", G_CALLBACK(gtk_widget_destroyed), &dialog);
+        g_signal_connect(dialog, "response", G_CALLBACK(gtk_widget_hide), NULL);
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+        label = gtk_label_new("Enter properties for the widget:");
+        gtk_container_add(GTK_CONTAINER(content_area), label);
+        gtk_widget_show(label);
     }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
-
-    // Button identification fields
-    name_label = gtk_label_new("Button Name:");
-    name_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(name_entry), generate_unique_id());
-
-    label_label = gtk_label_new("Button Label:");
-    label_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(label_entry), "Click Me");
-
-    tooltip_label = gtk_label_new("Tooltip Text:");
-    tooltip_entry = gtk_entry_new();
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "10");
-
-    // Size fields
-    width_label = gtk_label_new("Width:");
-    height_label = gtk_label_new("Height:");
-    width_entry = gtk_entry_new();
-    height_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(width_entry), "120");
-    gtk_entry_set_text(GTK_ENTRY(height_entry), "40");
-
-    // Image path field
-    image_path_label = gtk_label_new("Image Path (optional):");
-    image_path_entry = gtk_entry_new();
-
-    // Mnemonic option
-    has_mnemonic_check = gtk_check_button_new_with_label("Has Mnemonic (_X for shortcuts)");
-    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(has_mnemonic_check), TRUE);
-    // Style fields
-    GtkWidget *police_label = gtk_label_new("Font:");
-    GtkWidget *police_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(police_entry), "Sans");
-
-    GtkWidget *color_label = gtk_label_new("Text Color:");
-    GtkWidget *color_button = gtk_color_button_new();
-    // Set initial color to black
-    GdkRGBA color_black = {0, 0, 0, 1.0};
-    gtk_color_chooser_set_rgba(GTK_COLOR_CHOOSER(color_button), &color_black);
-
-    GtkWidget *taille_label = gtk_label_new("Font Size:");
-    GtkWidget *taille_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(taille_entry), "12");
-
-    GtkWidget *gras_check = gtk_check_button_new_with_label("Bold");
-
-    GtkWidget *bgcolor_label = gtk_label_new("Background Color:");
-    GtkWidget *bgcolor_button = gtk_color_button_new();
-    // Set initial color to white
-    GdkRGBA color_white = {1.0, 1.0, 1.0, 1.0};
-    gtk_color_chooser_set_rgba(GTK_COLOR_CHOOSER(bgcolor_button), &color_white);
-
-    // Add widgets to grid
-    int row = 0;
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), label_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), label_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), width_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), width_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), height_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), image_path_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), image_path_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), has_mnemonic_check, 0, row, 2, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), police_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), police_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), color_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), color_button, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), taille_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), taille_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), gras_check, 0, row, 2, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), bgcolor_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), bgcolor_button, 1, row, 1, 1);
-    row++;
-
-    GtkWidget *callbacks_label = gtk_label_new("Callback");
-    gchar *callbacks_array[] = {"Change Label", "Open Dialog", NULL};
-    GtkWidget *callbacks_combo = inputCombo("Callbacks", cord(0, 0), grid, callbacks_array, 1);
-    gtk_grid_attach(GTK_GRID(grid), callbacks_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), callbacks_combo, 1, row, 1, 1);
-    row++;
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
 
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
+static void on_btn_normal_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
+{
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *name_entry = dialog_field(dialog, "name_entry");
+        GtkWidget *label_entry = dialog_field(dialog, "label_entry");
+        GtkWidget *tooltip_entry = dialog_field(dialog, "tooltip_entry");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *width_entry = dialog_field(dialog, "width_entry");
+        GtkWidget *height_entry = dialog_field(dialog, "height_entry");
+        GtkWidget *image_path_entry = dialog_field(dialog, "image_path_entry");
+        GtkWidget *has_mnemonic_check = dialog_field(dialog, "has_mnemonic_check");
+        GtkWidget *police_entry = dialog_field(dialog, "police_entry");
+        GtkWidget *color_button = dialog_field(dialog, "color_button");
+        GtkWidget *taille_entry = dialog_field(dialog, "taille_entry");
+        GtkWidget *gras_check = dialog_field(dialog, "gras_check");
+        GtkWidget *bgcolor_button = dialog_field(dialog, "bgcolor_button");
+        GtkWidget *callbacks_combo = dialog_field(dialog, "callbacks_combo");
+
         // Get values from form
         const gchar *name = gtk_entry_get_text(GTK_ENTRY(name_entry));
         const gchar *label_text = gtk_entry_get_text(GTK_ENTRY(label_entry));
@@ -296,16 +201,7 @@ static void show_properties_dialog_btn_normal(AppData *app_data)
                 (int)(bgcolor_value.blue * 255));
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // get callback name
         gchar *callbac_char = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(callbacks_combo));
@@ -340,21 +236,210 @@ static void show_properties_dialog_btn_normal(AppData *app_data)
             btn *created_button = creer_button(button);
 
             // Apply a default style
-            Style *default_style = init_style(police, hex_color_init(color), taille, is_gras, bgcolor, 1, 5);
-            appliquer_style_button(default_style, created_button);
-            copy_style_to_btn(created_button, default_style);
+            HexColor default_color = hex_color_valeur(color);
+            Style default_style = style_valeur(police, &default_color, taille, is_gras, bgcolor, 1, 5);
+            appliquer_style_button(&default_style, created_button);
             // register_widget_for_property_editing(button->button, app_data);(replaced by line below)
             g_signal_connect(button->button, "button-press-event", G_CALLBACK(on_widget_button_press_select), app_data);
 
             // Add the widget to hierarchy trees
             add_widget_to_both_trees(app_data, created_button->button, "Button", target_container, TRUE, created_button);
 
-            // Show all widgets
-            gtk_widget_show_all(app_data->preview_area);
+            // Show the new widgets
+            afficher_en_attente();
         }
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
+}
+
+// Functions for buttons
+static void show_properties_dialog_btn_normal(AppData *app_data)
+{
+    static GtkWidget *dialog = NULL;
+
+    if (dialog == NULL)
+    {
+        GtkWidget *content_area;
+        GtkWidget *grid;
+        GtkWidget *name_label, *label_label, *tooltip_label;
+        GtkWidget *name_entry, *label_entry, *tooltip_entry;
+        GtkWidget *x_label, *y_label, *width_label, *height_label;
+        GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
+        GtkWidget *image_path_label, *image_path_entry;
+        GtkWidget *has_mnemonic_check;
+
+        // Create dialog
+        create_property_dialog("Normal Button Properties", app_data, &dialog,
+                               G_CALLBACK(on_btn_normal_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection at the top of the dialog
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Button identification fields
+        name_label = gtk_label_new("Button Name:");
+        name_entry = gtk_entry_new();
+
+        label_label = gtk_label_new("Button Label:");
+        label_entry = gtk_entry_new();
+
+        tooltip_label = gtk_label_new("Tooltip Text:");
+        tooltip_entry = gtk_entry_new();
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Size fields
+        width_label = gtk_label_new("Width:");
+        height_label = gtk_label_new("Height:");
+        width_entry = gtk_entry_new();
+        height_entry = gtk_entry_new();
+
+        // Image path field
+        image_path_label = gtk_label_new("Image Path (optional):");
+        image_path_entry = gtk_entry_new();
+
+        // Mnemonic option
+        has_mnemonic_check = gtk_check_button_new_with_label("Has Mnemonic (_X for shortcuts)");
+        // Style fields
+        GtkWidget *police_label = gtk_label_new("Font:");
+        GtkWidget *police_entry = gtk_entry_new();
+
+        GtkWidget *color_label = gtk_label_new("Text Color:");
+        GtkWidget *color_button = gtk_color_button_new();
+
+        GtkWidget *taille_label = gtk_label_new("Font Size:");
+        GtkWidget *taille_entry = gtk_entry_new();
+
+        GtkWidget *gras_check = gtk_check_button_new_with_label("Bold");
+
+        GtkWidget *bgcolor_label = gtk_label_new("Background Color:");
+        GtkWidget *bgcolor_button = gtk_color_button_new();
+
+        // Add widgets to grid
+        int row = 0;
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), label_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), label_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), width_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), width_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), height_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), image_path_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), image_path_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), has_mnemonic_check, 0, row, 2, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), police_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), police_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), color_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), color_button, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), taille_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), taille_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), gras_check, 0, row, 2, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), bgcolor_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), bgcolor_button, 1, row, 1, 1);
+        row++;
+
+        GtkWidget *callbacks_label = gtk_label_new("Callback");
+        gchar *callbacks_array[] = {"Change Label", "Open Dialog", NULL};
+        GtkWidget *callbacks_combo = inputCombo("Callbacks", cord(0, 0), grid, callbacks_array, 1);
+        gtk_grid_attach(GTK_GRID(grid), callbacks_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), callbacks_combo, 1, row, 1, 1);
+        row++;
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "name_entry", name_entry,
+                          "label_entry", label_entry,
+                          "tooltip_entry", tooltip_entry,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "width_entry", width_entry,
+                          "height_entry", height_entry,
+                          "image_path_entry", image_path_entry,
+                          "has_mnemonic_check", has_mnemonic_check,
+                          "police_entry", police_entry,
+                          "color_button", color_button,
+                          "taille_entry", taille_entry,
+                          "gras_check", gras_check,
+                          "bgcolor_button", bgcolor_button,
+                          "callbacks_combo", callbacks_combo,
+                          NULL);
+    }
+
+    // Reset the form
+    gchar *unique_id = generate_unique_id();
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "name_entry", unique_id);
+    reset_dialog_entry(dialog, "label_entry", "Click Me");
+    reset_dialog_entry(dialog, "tooltip_entry", "");
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "10");
+    reset_dialog_entry(dialog, "width_entry", "120");
+    reset_dialog_entry(dialog, "height_entry", "40");
+    reset_dialog_entry(dialog, "image_path_entry", "");
+    reset_dialog_check(dialog, "has_mnemonic_check", TRUE);
+    reset_dialog_entry(dialog, "police_entry", "Sans");
+    reset_dialog_color(dialog, "color_button", 0, 0, 0);
+    reset_dialog_entry(dialog, "taille_entry", "12");
+    reset_dialog_check(dialog, "gras_check", FALSE);
+    reset_dialog_color(dialog, "bgcolor_button", 1.0, 1.0, 1.0);
+    gtk_combo_box_set_active(GTK_COMBO_BOX(dialog_field(dialog, "callbacks_combo")), 1);
+    g_free(unique_id);
+
+    gtk_window_present(GTK_WINDOW(dialog));
 }
 
 // Function to show properties dialog for TextView
@@ -456,110 +541,17 @@ void show_properties_dialog_textview(AppData *app_data, GtkWidget *widget)
     gtk_widget_set_sensitive(app_data->remove_button, TRUE);
 }
 
-//  Function to show dialog for creating a TextView
-// Function to show dialog for creating a TextView
-void show_create_textview_dialog(GtkWidget *button, gpointer user_data)
+static void on_textview_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
 {
-    AppData *app_data = (AppData *)user_data;
-
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-    GtkWidget *text_label, *text_view, *text_scroll;
-    GtkWidget *x_label, *y_label, *width_label, *height_label;
-    GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("TextView Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
-
-    // Add container selection at the top of the dialog
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-
-    // Add default option (preview area)
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
-
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
-    {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
-    }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
-
-    // Add container selection to the top of the form
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, 0, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, 0, 1, 1);
-
-    // Text content
-    text_label = gtk_label_new("Text Content:");
-    text_view = gtk_text_view_new();
-    text_scroll = gtk_scrolled_window_new(NULL, NULL);
-    gtk_scrolled_window_set_min_content_height(GTK_SCROLLED_WINDOW(text_scroll), 100);
-    gtk_container_add(GTK_CONTAINER(text_scroll), text_view);
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "10");
-
-    // Size fields
-    width_label = gtk_label_new("Width:");
-    height_label = gtk_label_new("Height:");
-    width_entry = gtk_entry_new();
-    height_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(width_entry), "150");
-    gtk_entry_set_text(GTK_ENTRY(height_entry), "100");
-
-    // Add widgets to grid
-    gtk_grid_attach(GTK_GRID(grid), text_label, 0, 1, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), text_scroll, 1, 1, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, 2, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, 2, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, 3, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, 3, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), width_label, 0, 4, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), width_entry, 1, 4, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_label, 0, 5, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_entry, 1, 5, 1, 1);
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
-
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
-
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *text_view = dialog_field(dialog, "text_view");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *width_entry = dialog_field(dialog, "width_entry");
+        GtkWidget *height_entry = dialog_field(dialog, "height_entry");
+
         // Get text from text view
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(text_view));
         GtkTextIter start, end;
@@ -574,17 +566,7 @@ void show_create_textview_dialog(GtkWidget *button, gpointer user_data)
         gint height = atoi(gtk_entry_get_text(GTK_ENTRY(height_entry)));
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // Create TextView with the selected container
         coordonnees pos = {x, y};
@@ -607,149 +589,122 @@ void show_create_textview_dialog(GtkWidget *button, gpointer user_data)
         // update_hierarchy_view(app_data);
         // update_xml_display(app_data);
 
-        // Show all widgets
-        gtk_widget_show_all(app_data->preview_area);
+        // Show the new widgets
+        afficher_en_attente();
 
         // Clean up
         g_free(text_content);
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
 }
 
-static void show_properties_dialog_btn_radio(AppData *app_data)
+// Function to show dialog for creating a TextView
+void show_create_textview_dialog(GtkWidget *button, gpointer user_data)
 {
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid, *gras_check;
-    GtkWidget *taille_label, *color_label, *police_label, *labels, *labels_entry;
-    GtkWidget *taille_entry, *color_entry, *police_entry;
-    GtkWidget *x_label, *y_label, *width_label, *height_label;
-    GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
-    GtkWidget *group_label, *group_combo;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Radio Button Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
-
-    // Add container selection at the top of the dialog
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-
-    // Add default option (preview area)
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
+    AppData *app_data = (AppData *)user_data;
+    static GtkWidget *dialog = NULL;
 
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
+    if (dialog == NULL)
     {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
+        GtkWidget *content_area;
+        GtkWidget *grid;
+        GtkWidget *text_label, *text_view, *text_scroll;
+        GtkWidget *x_label, *y_label, *width_label, *height_label;
+        GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
+
+        // Create dialog
+        create_property_dialog("TextView Properties", app_data, &dialog,
+                               G_CALLBACK(on_textview_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection at the top of the dialog
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Add container selection to the top of the form
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, 0, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, 0, 1, 1);
+
+        // Text content
+        text_label = gtk_label_new("Text Content:");
+        text_view = gtk_text_view_new();
+        text_scroll = gtk_scrolled_window_new(NULL, NULL);
+        gtk_scrolled_window_set_min_content_height(GTK_SCROLLED_WINDOW(text_scroll), 100);
+        gtk_container_add(GTK_CONTAINER(text_scroll), text_view);
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Size fields
+        width_label = gtk_label_new("Width:");
+        height_label = gtk_label_new("Height:");
+        width_entry = gtk_entry_new();
+        height_entry = gtk_entry_new();
+
+        // Add widgets to grid
+        gtk_grid_attach(GTK_GRID(grid), text_label, 0, 1, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), text_scroll, 1, 1, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, 2, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, 2, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, 3, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, 3, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), width_label, 0, 4, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), width_entry, 1, 4, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_label, 0, 5, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_entry, 1, 5, 1, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "text_view", text_view,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "width_entry", width_entry,
+                          "height_entry", height_entry,
+                          NULL);
     }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
-
-    labels = gtk_label_new("Labels:");
-    labels_entry = gtk_entry_new();
-    // gtk_entry_set_text(GTK_ENTRY(name_entry), "radio1");
 
-    // // Button identification fields
-    police_label = gtk_label_new("Buttons police:");
-    police_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(police_entry), "Sans");
+    // Reset the form
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(dialog_field(dialog, "text_view")));
+    gtk_text_buffer_set_text(buffer, "", -1);
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "10");
+    reset_dialog_entry(dialog, "width_entry", "150");
+    reset_dialog_entry(dialog, "height_entry", "100");
 
-    color_label = gtk_label_new("Buttons color:");
-    color_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(color_entry), "#000");
-
-    taille_label = gtk_label_new("Buttons taille:");
-    taille_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(taille_entry), "12");
-
-    gras_check = gtk_check_button_new_with_label("Gras");
-
-    // tooltip_label = gtk_label_new("Tooltip Text:");
-    // tooltip_entry = gtk_entry_new();
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "20");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "150");
-
-    // Group selection
-    // group_label = gtk_label_new("Group:");
-    // group_combo = gtk_combo_box_text_new();
-    // gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(group_combo), "None");
-    // for (iter = app_data->radio_groups; iter != NULL; iter = iter->next) {
-    //     const gchar *group_name = (const gchar *)iter->data;
-    //     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(group_combo), group_name);
-    // }
-    // gtk_combo_box_set_active(GTK_COMBO_BOX(group_combo), 0);
-
-    // Add widgets to grid
-    int row = 0;
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), taille_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), taille_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), color_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), color_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), police_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), police_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
-    row++;
-    //
-    gtk_grid_attach(GTK_GRID(grid), labels, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), labels_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), gras_check, 0, row, 2, 1);
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
-
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
+static void on_btn_radio_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
+{
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *labels_entry = dialog_field(dialog, "labels_entry");
+        GtkWidget *police_entry = dialog_field(dialog, "police_entry");
+        GtkWidget *color_entry = dialog_field(dialog, "color_entry");
+        GtkWidget *taille_entry = dialog_field(dialog, "taille_entry");
+        GtkWidget *gras_check = dialog_field(dialog, "gras_check");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+
         // Get values from form
         const gchar *police_text = gtk_entry_get_text(GTK_ENTRY(police_entry));
         const int taille_int = atoi(gtk_entry_get_text(GTK_ENTRY(taille_entry)));
@@ -764,32 +719,19 @@ static void show_properties_dialog_btn_radio(AppData *app_data)
         //
         char *labels_text = gtk_entry_get_text(GTK_ENTRY(labels_entry));
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // gchar *police, HexColor *color, gint taille, gint gras, char *bgcolor, int border, int border_radius
         // creer le style
-        Style *default_style = init_style(police_text, hex_color_init(color_text), taille_int, is_gras, NULL, 0, 0);
+        HexColor default_color = hex_color_valeur(color_text);
+        Style default_style = style_valeur(police_text, &default_color, taille_int, is_gras, NULL, 0, 0);
         // creer le box des boutons
         StyledBox *bx = init_styled_box(0, 1, 8, "", "", "", "", cord(x, y), dim(100, 200), target_container);
         create_styled_box(bx);
         // convertir les labels en un tableau de chaines
         gchar **array = g_strsplit(labels_text, " ", -1); // Split by space
         // creer les radios
-        btn **liste = liste_radios(array, default_style, bx);
-        gtk_widget_show_all(bx->widget);
-
-        // Show all widgets
-        gtk_widget_show_all(app_data->preview_area);
+        btn **liste = liste_radios(array, &default_style, bx);
 
         // Add the box (radioList) to both trees
         add_widget_to_both_trees(app_data, bx->widget, "radioList", bx->container, TRUE, bx);
@@ -801,13 +743,138 @@ static void show_properties_dialog_btn_radio(AppData *app_data)
                 add_widget_to_both_trees(app_data, liste[i]->button, "radio", bx->widget, FALSE, liste[i]);
             }
         }
+
+        // Show the new widgets (the box and its radios in one pass)
+        afficher_en_attente();
         // }
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
+}
+
+static void show_properties_dialog_btn_radio(AppData *app_data)
+{
+    static GtkWidget *dialog = NULL;
+
+    if (dialog == NULL)
+    {
+        GtkWidget *content_area;
+        GtkWidget *grid, *gras_check;
+        GtkWidget *taille_label, *color_label, *police_label, *labels, *labels_entry;
+        GtkWidget *taille_entry, *color_entry, *police_entry;
+        GtkWidget *x_label, *y_label;
+        GtkWidget *x_entry, *y_entry;
+
+        // Create dialog
+        create_property_dialog("Radio Button Properties", app_data, &dialog,
+                               G_CALLBACK(on_btn_radio_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection at the top of the dialog
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        labels = gtk_label_new("Labels:");
+        labels_entry = gtk_entry_new();
+
+        // // Button identification fields
+        police_label = gtk_label_new("Buttons police:");
+        police_entry = gtk_entry_new();
+
+        color_label = gtk_label_new("Buttons color:");
+        color_entry = gtk_entry_new();
+
+        taille_label = gtk_label_new("Buttons taille:");
+        taille_entry = gtk_entry_new();
+
+        gras_check = gtk_check_button_new_with_label("Gras");
+
+        // tooltip_label = gtk_label_new("Tooltip Text:");
+        // tooltip_entry = gtk_entry_new();
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Group selection
+        // group_label = gtk_label_new("Group:");
+        // group_combo = gtk_combo_box_text_new();
+        // gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(group_combo), "None");
+        // for (iter = app_data->radio_groups; iter != NULL; iter = iter->next) {
+        //     const gchar *group_name = (const gchar *)iter->data;
+        //     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(group_combo), group_name);
+        // }
+        // gtk_combo_box_set_active(GTK_COMBO_BOX(group_combo), 0);
+
+        // Add widgets to grid
+        int row = 0;
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), taille_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), taille_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), color_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), color_entry, 1, row, 1, 1);
+        row++;
 
-    // c
-};
+        gtk_grid_attach(GTK_GRID(grid), police_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), police_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
+        row++;
+        //
+        gtk_grid_attach(GTK_GRID(grid), labels, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), labels_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), gras_check, 0, row, 2, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "labels_entry", labels_entry,
+                          "police_entry", police_entry,
+                          "color_entry", color_entry,
+                          "taille_entry", taille_entry,
+                          "gras_check", gras_check,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          NULL);
+    }
+
+    // Reset the form
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "labels_entry", "");
+    reset_dialog_entry(dialog, "police_entry", "Sans");
+    reset_dialog_entry(dialog, "color_entry", "#000");
+    reset_dialog_entry(dialog, "taille_entry", "12");
+    reset_dialog_check(dialog, "gras_check", FALSE);
+    reset_dialog_entry(dialog, "x_entry", "20");
+    reset_dialog_entry(dialog, "y_entry", "150");
+
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
 // static void on_browse_image_clicked(GtkButton *button, gpointer user_data)
 // {
@@ -840,113 +907,17 @@ static void show_properties_dialog_btn_radio(AppData *app_data)
 //     gtk_widget_destroy(dialog);
 // }
 
-static void show_image_dialog(AppData *app_data)
+static void on_image_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
 {
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-    GtkWidget *x_label, *y_label, *width_label, *height_label;
-    GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
-    GtkWidget *path_label, *path_entry;
-    gint response;
-
-    // Création du dialogue
-    dialog = gtk_dialog_new_with_buttons("Image Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-
-    // Création de la grille
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
-
-    // Sélection du conteneur
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Ajout des conteneurs disponibles
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
-
-    // Sélection du conteneur actif
-    gint active_index = 0;
-    if (app_data->selected_container)
-    {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
-    }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
-
-    // Ajout des widgets à la grille
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, 0, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, 0, 1, 1);
-
-    // Chemin de l'image
-    path_label = gtk_label_new("Image Path:");
-    path_entry = gtk_entry_new();
-
-    // Create a button for file selection
-    GtkWidget *browse_button = gtk_button_new_with_label("Browse...");
-
-    GtkWidget *path_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
-    gtk_box_pack_start(GTK_BOX(path_box), path_entry, TRUE, TRUE, 0);
-    gtk_box_pack_start(GTK_BOX(path_box), browse_button, FALSE, FALSE, 0);
-
-    g_signal_connect(browse_button, "clicked", G_CALLBACK(on_browse_image_clicked), path_entry);
-
-    // Champs de position
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "10");
-
-    // Champs de taille
-    width_label = gtk_label_new("Width:");
-    height_label = gtk_label_new("Height:");
-    width_entry = gtk_entry_new();
-    height_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(width_entry), "150");
-    gtk_entry_set_text(GTK_ENTRY(height_entry), "30");
-
-    // Ajout des widgets à la grille
-    gtk_grid_attach(GTK_GRID(grid), path_label, 0, 1, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), path_entry, 1, 1, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), path_label, 0, 1, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), path_box, 1, 1, 1, 1);
-    // Use path_box instead of path_entry
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, 2, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, 2, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, 3, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, 3, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), width_label, 0, 4, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), width_entry, 1, 4, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_label, 0, 5, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_entry, 1, 5, 1, 1);
-
-    // Ajout de la grille au dialogue
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
-
-    // Exécution du dialogue
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
-
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *path_entry = dialog_field(dialog, "path_entry");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *width_entry = dialog_field(dialog, "width_entry");
+        GtkWidget *height_entry = dialog_field(dialog, "height_entry");
+
         // Récupération des valeurs saisies
         const gchar *path1 = gtk_entry_get_text(GTK_ENTRY(path_entry));
         gchar path[300];
@@ -958,17 +929,7 @@ static void show_image_dialog(AppData *app_data)
         gint height = atoi(gtk_entry_get_text(GTK_ENTRY(height_entry)));
 
         // Sélection du conteneur
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // Création de l'image
 
@@ -981,160 +942,133 @@ static void show_image_dialog(AppData *app_data)
 
         if (image != NULL)
         {
-            g_print("dddddddd");
             GtkWidget *img = creer_image_with_editing(image, app_data);
-            gtk_widget_show_all(app_data->preview_area);
+            afficher_plus_tard(image->Image);
+            afficher_en_attente();
         }
     }
 
-    // Destruction du dialogue
-    gtk_widget_destroy(dialog);
+    // Le dialogue est seulement caché, il sera réutilisé
+    gtk_widget_hide(GTK_WIDGET(dialog));
 }
 
-// Function to handle basic entry button click
-static void add_image_clicked(GtkWidget *widget, gpointer data)
+static void show_image_dialog(AppData *app_data)
 {
-    AppData *app_data = (AppData *)data;
-    show_image_dialog(app_data);
-}
+    static GtkWidget *dialog = NULL;
 
+    if (dialog == NULL)
+    {
+        GtkWidget *content_area;
+        GtkWidget *grid;
+        GtkWidget *x_label, *y_label, *width_label, *height_label;
+        GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
+        GtkWidget *path_label, *path_entry;
 
-static void show_properties_dialog_label(GtkWidget *widget, gpointer data) {
-    AppData *app_data = (AppData *)data;
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-
-    GtkWidget *text_label, *text_entry;
-    GtkWidget *x_label, *y_label, *width_label, *height_label;
-    GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
-    GtkWidget *color_label, *color_button;
-    GtkWidget *font_label, *font_entry;
-    GtkWidget *size_label, *size_entry;
-    GtkWidget *bold_check;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Label Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+        // Création du dialogue
+        create_property_dialog("Image Properties", app_data, &dialog,
+                               G_CALLBACK(on_image_dialog_response));
 
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
 
-    // Add container selection
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next) {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
+        // Création de la grille
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
 
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container) {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
+        // Sélection du conteneur
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Ajout des widgets à la grille
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, 0, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, 0, 1, 1);
+
+        // Chemin de l'image
+        path_label = gtk_label_new("Image Path:");
+        path_entry = gtk_entry_new();
+
+        // Create a button for file selection
+        GtkWidget *browse_button = gtk_button_new_with_label("Browse...");
+
+        GtkWidget *path_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+        gtk_box_pack_start(GTK_BOX(path_box), path_entry, TRUE, TRUE, 0);
+        gtk_box_pack_start(GTK_BOX(path_box), browse_button, FALSE, FALSE, 0);
+
+        g_signal_connect(browse_button, "clicked", G_CALLBACK(on_browse_image_clicked), path_entry);
+
+        // Champs de position
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Champs de taille
+        width_label = gtk_label_new("Width:");
+        height_label = gtk_label_new("Height:");
+        width_entry = gtk_entry_new();
+        height_entry = gtk_entry_new();
+
+        // Ajout des widgets à la grille (path_entry est déjà dans path_box)
+        gtk_grid_attach(GTK_GRID(grid), path_label, 0, 1, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), path_box, 1, 1, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, 2, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, 2, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, 3, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, 3, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), width_label, 0, 4, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), width_entry, 1, 4, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_label, 0, 5, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_entry, 1, 5, 1, 1);
+
+        // Ajout de la grille au dialogue
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "path_entry", path_entry,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "width_entry", width_entry,
+                          "height_entry", height_entry,
+                          NULL);
     }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
 
-    // Label text
-    text_label = gtk_label_new("Text:");
-    text_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(text_entry), "Label Text");
+    // Remise à zéro du formulaire
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "path_entry", "");
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "10");
+    reset_dialog_entry(dialog, "width_entry", "150");
+    reset_dialog_entry(dialog, "height_entry", "30");
 
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "10");
-
-    // Size fields
-    width_label = gtk_label_new("Width:");
-    height_label = gtk_label_new("Height:");
-    width_entry = gtk_entry_new();
-    height_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(width_entry), "150");
-    gtk_entry_set_text(GTK_ENTRY(height_entry), "30");
-
-    // Style fields
-    color_label = gtk_label_new("Text Color:");
-    color_button = gtk_color_button_new();
-    GdkRGBA initial_color = {0, 0, 0, 1}; // Default to black
-    gtk_color_chooser_set_rgba(GTK_COLOR_CHOOSER(color_button), &initial_color);
-
-    font_label = gtk_label_new("Font:");
-    font_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(font_entry), "Sans");
-
-    size_label = gtk_label_new("Font Size:");
-    size_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(size_entry), "12");
-
-    bold_check = gtk_check_button_new_with_label("Bold");
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
-    // Add widgets to grid
-    int row = 0;
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), text_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), text_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), width_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), width_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), height_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), color_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), color_button, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), font_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), font_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), size_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), size_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), bold_check, 0, row, 2, 1);
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
+// Function to handle basic entry button click
+static void add_image_clicked(GtkWidget *widget, gpointer data)
+{
+    AppData *app_data = (AppData *)data;
+    show_image_dialog(app_data);
+}
 
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
 
+static void on_label_dialog_response(GtkDialog *dialog, gint response, AppData *app_data) {
     if (response == GTK_RESPONSE_ACCEPT) {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *text_entry = dialog_field(dialog, "text_entry");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *width_entry = dialog_field(dialog, "width_entry");
+        GtkWidget *height_entry = dialog_field(dialog, "height_entry");
+        GtkWidget *color_button = dialog_field(dialog, "color_button");
+        GtkWidget *font_entry = dialog_field(dialog, "font_entry");
+        GtkWidget *size_entry = dialog_field(dialog, "size_entry");
+        GtkWidget *bold_check = dialog_field(dialog, "bold_check");
+
         // Get values from form
         const gchar *text = gtk_entry_get_text(GTK_ENTRY(text_entry));
         const gchar *font = gtk_entry_get_text(GTK_ENTRY(font_entry));
@@ -1155,14 +1089,7 @@ static void show_properties_dialog_label(GtkWidget *widget, gpointer data) {
                  (int)(selected_color.blue * 255));
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0) {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        } else {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // Create label
         GtkWidget *label = gtk_label_new(text);
@@ -1194,129 +1121,163 @@ static void show_properties_dialog_label(GtkWidget *widget, gpointer data) {
         // Connect signals to the event box
         g_signal_connect(event_box, "button-press-event", G_CALLBACK(on_widget_button_press_select), app_data);
 
-        // Show all widgets
-        gtk_widget_show_all(app_data->preview_area);
-
         // Add widget to hierarchy trees
         add_widget_to_both_trees(app_data, event_box, "Label", target_container, TRUE, label);
+
+        // Show the new widgets
+        afficher_en_attente();
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
 }
 
-
-
-static void show_properties_dialog_btn_checkbox(GtkWidget *widget, gpointer data)
-{
+static void show_properties_dialog_label(GtkWidget *widget, gpointer data) {
     AppData *app_data = (AppData *)data;
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-    GtkWidget *name_label, *label_label, *tooltip_label;
-    GtkWidget *name_entry, *label_entry, *tooltip_entry;
-    GtkWidget *x_label, *y_label;
-    GtkWidget *x_entry, *y_entry;
-    GtkWidget *checked_check;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Checkbox Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+    static GtkWidget *dialog = NULL;
 
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
-
-    // Add container selection
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
+    if (dialog == NULL) {
+        GtkWidget *content_area;
+        GtkWidget *grid;
+
+        GtkWidget *text_label, *text_entry;
+        GtkWidget *x_label, *y_label, *width_label, *height_label;
+        GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
+        GtkWidget *color_label, *color_button;
+        GtkWidget *font_label, *font_entry;
+        GtkWidget *size_label, *size_entry;
+        GtkWidget *bold_check;
+
+        // Create dialog
+        create_property_dialog("Label Properties", app_data, &dialog,
+                               G_CALLBACK(on_label_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Label text
+        text_label = gtk_label_new("Text:");
+        text_entry = gtk_entry_new();
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Size fields
+        width_label = gtk_label_new("Width:");
+        height_label = gtk_label_new("Height:");
+        width_entry = gtk_entry_new();
+        height_entry = gtk_entry_new();
+
+        // Style fields
+        color_label = gtk_label_new("Text Color:");
+        color_button = gtk_color_button_new();
+
+        font_label = gtk_label_new("Font:");
+        font_entry = gtk_entry_new();
+
+        size_label = gtk_label_new("Font Size:");
+        size_entry = gtk_entry_new();
+
+        bold_check = gtk_check_button_new_with_label("Bold");
+
+        // Add widgets to grid
+        int row = 0;
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), text_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), text_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), width_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), width_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), height_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), color_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), color_button, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), font_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), font_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), size_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), size_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), bold_check, 0, row, 2, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "text_entry", text_entry,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "width_entry", width_entry,
+                          "height_entry", height_entry,
+                          "color_button", color_button,
+                          "font_entry", font_entry,
+                          "size_entry", size_entry,
+                          "bold_check", bold_check,
+                          NULL);
     }
 
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
-    {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
-    }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
-
-    // Button identification fields
-    name_label = gtk_label_new("Checkbox Name:");
-    name_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(name_entry), "checkbox1");
-
-    label_label = gtk_label_new("Checkbox Label:");
-    label_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(label_entry), "Check me");
-
-    tooltip_label = gtk_label_new("Tooltip Text:");
-    tooltip_entry = gtk_entry_new();
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "50");
-
-    // Checked state
-    checked_check = gtk_check_button_new_with_label("Initially Checked");
-
-    // Add widgets to grid
-    int row = 0;
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), label_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), label_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), checked_check, 0, row, 2, 1);
+    // Reset the form
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "text_entry", "Label Text");
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "10");
+    reset_dialog_entry(dialog, "width_entry", "150");
+    reset_dialog_entry(dialog, "height_entry", "30");
+    reset_dialog_color(dialog, "color_button", 0, 0, 0);
+    reset_dialog_entry(dialog, "font_entry", "Sans");
+    reset_dialog_entry(dialog, "size_entry", "12");
+    reset_dialog_check(dialog, "bold_check", FALSE);
+
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
 
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
 
+static void on_btn_checkbox_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
+{
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *name_entry = dialog_field(dialog, "name_entry");
+        GtkWidget *label_entry = dialog_field(dialog, "label_entry");
+        GtkWidget *tooltip_entry = dialog_field(dialog, "tooltip_entry");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *checked_check = dialog_field(dialog, "checked_check");
+
         // Get values from form
         const gchar *name = gtk_entry_get_text(GTK_ENTRY(name_entry));
         const gchar *label_text = gtk_entry_get_text(GTK_ENTRY(label_entry));
@@ -1326,17 +1287,7 @@ static void show_properties_dialog_btn_checkbox(GtkWidget *widget, gpointer data
         gboolean is_checked = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(checked_check));
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         btn *checkbox_button = NULL;
         if (GTK_IS_FIXED(target_container))
@@ -1370,141 +1321,133 @@ static void show_properties_dialog_btn_checkbox(GtkWidget *widget, gpointer data
             // Create the button widget with editing capabilities
             GtkWidget *created_button = create_checkbox_button_with_editing(checkbox_button, app_data);
 
-            // Show all widgets
-            gtk_widget_show_all(app_data->preview_area);
+            // Show the new widgets
+            afficher_en_attente();
         }
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
 }
 
-static void show_properties_dialog_btn_toggle(GtkWidget *widget, gpointer data)
+static void show_properties_dialog_btn_checkbox(GtkWidget *widget, gpointer data)
 {
     AppData *app_data = (AppData *)data;
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-    GtkWidget *name_label, *label_label, *tooltip_label;
-    GtkWidget *name_entry, *label_entry, *tooltip_entry;
-    GtkWidget *x_label, *y_label, *width_label, *height_label;
-    GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
-    GtkWidget *toggled_check;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Toggle Button Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+    static GtkWidget *dialog = NULL;
 
-    // Add container selection
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
+    if (dialog == NULL)
     {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
+        GtkWidget *content_area;
+        GtkWidget *grid;
+        GtkWidget *name_label, *label_label, *tooltip_label;
+        GtkWidget *name_entry, *label_entry, *tooltip_entry;
+        GtkWidget *x_label, *y_label;
+        GtkWidget *x_entry, *y_entry;
+        GtkWidget *checked_check;
+
+        // Create dialog
+        create_property_dialog("Checkbox Properties", app_data, &dialog,
+                               G_CALLBACK(on_btn_checkbox_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Button identification fields
+        name_label = gtk_label_new("Checkbox Name:");
+        name_entry = gtk_entry_new();
+
+        label_label = gtk_label_new("Checkbox Label:");
+        label_entry = gtk_entry_new();
+
+        tooltip_label = gtk_label_new("Tooltip Text:");
+        tooltip_entry = gtk_entry_new();
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Checked state
+        checked_check = gtk_check_button_new_with_label("Initially Checked");
+
+        // Add widgets to grid
+        int row = 0;
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), label_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), label_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), checked_check, 0, row, 2, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "name_entry", name_entry,
+                          "label_entry", label_entry,
+                          "tooltip_entry", tooltip_entry,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "checked_check", checked_check,
+                          NULL);
     }
 
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
-    {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
-    }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
+    // Reset the form
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "name_entry", "checkbox1");
+    reset_dialog_entry(dialog, "label_entry", "Check me");
+    reset_dialog_entry(dialog, "tooltip_entry", "");
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "50");
+    reset_dialog_check(dialog, "checked_check", FALSE);
 
-    // Button identification fields
-    name_label = gtk_label_new("Button Name:");
-    name_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(name_entry), "toggle1");
-
-    label_label = gtk_label_new("Button Label:");
-    label_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(label_entry), "Toggle Me");
-
-    tooltip_label = gtk_label_new("Tooltip Text:");
-    tooltip_entry = gtk_entry_new();
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "100");
-
-    // Size fields
-    width_label = gtk_label_new("Width:");
-    height_label = gtk_label_new("Height:");
-    width_entry = gtk_entry_new();
-    height_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(width_entry), "120");
-    gtk_entry_set_text(GTK_ENTRY(height_entry), "40");
-
-    // Toggled state
-    toggled_check = gtk_check_button_new_with_label("Initially Toggled");
-
-    // Add widgets to grid
-    int row = 0;
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), label_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), label_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), width_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), width_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), height_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), toggled_check, 0, row, 2, 1);
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
-
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
+static void on_btn_toggle_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
+{
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *name_entry = dialog_field(dialog, "name_entry");
+        GtkWidget *label_entry = dialog_field(dialog, "label_entry");
+        GtkWidget *tooltip_entry = dialog_field(dialog, "tooltip_entry");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *width_entry = dialog_field(dialog, "width_entry");
+        GtkWidget *height_entry = dialog_field(dialog, "height_entry");
+        GtkWidget *toggled_check = dialog_field(dialog, "toggled_check");
+
         // Get values from form
         const gchar *name = gtk_entry_get_text(GTK_ENTRY(name_entry));
         const gchar *label_text = gtk_entry_get_text(GTK_ENTRY(label_entry));
@@ -1516,17 +1459,7 @@ static void show_properties_dialog_btn_toggle(GtkWidget *widget, gpointer data)
         gboolean is_toggled = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(toggled_check));
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // Create toggle button
         btn *toggle_button = btnToggleFixed(
@@ -1547,155 +1480,152 @@ static void show_properties_dialog_btn_toggle(GtkWidget *widget, gpointer data)
             // Create the button widget with editing capabilities
             GtkWidget *created_button = create_toggle_button_with_editing(toggle_button, app_data);
 
-            // Show all widgets
-            gtk_widget_show_all(app_data->preview_area);
+            // Show the new widgets
+            afficher_en_attente();
         }
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
 }
 
-static void show_properties_dialog_btn_spin(GtkWidget *widget, gpointer data)
+static void show_properties_dialog_btn_toggle(GtkWidget *widget, gpointer data)
 {
     AppData *app_data = (AppData *)data;
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-    GtkWidget *name_label, *tooltip_label;
-    GtkWidget *name_entry, *tooltip_entry;
-    GtkWidget *x_label, *y_label;
-    GtkWidget *x_entry, *y_entry;
-    GtkWidget *min_label, *max_label, *step_label, *digits_label, *value_label;
-    GtkWidget *min_entry, *max_entry, *step_entry, *digits_entry, *value_entry;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Spin Button Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
-
-    // Add container selection
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
+    static GtkWidget *dialog = NULL;
 
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
+    if (dialog == NULL)
     {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
+        GtkWidget *content_area;
+        GtkWidget *grid;
+        GtkWidget *name_label, *label_label, *tooltip_label;
+        GtkWidget *name_entry, *label_entry, *tooltip_entry;
+        GtkWidget *x_label, *y_label, *width_label, *height_label;
+        GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
+        GtkWidget *toggled_check;
+
+        // Create dialog
+        create_property_dialog("Toggle Button Properties", app_data, &dialog,
+                               G_CALLBACK(on_btn_toggle_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Button identification fields
+        name_label = gtk_label_new("Button Name:");
+        name_entry = gtk_entry_new();
+
+        label_label = gtk_label_new("Button Label:");
+        label_entry = gtk_entry_new();
+
+        tooltip_label = gtk_label_new("Tooltip Text:");
+        tooltip_entry = gtk_entry_new();
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Size fields
+        width_label = gtk_label_new("Width:");
+        height_label = gtk_label_new("Height:");
+        width_entry = gtk_entry_new();
+        height_entry = gtk_entry_new();
+
+        // Toggled state
+        toggled_check = gtk_check_button_new_with_label("Initially Toggled");
+
+        // Add widgets to grid
+        int row = 0;
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), label_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), label_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), width_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), width_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), height_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), toggled_check, 0, row, 2, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "name_entry", name_entry,
+                          "label_entry", label_entry,
+                          "tooltip_entry", tooltip_entry,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "width_entry", width_entry,
+                          "height_entry", height_entry,
+                          "toggled_check", toggled_check,
+                          NULL);
     }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
 
-    // Button identification fields
-    name_label = gtk_label_new("Spin Button Name:");
-    name_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(name_entry), "spin1");
-
-    tooltip_label = gtk_label_new("Tooltip Text:");
-    tooltip_entry = gtk_entry_new();
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "150");
-
-    // Spin button properties
-    min_label = gtk_label_new("Minimum Value:");
-    max_label = gtk_label_new("Maximum Value:");
-    step_label = gtk_label_new("Step Increment:");
-    digits_label = gtk_label_new("Digits (Decimals):");
-    value_label = gtk_label_new("Initial Value:");
-
-    min_entry = gtk_entry_new();
-    max_entry = gtk_entry_new();
-    step_entry = gtk_entry_new();
-    digits_entry = gtk_entry_new();
-    value_entry = gtk_entry_new();
-
-    gtk_entry_set_text(GTK_ENTRY(min_entry), "0");
-    gtk_entry_set_text(GTK_ENTRY(max_entry), "100");
-    gtk_entry_set_text(GTK_ENTRY(step_entry), "1");
-    gtk_entry_set_text(GTK_ENTRY(digits_entry), "0");
-    gtk_entry_set_text(GTK_ENTRY(value_entry), "0");
-
-    // Add widgets to grid
-    int row = 0;
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), min_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), min_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), max_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), max_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), step_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), step_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), digits_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), digits_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), value_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), value_entry, 1, row, 1, 1);
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
-
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
+    // Reset the form
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "name_entry", "toggle1");
+    reset_dialog_entry(dialog, "label_entry", "Toggle Me");
+    reset_dialog_entry(dialog, "tooltip_entry", "");
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "100");
+    reset_dialog_entry(dialog, "width_entry", "120");
+    reset_dialog_entry(dialog, "height_entry", "40");
+    reset_dialog_check(dialog, "toggled_check", FALSE);
+
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
+static void on_btn_spin_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
+{
     if (response == GTK_RESPONSE_ACCEPT)
     {
-        for (int i = 0; i < 10; i++)
-        {
-            g_print("asdhvasjbdahsdvadj");
-        }
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *name_entry = dialog_field(dialog, "name_entry");
+        GtkWidget *tooltip_entry = dialog_field(dialog, "tooltip_entry");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *min_entry = dialog_field(dialog, "min_entry");
+        GtkWidget *max_entry = dialog_field(dialog, "max_entry");
+        GtkWidget *step_entry = dialog_field(dialog, "step_entry");
+        GtkWidget *digits_entry = dialog_field(dialog, "digits_entry");
+        GtkWidget *value_entry = dialog_field(dialog, "value_entry");
+
         // Get values from form
         const gchar *name = gtk_entry_get_text(GTK_ENTRY(name_entry));
         const gchar *tooltip = gtk_entry_get_text(GTK_ENTRY(tooltip_entry));
@@ -1708,84 +1638,184 @@ static void show_properties_dialog_btn_spin(GtkWidget *widget, gpointer data)
         gdouble initial_value = g_strtod(gtk_entry_get_text(GTK_ENTRY(value_entry)), NULL);
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
+        TRACER(TRACE_AFFICHAGE, TRACE_DEBUG, "spin button container: %s", gtk_widget_get_name(target_container));
+
+        // Create spin object (copied into the button)
+        spinObj spin_params = {initial_value, min_value, max_value, step_value, digits};
+        spinObj *sp = &spin_params;
 
-        if (container_index > 0)
+        // Create spin button
+        btn *spin_button = NULL;
+        if (GTK_IS_FIXED(target_container))
         {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
+            spin_button = btnSpinFixed(
+                (gchar *)name,    // Button name
+                "",               // Label (not used for spin button)
+                (gchar *)tooltip, // Tooltip
+                dim(80, 30),      // Dimension
+                cord(x, y),       // Position
+                target_container, // Container
+                sp                // Spin object
+            );
         }
         else
         {
-            target_container = app_data->preview_area;
+            spin_button = btnSpin(
+                (gchar *)name,    // Button name
+                "",               // Label (not used for spin button)
+                (gchar *)tooltip, // Tooltip
+                // dim(80, 30),              // Dimension
+                // cord(x, y),               // Position
+                NULL,
+                target_container, // Container
+                sp                // Spin object
+            );
         }
-        // print the targed container for debug
-        g_print("Container: %s\n", gtk_widget_get_name(target_container));
 
-        // Create spin object
-        spinObj *sp = (spinObj *)malloc(sizeof(spinObj));
-        if (sp)
+        if (spin_button != NULL)
         {
+            // Create the button widget with editing capabilities
+            GtkWidget *created_button = create_spin_button_with_editing(spin_button, app_data);
 
-            sp->borneInf = min_value;
-            sp->borneSup = max_value;
-            sp->step = step_value;
-            sp->digits = digits;
-            sp->start = initial_value;
-
-            // Create spin button
-            // print then selected container for debug
-            // g_print("Container: jhasvfajsdاتشريلاشتسيارتشساي %s\n", gtk_widget_get_name(target_container));
-            // g_print("");
-            btn *spin_button = NULL;
-            if (GTK_IS_FIXED(target_container))
-            {
-                g_print("Fixed container\n");
-                spin_button = btnSpinFixed(
-                    (gchar *)name,    // Button name
-                    "",               // Label (not used for spin button)
-                    (gchar *)tooltip, // Tooltip
-                    dim(80, 30),      // Dimension
-                    cord(x, y),       // Position
-                    target_container, // Container
-                    sp                // Spin object
-                );
-            }
-            else
-            {
-                spin_button = btnSpin(
-                    (gchar *)name,    // Button name
-                    "",               // Label (not used for spin button)
-                    (gchar *)tooltip, // Tooltip
-                    // dim(80, 30),              // Dimension
-                    // cord(x, y),               // Position
-                    NULL,
-                    target_container, // Container
-                    sp                // Spin object
-                );
-            }
-            // btn *spin_button = btnSpinFixed(
-            //     (gchar*)name,             // Button name
-            //     "",                       // Label (not used for spin button)
-            //     (gchar*)tooltip,          // Tooltip
-            //     dim(80, 30),              // Dimension
-            //     cord(x, y),               // Position
-            //     target_container,         // Container
-            //     sp                        // Spin object
-            // );
-
-            if (spin_button != NULL)
-            {
-                // Create the button widget with editing capabilities
-                GtkWidget *created_button = create_spin_button_with_editing(spin_button, app_data);
-
-                // Show all widgets
-                gtk_widget_show_all(app_data->preview_area);
-            }
+            // Show the new widgets
+            afficher_en_attente();
         }
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
+}
+
+static void show_properties_dialog_btn_spin(GtkWidget *widget, gpointer data)
+{
+    AppData *app_data = (AppData *)data;
+    static GtkWidget *dialog = NULL;
+
+    if (dialog == NULL)
+    {
+        GtkWidget *content_area;
+        GtkWidget *grid;
+        GtkWidget *name_label, *tooltip_label;
+        GtkWidget *name_entry, *tooltip_entry;
+        GtkWidget *x_label, *y_label;
+        GtkWidget *x_entry, *y_entry;
+        GtkWidget *min_label, *max_label, *step_label, *digits_label, *value_label;
+        GtkWidget *min_entry, *max_entry, *step_entry, *digits_entry, *value_entry;
+
+        // Create dialog
+        create_property_dialog("Spin Button Properties", app_data, &dialog,
+                               G_CALLBACK(on_btn_spin_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Button identification fields
+        name_label = gtk_label_new("Spin Button Name:");
+        name_entry = gtk_entry_new();
+
+        tooltip_label = gtk_label_new("Tooltip Text:");
+        tooltip_entry = gtk_entry_new();
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Spin button properties
+        min_label = gtk_label_new("Minimum Value:");
+        max_label = gtk_label_new("Maximum Value:");
+        step_label = gtk_label_new("Step Increment:");
+        digits_label = gtk_label_new("Digits (Decimals):");
+        value_label = gtk_label_new("Initial Value:");
+
+        min_entry = gtk_entry_new();
+        max_entry = gtk_entry_new();
+        step_entry = gtk_entry_new();
+        digits_entry = gtk_entry_new();
+        value_entry = gtk_entry_new();
+
+        // Add widgets to grid
+        int row = 0;
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), min_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), min_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), max_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), max_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), step_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), step_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), digits_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), digits_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), value_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), value_entry, 1, row, 1, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "name_entry", name_entry,
+                          "tooltip_entry", tooltip_entry,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "min_entry", min_entry,
+                          "max_entry", max_entry,
+                          "step_entry", step_entry,
+                          "digits_entry", digits_entry,
+                          "value_entry", value_entry,
+                          NULL);
+    }
+
+    // Reset the form
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "name_entry", "spin1");
+    reset_dialog_entry(dialog, "tooltip_entry", "");
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "150");
+    reset_dialog_entry(dialog, "min_entry", "0");
+    reset_dialog_entry(dialog, "max_entry", "100");
+    reset_dialog_entry(dialog, "step_entry", "1");
+    reset_dialog_entry(dialog, "digits_entry", "0");
+    reset_dialog_entry(dialog, "value_entry", "0");
+
+    gtk_window_present(GTK_WINDOW(dialog));
 }
 
 // Helper function to add new item to list store
@@ -1823,158 +1853,19 @@ static void remove_selected_item(GtkButton *button, gpointer user_data)
     }
 }
 
-// Function to show properties dialog for ComboBox
-
-// Function to show dialog for creating a ComboBox
-static void show_create_combobox_dialog(GtkWidget *button, gpointer user_data)
+static void on_combobox_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
 {
-    AppData *app_data = (AppData *)user_data;
-
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-    GtkWidget *name_label, *tooltip_label;
-    GtkWidget *name_entry, *tooltip_entry;
-    GtkWidget *x_label, *y_label, *width_label, *height_label;
-    GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
-    GtkWidget *items_label, *items_tree, *items_scroll;
-    GtkWidget *add_item_box, *add_item_entry, *add_item_button;
-    GtkWidget *remove_item_button;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Add ComboBox",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
-
-    // Add container selection at the top of the dialog
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-
-    // Add default option (preview area)
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
-
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
-    {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
-    }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
-
-    // Name field
-    name_label = gtk_label_new("ComboBox Name:");
-    name_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(name_entry), "combobox1");
-
-    tooltip_label = gtk_label_new("Tooltip:");
-    tooltip_entry = gtk_entry_new();
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "10");
-
-    // Size fields
-    width_label = gtk_label_new("Width:");
-    height_label = gtk_label_new("Height:");
-    width_entry = gtk_entry_new();
-    height_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(width_entry), "20");
-    gtk_entry_set_text(GTK_ENTRY(height_entry), "100");
-
-    // Items list
-    items_label = gtk_label_new("Items:");
-    GtkListStore *store = gtk_list_store_new(2, G_TYPE_STRING, G_TYPE_STRING); // ID, Text
-    items_tree = gtk_tree_view_new_with_model(GTK_TREE_MODEL(store));
-
-    // Add columns
-    GtkCellRenderer *renderer = gtk_cell_renderer_text_new();
-    gtk_tree_view_insert_column_with_attributes(GTK_TREE_VIEW(items_tree), -1, "ID", renderer, "text", 0, NULL);
-    gtk_tree_view_insert_column_with_attributes(GTK_TREE_VIEW(items_tree), -1, "Text", renderer, "text", 1, NULL);
-
-    items_scroll = gtk_scrolled_window_new(NULL, NULL);
-    gtk_scrolled_window_set_min_content_height(GTK_SCROLLED_WINDOW(items_scroll), 100);
-    gtk_container_add(GTK_CONTAINER(items_scroll), items_tree);
-
-    // Add item box
-    add_item_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
-    add_item_entry = gtk_entry_new();
-    add_item_button = gtk_button_new_with_label("Add Item");
-    gtk_box_pack_start(GTK_BOX(add_item_box), add_item_entry, TRUE, TRUE, 0);
-    gtk_box_pack_start(GTK_BOX(add_item_box), add_item_button, FALSE, FALSE, 0);
-
-    // Connect add item signal
-    g_signal_connect(add_item_button, "clicked", G_CALLBACK(add_item_to_list), store);
-
-    // Remove item button
-    remove_item_button = gtk_button_new_with_label("Remove Selected Item");
-    g_signal_connect(remove_item_button, "clicked", G_CALLBACK(remove_selected_item), items_tree);
-
-    // Add widgets to grid
-    int row = 0;
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row++, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row++, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row++, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row++, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row++, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), width_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), width_entry, 1, row++, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), height_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_entry, 1, row++, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), items_label, 0, row, 2, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), items_scroll, 0, row, 2, 3);
-    row += 3;
-
-    gtk_grid_attach(GTK_GRID(grid), add_item_box, 0, row++, 2, 1);
-    gtk_grid_attach(GTK_GRID(grid), remove_item_button, 0, row++, 2, 1);
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
-
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
-
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *name_entry = dialog_field(dialog, "name_entry");
+        GtkWidget *tooltip_entry = dialog_field(dialog, "tooltip_entry");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *width_entry = dialog_field(dialog, "width_entry");
+        GtkWidget *height_entry = dialog_field(dialog, "height_entry");
+        GtkListStore *store = GTK_LIST_STORE(gtk_tree_view_get_model(GTK_TREE_VIEW(dialog_field(dialog, "items_tree"))));
+
         // Get values from form
         const gchar *name = gtk_entry_get_text(GTK_ENTRY(name_entry));
         const gchar *tooltip = gtk_entry_get_text(GTK_ENTRY(tooltip_entry));
@@ -1984,17 +1875,7 @@ static void show_create_combobox_dialog(GtkWidget *button, gpointer user_data)
         gint height = atoi(gtk_entry_get_text(GTK_ENTRY(height_entry)));
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // Create ComboBox
         gtkComboBox *combo = init_comboBox(
@@ -2039,118 +1920,171 @@ static void show_create_combobox_dialog(GtkWidget *button, gpointer user_data)
             // Add widget to hierarchy trees
             add_widget_to_both_trees(app_data, combo->comboBox, "ComboBox", target_container, TRUE, combo);
 
-            // Show all widgets
-            gtk_widget_show_all(app_data->preview_area);
+            // Show the new widgets
+            afficher_en_attente();
         }
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
 }
 
-static void show_properties_dialog_btn_switch(GtkWidget *widget, gpointer data)
+// Function to show dialog for creating a ComboBox
+static void show_create_combobox_dialog(GtkWidget *button, gpointer user_data)
 {
-    AppData *app_data = (AppData *)data;
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-
-    GtkWidget *name_label, *tooltip_label;
-    GtkWidget *name_entry, *tooltip_entry;
-    GtkWidget *x_label, *y_label;
-    GtkWidget *x_entry, *y_entry;
-    GtkWidget *active_check;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Switch Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
-
-    // Add container selection
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
+    AppData *app_data = (AppData *)user_data;
+    static GtkWidget *dialog = NULL;
 
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
+    if (dialog == NULL)
     {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
+        GtkWidget *content_area;
+        GtkWidget *grid;
+        GtkWidget *name_label, *tooltip_label;
+        GtkWidget *name_entry, *tooltip_entry;
+        GtkWidget *x_label, *y_label, *width_label, *height_label;
+        GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
+        GtkWidget *items_label, *items_tree, *items_scroll;
+        GtkWidget *add_item_box, *add_item_entry, *add_item_button;
+        GtkWidget *remove_item_button;
+
+        // Create dialog
+        create_property_dialog("Add ComboBox", app_data, &dialog,
+                               G_CALLBACK(on_combobox_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection at the top of the dialog
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Name field
+        name_label = gtk_label_new("ComboBox Name:");
+        name_entry = gtk_entry_new();
+
+        tooltip_label = gtk_label_new("Tooltip:");
+        tooltip_entry = gtk_entry_new();
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Size fields
+        width_label = gtk_label_new("Width:");
+        height_label = gtk_label_new("Height:");
+        width_entry = gtk_entry_new();
+        height_entry = gtk_entry_new();
+
+        // Items list
+        items_label = gtk_label_new("Items:");
+        GtkListStore *store = gtk_list_store_new(2, G_TYPE_STRING, G_TYPE_STRING); // ID, Text
+        items_tree = gtk_tree_view_new_with_model(GTK_TREE_MODEL(store));
+        g_object_unref(store);
+
+        // Add columns
+        GtkCellRenderer *renderer = gtk_cell_renderer_text_new();
+        gtk_tree_view_insert_column_with_attributes(GTK_TREE_VIEW(items_tree), -1, "ID", renderer, "text", 0, NULL);
+        gtk_tree_view_insert_column_with_attributes(GTK_TREE_VIEW(items_tree), -1, "Text", renderer, "text", 1, NULL);
+
+        items_scroll = gtk_scrolled_window_new(NULL, NULL);
+        gtk_scrolled_window_set_min_content_height(GTK_SCROLLED_WINDOW(items_scroll), 100);
+        gtk_container_add(GTK_CONTAINER(items_scroll), items_tree);
+
+        // Add item box
+        add_item_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+        add_item_entry = gtk_entry_new();
+        add_item_button = gtk_button_new_with_label("Add Item");
+        gtk_box_pack_start(GTK_BOX(add_item_box), add_item_entry, TRUE, TRUE, 0);
+        gtk_box_pack_start(GTK_BOX(add_item_box), add_item_button, FALSE, FALSE, 0);
+
+        // Connect add item signal
+        g_signal_connect(add_item_button, "clicked", G_CALLBACK(add_item_to_list), store);
+
+        // Remove item button
+        remove_item_button = gtk_button_new_with_label("Remove Selected Item");
+        g_signal_connect(remove_item_button, "clicked", G_CALLBACK(remove_selected_item), items_tree);
+
+        // Add widgets to grid
+        int row = 0;
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row++, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row++, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row++, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row++, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row++, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), width_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), width_entry, 1, row++, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), height_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_entry, 1, row++, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), items_label, 0, row, 2, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), items_scroll, 0, row, 2, 3);
+        row += 3;
+
+        gtk_grid_attach(GTK_GRID(grid), add_item_box, 0, row++, 2, 1);
+        gtk_grid_attach(GTK_GRID(grid), remove_item_button, 0, row++, 2, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "name_entry", name_entry,
+                          "tooltip_entry", tooltip_entry,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "width_entry", width_entry,
+                          "height_entry", height_entry,
+                          "items_tree", items_tree,
+                          "add_item_entry", add_item_entry,
+                          NULL);
     }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
-
-    // Switch identification fields
-    name_label = gtk_label_new("Switch Name:");
-    name_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(name_entry), "switch1");
-
-    tooltip_label = gtk_label_new("Tooltip Text:");
-    tooltip_entry = gtk_entry_new();
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "200");
-
-    // Active state
-    active_check = gtk_check_button_new_with_label("Initially Active");
-
-    // Add widgets to grid
-    int row = 0;
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
-    row++;
-
-    gtk_grid_attach(GTK_GRID(grid), active_check, 0, row, 2, 1);
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
 
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
+    // Reset the form, including the items typed for the previous combo box
+    GtkTreeView *items_tree = GTK_TREE_VIEW(dialog_field(dialog, "items_tree"));
+    gtk_list_store_clear(GTK_LIST_STORE(gtk_tree_view_get_model(items_tree)));
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "name_entry", "combobox1");
+    reset_dialog_entry(dialog, "tooltip_entry", "");
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "10");
+    reset_dialog_entry(dialog, "width_entry", "20");
+    reset_dialog_entry(dialog, "height_entry", "100");
+    reset_dialog_entry(dialog, "add_item_entry", "");
+
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
+static void on_btn_switch_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
+{
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *name_entry = dialog_field(dialog, "name_entry");
+        GtkWidget *tooltip_entry = dialog_field(dialog, "tooltip_entry");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *active_check = dialog_field(dialog, "active_check");
+
         // Get values from form
         const gchar *name = gtk_entry_get_text(GTK_ENTRY(name_entry));
         const gchar *tooltip = gtk_entry_get_text(GTK_ENTRY(tooltip_entry));
@@ -2159,17 +2093,7 @@ static void show_properties_dialog_btn_switch(GtkWidget *widget, gpointer data)
         gboolean is_active = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(active_check));
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // Create switch button
         btn *switch_button = btnSwitchFixed(
@@ -2188,138 +2112,131 @@ static void show_properties_dialog_btn_switch(GtkWidget *widget, gpointer data)
             // Create the button widget with editing capabilities
             GtkWidget *created_button = create_switch_button_with_editing(switch_button, app_data);
 
-            // Show all widgets
-            gtk_widget_show_all(app_data->preview_area);
+            // Show the new widgets
+            afficher_en_attente();
         }
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
 }
 
-// static void show_properties_dialog_btn_checkbox(GtkWidget *widget, gpointer data) {};
-// static void show_properties_dialog_btn_toggle(GtkWidget *widget, gpointer data) {};
-// static void show_properties_dialog_btn_spin(GtkWidget *widget, gpointer data) {};
-// static void show_properties_dialog_btn_switch(GtkWidget *widget, gpointer data) {};
-
-// Function to show dialog for basic entry configuration
-static void show_basic_entry_dialog(AppData *app_data)
+static void show_properties_dialog_btn_switch(GtkWidget *widget, gpointer data)
 {
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-    GtkWidget *x_label, *y_label, *width_label, *height_label;
-    GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
-    GtkWidget *editable_check, *visible_check;
-    GtkWidget *placeholder_label, *max_len_label, *default_text_label;
-    GtkWidget *placeholder_entry, *max_len_entry, *default_text_entry;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Basic Entry Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
-
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
-
-    // Add container selection at the top of the dialog
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-
-    // Add default option (preview area)
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
+    AppData *app_data = (AppData *)data;
+    static GtkWidget *dialog = NULL;
 
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
+    if (dialog == NULL)
     {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
+        GtkWidget *content_area;
+        GtkWidget *grid;
+
+        GtkWidget *name_label, *tooltip_label;
+        GtkWidget *name_entry, *tooltip_entry;
+        GtkWidget *x_label, *y_label;
+        GtkWidget *x_entry, *y_entry;
+        GtkWidget *active_check;
+
+        // Create dialog
+        create_property_dialog("Switch Properties", app_data, &dialog,
+                               G_CALLBACK(on_btn_switch_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Switch identification fields
+        name_label = gtk_label_new("Switch Name:");
+        name_entry = gtk_entry_new();
+
+        tooltip_label = gtk_label_new("Tooltip Text:");
+        tooltip_entry = gtk_entry_new();
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Active state
+        active_check = gtk_check_button_new_with_label("Initially Active");
+
+        // Add widgets to grid
+        int row = 0;
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), name_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), name_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), tooltip_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), tooltip_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, row, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, row, 1, 1);
+        row++;
+
+        gtk_grid_attach(GTK_GRID(grid), active_check, 0, row, 2, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "name_entry", name_entry,
+                          "tooltip_entry", tooltip_entry,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "active_check", active_check,
+                          NULL);
     }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
-
-    // Add container selection to the top of the form
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, 0, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, 0, 1, 1);
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "10");
-
-    // Size fields
-    width_label = gtk_label_new("Width:");
-    height_label = gtk_label_new("Height:");
-    width_entry = gtk_entry_new();
-    height_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(width_entry), "150");
-    gtk_entry_set_text(GTK_ENTRY(height_entry), "30");
-
-    // Checkbox fields
-    editable_check = gtk_check_button_new_with_label("Editable");
-    visible_check = gtk_check_button_new_with_label("Visible");
-    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(editable_check), TRUE);
-    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(visible_check), TRUE);
-
-    // Text fields
-    placeholder_label = gtk_label_new("Placeholder Text:");
-    max_len_label = gtk_label_new("Max Length:");
-    default_text_label = gtk_label_new("Default Text:");
-    placeholder_entry = gtk_entry_new();
-    max_len_entry = gtk_entry_new();
-    default_text_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(placeholder_entry), "Enter text here...");
-    gtk_entry_set_text(GTK_ENTRY(max_len_entry), "0");
 
-    // Add widgets to grid
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, 1, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, 1, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, 2, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, 2, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), width_label, 0, 3, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), width_entry, 1, 3, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_label, 0, 4, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_entry, 1, 4, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), editable_check, 0, 5, 2, 1);
-    gtk_grid_attach(GTK_GRID(grid), visible_check, 0, 6, 2, 1);
+    // Reset the form
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "name_entry", "switch1");
+    reset_dialog_entry(dialog, "tooltip_entry", "");
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "200");
+    reset_dialog_check(dialog, "active_check", FALSE);
 
-    gtk_grid_attach(GTK_GRID(grid), placeholder_label, 0, 7, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), placeholder_entry, 1, 7, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), max_len_label, 0, 8, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), max_len_entry, 1, 8, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), default_text_label, 0, 9, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), default_text_entry, 1, 9, 1, 1);
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
+// static void show_properties_dialog_btn_checkbox(GtkWidget *widget, gpointer data) {};
+// static void show_properties_dialog_btn_toggle(GtkWidget *widget, gpointer data) {};
+// static void show_properties_dialog_btn_spin(GtkWidget *widget, gpointer data) {};
+// static void show_properties_dialog_btn_switch(GtkWidget *widget, gpointer data) {};
 
+static void on_basic_entry_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
+{
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *width_entry = dialog_field(dialog, "width_entry");
+        GtkWidget *height_entry = dialog_field(dialog, "height_entry");
+        GtkWidget *editable_check = dialog_field(dialog, "editable_check");
+        GtkWidget *visible_check = dialog_field(dialog, "visible_check");
+        GtkWidget *placeholder_entry = dialog_field(dialog, "placeholder_entry");
+        GtkWidget *max_len_entry = dialog_field(dialog, "max_len_entry");
+        GtkWidget *default_text_entry = dialog_field(dialog, "default_text_entry");
+
         // Get values from form
         gint x = atoi(gtk_entry_get_text(GTK_ENTRY(x_entry)));
         gint y = atoi(gtk_entry_get_text(GTK_ENTRY(y_entry)));
@@ -2332,17 +2249,7 @@ static void show_basic_entry_dialog(AppData *app_data)
         const gchar *default_text = gtk_entry_get_text(GTK_ENTRY(default_text_entry));
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // Create basic entry with the selected container
         entry_type_basic *entry_basic = Init_Entry_Basic(
@@ -2362,120 +2269,139 @@ static void show_basic_entry_dialog(AppData *app_data)
 
             // No need to call add_widget_to_both_trees here since it's done in creer_entry_basic_with_editing
 
-            // Show all widgets
-            gtk_widget_show_all(app_data->preview_area);
+            // Show the new widgets
+            afficher_en_attente();
         }
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
 }
 
-// Function to show dialog for password entry configuration
-static void show_password_entry_dialog(AppData *app_data)
+// Function to show dialog for basic entry configuration
+static void show_basic_entry_dialog(AppData *app_data)
 {
-    GtkWidget *dialog;
-    GtkWidget *content_area;
-    GtkWidget *grid;
-    GtkWidget *x_label, *y_label, *width_label, *height_label;
-    GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
-    GtkWidget *placeholder_label, *invisible_char_label;
-    GtkWidget *placeholder_entry, *invisible_char_entry;
-    gint response;
-
-    // Create dialog
-    dialog = gtk_dialog_new_with_buttons("Password Entry Properties",
-                                         GTK_WINDOW(app_data->window),
-                                         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
-                                         "OK", GTK_RESPONSE_ACCEPT,
-                                         "Cancel", GTK_RESPONSE_CANCEL,
-                                         NULL);
-
-    content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+    static GtkWidget *dialog = NULL;
 
-    // Create grid for form layout
-    grid = gtk_grid_new();
-    gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
-    gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
-    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
-
-    // Add container selection at the top of the dialog
-    GtkWidget *container_label = gtk_label_new("Add to Container:");
-    GtkWidget *container_combo = gtk_combo_box_text_new();
-
-    // Add default option (preview area)
-    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), "Window (Default)");
-
-    // Add all containers
-    GList *iter;
-    for (iter = app_data->containers; iter != NULL; iter = iter->next)
-    {
-        GtkWidget *container = GTK_WIDGET(iter->data);
-        const gchar *name = gtk_widget_get_name(container);
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(container_combo), name);
-    }
-
-    // Select currently selected container
-    gint active_index = 0;
-    if (app_data->selected_container)
+    if (dialog == NULL)
     {
-        active_index = g_list_index(app_data->containers, app_data->selected_container) + 1;
+        GtkWidget *content_area;
+        GtkWidget *grid;
+        GtkWidget *x_label, *y_label, *width_label, *height_label;
+        GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
+        GtkWidget *editable_check, *visible_check;
+        GtkWidget *placeholder_label, *max_len_label, *default_text_label;
+        GtkWidget *placeholder_entry, *max_len_entry, *default_text_entry;
+
+        // Create dialog
+        create_property_dialog("Basic Entry Properties", app_data, &dialog,
+                               G_CALLBACK(on_basic_entry_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection at the top of the dialog
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Add container selection to the top of the form
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, 0, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, 0, 1, 1);
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Size fields
+        width_label = gtk_label_new("Width:");
+        height_label = gtk_label_new("Height:");
+        width_entry = gtk_entry_new();
+        height_entry = gtk_entry_new();
+
+        // Checkbox fields
+        editable_check = gtk_check_button_new_with_label("Editable");
+        visible_check = gtk_check_button_new_with_label("Visible");
+
+        // Text fields
+        placeholder_label = gtk_label_new("Placeholder Text:");
+        max_len_label = gtk_label_new("Max Length:");
+        default_text_label = gtk_label_new("Default Text:");
+        placeholder_entry = gtk_entry_new();
+        max_len_entry = gtk_entry_new();
+        default_text_entry = gtk_entry_new();
+
+        // Add widgets to grid
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, 1, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, 1, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, 2, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, 2, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), width_label, 0, 3, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), width_entry, 1, 3, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_label, 0, 4, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_entry, 1, 4, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), editable_check, 0, 5, 2, 1);
+        gtk_grid_attach(GTK_GRID(grid), visible_check, 0, 6, 2, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), placeholder_label, 0, 7, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), placeholder_entry, 1, 7, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), max_len_label, 0, 8, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), max_len_entry, 1, 8, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), default_text_label, 0, 9, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), default_text_entry, 1, 9, 1, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "width_entry", width_entry,
+                          "height_entry", height_entry,
+                          "editable_check", editable_check,
+                          "visible_check", visible_check,
+                          "placeholder_entry", placeholder_entry,
+                          "max_len_entry", max_len_entry,
+                          "default_text_entry", default_text_entry,
+                          NULL);
     }
-    gtk_combo_box_set_active(GTK_COMBO_BOX(container_combo), active_index);
 
-    // Add container selection to the top of the form
-    gtk_grid_attach(GTK_GRID(grid), container_label, 0, 0, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), container_combo, 1, 0, 1, 1);
-
-    // Position fields
-    x_label = gtk_label_new("X Position:");
-    y_label = gtk_label_new("Y Position:");
-    x_entry = gtk_entry_new();
-    y_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(x_entry), "10");
-    gtk_entry_set_text(GTK_ENTRY(y_entry), "50"); // Different default Y from basic entry
-
-    // Size fields
-    width_label = gtk_label_new("Width:");
-    height_label = gtk_label_new("Height:");
-    width_entry = gtk_entry_new();
-    height_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(width_entry), "150");
-    gtk_entry_set_text(GTK_ENTRY(height_entry), "30");
-
-    // Password-specific fields
-    placeholder_label = gtk_label_new("Placeholder Text:");
-    invisible_char_label = gtk_label_new("Mask Character:");
-    placeholder_entry = gtk_entry_new();
-    invisible_char_entry = gtk_entry_new();
-    gtk_entry_set_text(GTK_ENTRY(placeholder_entry), "Enter password...");
-    gtk_entry_set_text(GTK_ENTRY(invisible_char_entry), "*");
-    gtk_entry_set_max_length(GTK_ENTRY(invisible_char_entry), 1); // Only one character
-
-    // Add widgets to grid
-    gtk_grid_attach(GTK_GRID(grid), x_label, 0, 1, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), x_entry, 1, 1, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_label, 0, 2, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), y_entry, 1, 2, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), width_label, 0, 3, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), width_entry, 1, 3, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_label, 0, 4, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), height_entry, 1, 4, 1, 1);
-
-    gtk_grid_attach(GTK_GRID(grid), placeholder_label, 0, 5, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), placeholder_entry, 1, 5, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), invisible_char_label, 0, 6, 1, 1);
-    gtk_grid_attach(GTK_GRID(grid), invisible_char_entry, 1, 6, 1, 1);
-
-    // Add grid to dialog
-    gtk_container_add(GTK_CONTAINER(content_area), grid);
-    gtk_widget_show_all(dialog);
-
-    // Run dialog
-    response = gtk_dialog_run(GTK_DIALOG(dialog));
+    // Reset the form
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "10");
+    reset_dialog_entry(dialog, "width_entry", "150");
+    reset_dialog_entry(dialog, "height_entry", "30");
+    reset_dialog_check(dialog, "editable_check", TRUE);
+    reset_dialog_check(dialog, "visible_check", TRUE);
+    reset_dialog_entry(dialog, "placeholder_entry", "Enter text here...");
+    reset_dialog_entry(dialog, "max_len_entry", "0");
+    reset_dialog_entry(dialog, "default_text_entry", "");
+
+    gtk_window_present(GTK_WINDOW(dialog));
+}
 
+static void on_password_entry_dialog_response(GtkDialog *dialog, gint response, AppData *app_data)
+{
     if (response == GTK_RESPONSE_ACCEPT)
     {
+        GtkWidget *container_combo = dialog_field(dialog, "container_combo");
+        GtkWidget *x_entry = dialog_field(dialog, "x_entry");
+        GtkWidget *y_entry = dialog_field(dialog, "y_entry");
+        GtkWidget *width_entry = dialog_field(dialog, "width_entry");
+        GtkWidget *height_entry = dialog_field(dialog, "height_entry");
+        GtkWidget *placeholder_entry = dialog_field(dialog, "placeholder_entry");
+        GtkWidget *invisible_char_entry = dialog_field(dialog, "invisible_char_entry");
+
         // Get values from form
         gint x = atoi(gtk_entry_get_text(GTK_ENTRY(x_entry)));
         gint y = atoi(gtk_entry_get_text(GTK_ENTRY(y_entry)));
@@ -2488,17 +2414,7 @@ static void show_password_entry_dialog(AppData *app_data)
         gchar invisible_char = (invisible_char_text && invisible_char_text[0]) ? invisible_char_text[0] : '*';
 
         // Get the selected container
-        gint container_index = gtk_combo_box_get_active(GTK_COMBO_BOX(container_combo));
-        GtkWidget *target_container = NULL;
-
-        if (container_index > 0)
-        {
-            target_container = g_list_nth_data(app_data->containers, container_index - 1);
-        }
-        else
-        {
-            target_container = app_data->preview_area;
-        }
+        GtkWidget *target_container = get_selected_container(GTK_COMBO_BOX(container_combo), app_data);
 
         // Create password entry
         entry_type_password *entry_password = Init_Entry_Password(
@@ -2516,13 +2432,110 @@ static void show_password_entry_dialog(AppData *app_data)
 
             // No need to call add_widget_to_both_trees here since it's done in creer_entry_pass_with_editing
 
-            // Show all widgets
-            gtk_widget_show_all(app_data->preview_area);
+            // Show the new widgets
+            afficher_en_attente();
         }
     }
 
-    gtk_widget_destroy(dialog);
+    gtk_widget_hide(GTK_WIDGET(dialog));
+}
+
+// Function to show dialog for password entry configuration
+static void show_password_entry_dialog(AppData *app_data)
+{
+    static GtkWidget *dialog = NULL;
+
+    if (dialog == NULL)
+    {
+        GtkWidget *content_area;
+        GtkWidget *grid;
+        GtkWidget *x_label, *y_label, *width_label, *height_label;
+        GtkWidget *x_entry, *y_entry, *width_entry, *height_entry;
+        GtkWidget *placeholder_label, *invisible_char_label;
+        GtkWidget *placeholder_entry, *invisible_char_entry;
+
+        // Create dialog
+        create_property_dialog("Password Entry Properties", app_data, &dialog,
+                               G_CALLBACK(on_password_entry_dialog_response));
+
+        content_area = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
+
+        // Create grid for form layout
+        grid = gtk_grid_new();
+        gtk_grid_set_column_spacing(GTK_GRID(grid), 10);
+        gtk_grid_set_row_spacing(GTK_GRID(grid), 10);
+        gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+
+        // Add container selection at the top of the dialog
+        GtkWidget *container_label = gtk_label_new("Add to Container:");
+        GtkWidget *container_combo = create_container_combo(app_data);
+
+        // Add container selection to the top of the form
+        gtk_grid_attach(GTK_GRID(grid), container_label, 0, 0, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), container_combo, 1, 0, 1, 1);
+
+        // Position fields
+        x_label = gtk_label_new("X Position:");
+        y_label = gtk_label_new("Y Position:");
+        x_entry = gtk_entry_new();
+        y_entry = gtk_entry_new();
+
+        // Size fields
+        width_label = gtk_label_new("Width:");
+        height_label = gtk_label_new("Height:");
+        width_entry = gtk_entry_new();
+        height_entry = gtk_entry_new();
+
+        // Password-specific fields
+        placeholder_label = gtk_label_new("Placeholder Text:");
+        invisible_char_label = gtk_label_new("Mask Character:");
+        placeholder_entry = gtk_entry_new();
+        invisible_char_entry = gtk_entry_new();
+        gtk_entry_set_max_length(GTK_ENTRY(invisible_char_entry), 1); // Only one character
+
+        // Add widgets to grid
+        gtk_grid_attach(GTK_GRID(grid), x_label, 0, 1, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), x_entry, 1, 1, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_label, 0, 2, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), y_entry, 1, 2, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), width_label, 0, 3, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), width_entry, 1, 3, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_label, 0, 4, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), height_entry, 1, 4, 1, 1);
+
+        gtk_grid_attach(GTK_GRID(grid), placeholder_label, 0, 5, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), placeholder_entry, 1, 5, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), invisible_char_label, 0, 6, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), invisible_char_entry, 1, 6, 1, 1);
+
+        // Add grid to dialog
+        gtk_container_add(GTK_CONTAINER(content_area), grid);
+        gtk_widget_show_all(grid);
+
+        set_dialog_fields(dialog,
+                          "container_combo", container_combo,
+                          "x_entry", x_entry,
+                          "y_entry", y_entry,
+                          "width_entry", width_entry,
+                          "height_entry", height_entry,
+                          "placeholder_entry", placeholder_entry,
+                          "invisible_char_entry", invisible_char_entry,
+                          NULL);
+    }
+
+    // Reset the form
+    reset_dialog_container(dialog, app_data);
+    reset_dialog_entry(dialog, "x_entry", "10");
+    reset_dialog_entry(dialog, "y_entry", "50"); // Different default Y from basic entry
+    reset_dialog_entry(dialog, "width_entry", "150");
+    reset_dialog_entry(dialog, "height_entry", "30");
+    reset_dialog_entry(dialog, "placeholder_entry", "Enter password...");
+    reset_dialog_entry(dialog, "invisible_char_entry", "*");
+
+    gtk_window_present(GTK_WINDOW(dialog));
 }
+
 static void add_btn_normal_clicked(GtkWidget *widget, gpointer data)
 {
     AppData *app_data = (AppData *)data;
@@ -27,13 +27,13 @@
 typedef struct boite_dialog{
     GtkWidget* dialog;
     GtkWidget* contentArea;//Nécessaire pour ajouter du contenu au dialogue(texte,image,...),i.e. ensemble de widgets
-    dimension *dim;//La dimension du dialogue
+    dimension dim;//La dimension du dialogue
     gchar icon[MAX_LENGTH];//Le path de l'icon
     gchar title[MAX_LENGTH];//Titre de dialgue
     gboolean hasXY;//Si true alors la position sera définie par des cordonnés
     // sinon ça sera une position prédefinie (wpos)
     GtkWindowPosition wpos;//Position de dialogue (une position prédefinie, voir GtkWindowPosition)
-    coordonnees *xyPos;//Position selon les cordonnées.
+    coordonnees xyPos;//Position selon les cordonnées.
     GtkWidget* pere;//Le père du dialogue
     gboolean isModal;//Si modal(la boite ne permet pas l'interaction avec
     //d'autres windows ) ou pas.
@@ -49,7 +49,7 @@ typedef struct boite_dialog{
 ***************************************/
 boite_dialog* allocate_boite_dialog(){
     //Allouer la boite
-    boite_dialog* bg=(boite_dialog*) malloc(sizeof(boite_dialog));
+    boite_dialog* bg=(boite_dialog*) memoire_allouer(MEMOIRE_WIDGETS, sizeof(boite_dialog));
     //Sortir avec un message d'erreur si l'allocation échoue
     if(!bg){
         printf("Erreur d'allocation dans allocate_boite_dialog()\n");
@@ -95,11 +95,11 @@ boite_dialog* init_boite_dialog(GtkWidget* contentArea,gchar title[MAX_LENGTH],
     bg->pere=pere;//Assigner le pere du dialog
     //Copier la dimension si elle est non null
     if(dim){
-        bg->dim=dim;
+        bg->dim=*dim;
     }
         //Donner une valeur par défaut en cas d'abscence de dimension
     else{
-        bg->dim=dim(64, 64);
+        bg->dim=*dim(64, 64);
     }
     //Copier le type de position
     bg->hasXY=hasXY;
@@ -109,11 +109,11 @@ boite_dialog* init_boite_dialog(GtkWidget* contentArea,gchar title[MAX_LENGTH],
     //Copier la position basée sur les coordonnées si elle existe, ou la donner une par défaut sinon
     if(xyPos){
         //Copier les cordonnées
-        bg->xyPos=xyPos;
+        bg->xyPos=*xyPos;
     }
     else{
         //Définir des coordonnées par défaut(x=0,y=0)
-        bg->xyPos=cord(0,0);
+        bg->xyPos=*cord(0,0);
     }
     //Retourner le dialog
     return (boite_dialog*) bg;
@@ -137,14 +137,14 @@ void ajusterDialogue(boite_dialog* bg){
     if(bg->title[0] != '\0')
         gtk_window_set_title(GTK_WINDOW(bg->dialog), bg->title);
     //Ajouter la dimension par défaut
-    //gtk_window_set_default_size(GTK_WINDOW(bg->dialog), bg->dim->width, bg->dim->height);
+    //gtk_window_set_default_size(GTK_WINDOW(bg->dialog), bg->dim.width, bg->dim.height);
     //Ajouter l'icon
     if(bg->icon[0] != '\0')
         gtk_window_set_icon_from_file(GTK_WINDOW(bg->dialog), bg->icon, NULL);
     //Ajuster la position
     if(bg->hasXY)
         //Positionner selon les coordonnées.
-        gtk_window_move(GTK_WINDOW(bg->dialog), bg->xyPos->x, bg->xyPos->y);
+        gtk_window_move(GTK_WINDOW(bg->dialog), bg->xyPos.x, bg->xyPos.y);
     else
         //Positionner selon les valeurs de l'enum GTKWINDOWPOSITION.
         gtk_window_set_position(GTK_WINDOW(bg->dialog), bg->wpos);
@@ -159,12 +159,23 @@ void ajusterDialogue(boite_dialog* bg){
     //avec la souris, il garde ces dimensions meme si on change ces derniers dans
     //le programme donc on a fait recours à la fonction de gtk_widget_resize, l'appel
     //de cette fonction doit être après l'affichage du dialogue(show_all)
-    gtk_window_resize(GTK_WINDOW(bg->dialog), bg->dim->width, bg->dim->height);
+    gtk_window_resize(GTK_WINDOW(bg->dialog), bg->dim.width, bg->dim.height);
 }
 
 
 
 
+/**************************************
+ * NOM: liberer_boite_dialog.
+ * ENTRÉS: gpointer data: une boite de dialogue (boite_dialog*)
+ * SORTIS: void
+ * DESCRIPTION: Libérer la structure d'une boite de dialogue.
+ *              Appelée à la destruction du dialogue (voir creer_boite_dialogue).
+***************************************/
+void liberer_boite_dialog(gpointer data){
+    memoire_liberer(data);
+}
+
 /**************************************
  * NOM: creer_boite_dialogue.
  * ENTRÉS: boite_dialog* bg: une boite de dialogue passé par adresse
@@ -181,11 +192,12 @@ void creer_boite_dialogue(boite_dialog* bg){
     }
     //Création du dialogue
     bg->dialog= gtk_dialog_new();
+    //Le dialogue possède sa structure: elle est libérée à sa destruction
+    memoire_attacher(bg->dialog, bg, liberer_boite_dialog);
     //Définir le content area
     GtkWidget* contentArea=gtk_dialog_get_content_area(GTK_DIALOG(bg->dialog));
     //Ajouter le widget(s) au content area du dialog
     gtk_container_add(GTK_CONTAINER(contentArea),bg->contentArea);
-    gtk_widget_show_all(bg->contentArea);//Afficher le content area
     //Ajuster les caractéristiques du dialogue(dimension, position...)
     ajusterDialogue(bg);
 }
@@ -213,9 +225,9 @@ void addToContentArea(boite_dialog* bg, GtkWidget* widget)
     GtkWidget* contentArea=gtk_dialog_get_content_area(GTK_DIALOG(bg->dialog));
     //Ajouter le widget(s) au content area du dialog
     gtk_container_add(GTK_CONTAINER(contentArea),widget);
-    //Afficher le widget recemment ajouté
-    //gtk_widget_show(widget);
-    gtk_widget_show_all(bg->dialog);
+    //Afficher le widget recemment ajouté (le dialogue est déjà affiché par ajusterDialogue,
+    //inutile de reparcourir tous ses composants)
+    gtk_widget_show_all(widget);
 
 }
 
@@ -242,16 +254,16 @@ void addActionWidget(boite_dialog* bg, GtkWidget* widget, GtkResponseType res){
     }
     //Ajouter l'action au dialogue
     gtk_dialog_add_action_widget(GTK_DIALOG(this->dialog), GTK_WIDGET(widget), res);
-    //Afficher le dialog et ses composants
-    gtk_widget_show_all(this->dialog);
+    //Afficher le widget recemment ajouté
+    gtk_widget_show_all(widget);
 }
 
 
 /***TEST PHASE***/
+//La structure appartient au dialogue: le détruire la libère (voir liberer_boite_dialog)
 void free_boite_dialog(boite_dialog* bg) {
     if (bg) {
         gtk_widget_destroy(bg->dialog); // Important pour libérer les ressources
-        free(bg);
     }
 }
 
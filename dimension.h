@@ -17,7 +17,7 @@ dimension* creer_dimension(gint h , gint w)
 {
 
 
-    dimension *dim=(dimension *) malloc(sizeof (dimension ));
+    dimension *dim=(dimension *) memoire_allouer(MEMOIRE_WIDGETS, sizeof (dimension ));
     if(dim == NULL){
         g_print("\n Erreur d'allocation ");
         //exit(EXIT_FAILURE);
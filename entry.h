@@ -17,7 +17,7 @@ typedef struct {
     GtkWidget *entry;
     // gint h;
     // gint w;
-    dimension *dim;
+    dimension dim;
     gboolean is_editable;
     gboolean is_visible;
     gchar *placeholder_text;
@@ -25,7 +25,7 @@ typedef struct {
     gchar *default_text; // the difference between palce holder and defaust txt , the placehlder will be shown only when the enetry is empty ,
     // but the default text will be shown but will not be removed when u start typig
     GtkWidget* container;
-    coordonnees* cord;
+    coordonnees cord;
 } entry_type_basic;
 
 typedef struct {
@@ -33,26 +33,28 @@ typedef struct {
     GtkWidget *entry;
     // gint h;
     // gint w;
-    dimension *dim;
+    dimension dim;
     gchar *placeholder_text;
     gchar invisible_char;
     GtkWidget* container;
-    coordonnees* cord
+    coordonnees cord;
 } entry_type_password;
 
 // Add freee funct
+// Ces fonctions sont appelées à la destruction du GtkEntry (voir creer_entry_basic/creer_entry_pass):
+// la structure appartient au widget.
 void free_entry_basic(entry_type_basic *entry) {
     if (entry) {
         g_free(entry->placeholder_text);
         g_free(entry->default_text);
-        g_free(entry);
+        memoire_liberer(entry);
     }
 }
 
 void free_entry_password(entry_type_password *entry) {
     if (entry) {
         g_free(entry->placeholder_text);
-        g_free(entry);
+        memoire_liberer(entry);
     }
 }
 
@@ -74,18 +76,18 @@ entry_type_basic *Init_Entry_Basic(
     g_return_val_if_fail(dim->height > 0 && dim->width > 0, NULL);
     g_return_val_if_fail(maxlen >= 0, NULL);
 
-    entry_type_basic *entry_basic = (entry_type_basic *)g_malloc(sizeof(entry_type_basic));
+    entry_type_basic *entry_basic = (entry_type_basic *)memoire_allouer(MEMOIRE_WIDGETS, sizeof(entry_type_basic));
 
 
     entry_basic->entry = gtk_entry_new();
-    entry_basic->dim = dim;
+    entry_basic->dim = *dim;
     entry_basic->is_editable = editable;
     entry_basic->is_visible = visible;
     entry_basic->placeholder_text = g_strdup(placeholder);
     entry_basic->maxlen = maxlen;
     entry_basic->default_text = g_strdup(default_text);
     entry_basic->container = container;
-    entry_basic->cord = cord;
+    entry_basic->cord = cord ? *cord : (coordonnees){0, 0};
     return entry_basic;
 }
 
@@ -102,23 +104,25 @@ entry_type_password *Init_Entry_Password(
 ) {
 
 
-    entry_type_password *entry_password = (entry_type_password *)g_malloc(sizeof(entry_type_password));
+    entry_type_password *entry_password = (entry_type_password *)memoire_allouer(MEMOIRE_WIDGETS, sizeof(entry_type_password));
 
 
     entry_password->entry = gtk_entry_new();
-    entry_password->dim=dim;
+    entry_password->dim = *dim;
     entry_password->placeholder_text = g_strdup(placeholder);
     entry_password->invisible_char = invisible_char;
     entry_password->container = container;
-    entry_password->cord = cord;
+    entry_password->cord = cord ? *cord : (coordonnees){0, 0};
 
     return entry_password;
 }
 
 // add fucnt for basci type
 GtkWidget *creer_entry_basic(entry_type_basic *entry_basic) {
+    // L'entry possède sa structure: elle est libérée à sa destruction
+    memoire_attacher(entry_basic->entry, entry_basic, (GDestroyNotify)free_entry_basic);
     // Configure the entry
-    gtk_widget_set_size_request(entry_basic->entry, entry_basic->dim->width, entry_basic->dim->height);
+    gtk_widget_set_size_request(entry_basic->entry, entry_basic->dim.width, entry_basic->dim.height);
 
 
     // Set properties
@@ -140,7 +144,7 @@ GtkWidget *creer_entry_basic(entry_type_basic *entry_basic) {
 
     //Ajouter au conteneur
     if(GTK_IS_FIXED(entry_basic->container)){
-        gtk_fixed_put(GTK_FIXED(entry_basic->container), entry_basic->entry, entry_basic->cord->x, entry_basic->cord->y);
+        gtk_fixed_put(GTK_FIXED(entry_basic->container), entry_basic->entry, entry_basic->cord.x, entry_basic->cord.y);
     }
     gtk_container_add(GTK_CONTAINER(entry_basic->container), entry_basic->entry);
 
@@ -158,7 +162,9 @@ void on_entry_activated(GtkEntry *entry, gpointer user_data) {
 
 // add fucn for the password type
 GtkWidget *creer_entry_pass(entry_type_password *entry_password) {
-    gtk_widget_set_size_request(entry_password->entry, entry_password->dim->width, entry_password->dim->height);
+    // L'entry possède sa structure: elle est libérée à sa destruction
+    memoire_attacher(entry_password->entry, entry_password, (GDestroyNotify)free_entry_password);
+    gtk_widget_set_size_request(entry_password->entry, entry_password->dim.width, entry_password->dim.height);
 
 
     gtk_entry_set_visibility(GTK_ENTRY(entry_password->entry), FALSE);
@@ -170,7 +176,7 @@ GtkWidget *creer_entry_pass(entry_type_password *entry_password) {
 
     //Ajouter au conteneur
     if(GTK_IS_FIXED(entry_password->container)){
-        gtk_fixed_put(GTK_FIXED(entry_password->container), entry_password->entry, entry_password->cord->x, entry_password->cord->y);
+        gtk_fixed_put(GTK_FIXED(entry_password->container), entry_password->entry, entry_password->cord.x, entry_password->cord.y);
     }
     gtk_container_add(GTK_CONTAINER(entry_password->container), entry_password->entry);
 
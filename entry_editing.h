@@ -31,13 +31,13 @@ Arbre* find_arbre_node_by_widget(Arbre* root, GtkWidget* widget) {
 
 // Implementation of functions that were forward-declared in entry.h
 GtkWidget *creer_entry_basic_with_editing(entry_type_basic *entry_basic, struct _AppData *app_data) {
-    g_print("Creating basic entry with editing\n");
+    TRACER(TRACE_AFFICHAGE, TRACE_DEBUG, "Creating basic entry with editing");
     
     // Create the widget
     GtkWidget *entry_widget = creer_entry_basic(entry_basic);
     
     // Register for property editing
-    g_print("Registering entry widget %p for property editing\n", entry_widget);
+    TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Registering entry widget %p for property editing", entry_widget);
     register_widget_for_property_editing(entry_widget, app_data);
     
     // Add to both tree structures with the structure reference
@@ -48,13 +48,13 @@ GtkWidget *creer_entry_basic_with_editing(entry_type_basic *entry_basic, struct
 }
 
 GtkWidget *creer_entry_pass_with_editing(entry_type_password *entry_password, struct _AppData *app_data) {
-    g_print("Creating password entry with editing\n");
+    TRACER(TRACE_AFFICHAGE, TRACE_DEBUG, "Creating password entry with editing");
     
     // Create the widget
     GtkWidget *entry_widget = creer_entry_pass(entry_password);
     
     // Register for property editing
-    g_print("Registering password widget %p for property editing\n", entry_widget);
+    TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Registering password widget %p for property editing", entry_widget);
     register_widget_for_property_editing(entry_widget, app_data);
     
     // Add to both tree structures with the structure reference
@@ -74,29 +74,17 @@ void* get_widget_structure(AppData *app_data, GtkWidget *widget) {
 }
 
 static gboolean on_debug_click(GtkWidget *widget, GdkEventButton *event, gpointer user_data) {
-    g_print("DEBUG: Image event box clicked at (%f,%f)\n", event->x, event->y);
+    TRACER(TRACE_EVENEMENTS, TRACE_DEBUG, "Image event box clicked at (%f,%f)", event->x, event->y);
     return FALSE; // Continue propagation
 }
 
 GtkWidget *creer_image_with_editing(MonImage *img, struct _AppData *app_data) {
-    g_print("Creating image with editing\n");
+    TRACER(TRACE_AFFICHAGE, TRACE_DEBUG, "Creating image with editing");
     
-    // Create the image widget
-    GtkWidget *image_widget = gtk_image_new_from_file(img->path);
-    if (!image_widget) {
-        g_print("Error: Failed to create image widget from file %s\n", img->path);
-        return NULL;
-    }
-
-    // Resize the image
-    GdkPixbuf *pixbuf = gdk_pixbuf_new_from_file(img->path, NULL);
-    if (pixbuf) {
-        GdkPixbuf *scaled = gdk_pixbuf_scale_simple(pixbuf, img->dim.width, img->dim.height, 
-                                                  GDK_INTERP_BILINEAR);
-        gtk_image_set_from_pixbuf(GTK_IMAGE(image_widget), scaled);
-        g_object_unref(pixbuf);
-        g_object_unref(scaled);
-    }
+    // Create the image widget; the file is decoded off the GTK thread at its final size
+    // (a sized placeholder is shown until then, and the pixbuf is shared through the cache)
+    GtkWidget *image_widget = gtk_image_new();
+    cache_pixbuf_charger_async(GTK_IMAGE(image_widget), img->path, img->dim.width, img->dim.height);
     
     // Create an event box to capture events
     GtkWidget *event_box = gtk_event_box_new();
@@ -125,7 +113,7 @@ GtkWidget *creer_image_with_editing(MonImage *img, struct _AppData *app_data) {
     g_signal_connect(event_box, "button-press-event", G_CALLBACK(on_debug_click), NULL);
     
     // Register for property editing
-    g_print("Registering event box with image for property editing\n");
+    TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Registering event box with image for property editing");
     register_widget_for_property_editing(event_box, app_data);
     
     return event_box;
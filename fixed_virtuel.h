@@ -0,0 +1,486 @@
+//
+// Created by ACER on 06/01/2025.
+//
+
+#ifndef TEST1_FIXED_VIRTUEL_H
+#define TEST1_FIXED_VIRTUEL_H
+#include "global.h"
+#include "containers_list.h"
+#include "index_spatial.h"
+
+//Conteneur fixed virtualisé pour les très grands formulaires.
+//Les fils d'un noeud Arbre sont décrits par leurs propriétés (x, y, width, height) et ne
+//deviennent de vrais widgets GTK que lorsqu'ils coupent la zone visible du scrolled window,
+//élargie d'une marge. Un widget qui sort de cette zone est caché et rangé dans la réserve de
+//son type, puis réutilisé pour le prochain noeud du meme type qui devient visible: le nombre
+//de widgets construits reste de l'ordre de ce qui tient à l'écran, quelle que soit la taille
+//du formulaire.
+//Les rectangles des fils sont rangés dans un index spatial (index_spatial.h) à chaque
+//rechargement: un défilement ne regarde que les noeuds de la zone visible, sans relire les
+//propriétés de tous les fils.
+//Les modifications faites par l'utilisateur (case cochée, texte saisi...) sont recopiées dans
+//les propriétés du noeud: un widget réutilisé pour un autre noeud ne les emporte pas, et le
+//noeud les retrouve quand il redevient visible.
+
+//Taille donnée aux noeuds qui n'ont pas de width/height
+#define FIXED_VIRTUEL_LARGEUR_DEFAUT 80
+#define FIXED_VIRTUEL_HAUTEUR_DEFAUT 30
+
+//Fabrique d'un type de widget: creer() construit un widget vide, lier() le remplit avec les
+//propriétés d'un noeud (texte, état...). lier() est rappelée à chaque réutilisation du widget.
+typedef struct {
+    GtkWidget* (*creer)(void);
+    void (*lier)(GtkWidget* widget, Arbre* noeud);
+} fabrique_virtuelle;
+
+//Groupe de radios (propriété "groupe" des noeuds): les radios matérialisés d'un groupe sont
+//dans le groupe GTK du leurre, un radio jamais affiché qui est actif quand aucun des widgets
+//affichés ne correspond au noeud choisi.
+typedef struct {
+    GtkWidget* leurre;          // GtkRadioButton jamais affiché (référence gardée)
+    Arbre* actif;               // Noeud choisi du groupe (NULL si aucun)
+} groupe_virtuel;
+
+typedef struct {
+    GtkWidget* scroll;          // GtkScrolledWindow à placer dans l'interface
+    GtkWidget* fixed;           // GtkFixed qui porte les widgets matérialisés
+    Arbre* conteneur;           // Noeud dont les fils sont virtualisés
+    gint marge;                 // Marge (px) ajoutée autour de la zone visible
+    GHashTable* actifs;         // Arbre* -> GtkWidget* matérialisé
+    GHashTable* reserves;       // WidgetType -> GQueue* de widgets cachés réutilisables
+    index_spatial* index;       // Rectangles des fils (clé: Arbre*), rempli par recharger
+    GHashTable* groupes;        // Nom de groupe -> groupe_virtuel* des radios
+    GHashTable* noms;           // Nom d'un fils -> Arbre* (le premier l'emporte), rempli par recharger
+    gboolean liaison;           // TRUE pendant lier(): les signaux du widget sont ignorés
+    guint idle_id;              // Mise à jour planifiée (0 si aucune)
+    guint nb_crees;             // Widgets construits depuis la création (mesures)
+    guint nb_recycles;          // Widgets réutilisés depuis une réserve (mesures)
+} fixed_virtuel;
+
+//Fabriques enregistrées: WidgetType -> fabrique_virtuelle*
+static GHashTable* fabriques_virtuelles = NULL;
+
+
+/**********************************************************************************************************
+ Nom            : enregistrer_fabrique_virtuelle()
+ Entrée         : type  - Le type de widget (champ type des noeuds Arbre)
+                  creer - Construit un widget vide de ce type
+                  lier  - Remplit le widget avec les propriétés d'un noeud
+ Sortie         : Aucune
+ Description    : Enregistre (ou remplace) la fabrique d'un type. Les noeuds dont le type n'a pas de
+                  fabrique ne sont jamais matérialisés par le fixed virtuel.
+**********************************************************************************************************/
+void enregistrer_fabrique_virtuelle(WidgetType type, GtkWidget* (*creer)(void),
+                                    void (*lier)(GtkWidget*, Arbre*)) {
+    if (!fabriques_virtuelles)
+        fabriques_virtuelles = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    fabrique_virtuelle* f = g_new(fabrique_virtuelle, 1);
+    f->creer = creer;
+    f->lier = lier;
+    g_hash_table_insert(fabriques_virtuelles, GINT_TO_POINTER(type), f);
+}
+
+//Texte affiché par un noeud: propriété label, sinon text, sinon son nom
+static const char* texte_noeud_virtuel(Arbre* noeud) {
+    const char* texte = get_property_of_node(noeud, "label");
+    if (!texte) texte = get_property_of_node(noeud, "text");
+    return texte ? texte : noeud->nom;
+}
+
+//Etat coché d'un noeud: propriété checked ou active à 1
+static gboolean etat_noeud_virtuel(Arbre* noeud) {
+    const char* etat = get_property_of_node(noeud, "checked");
+    if (!etat) etat = get_property_of_node(noeud, "active");
+    return etat && atoi(etat);
+}
+
+//Recopie l'état coché dans la propriété lue par etat_noeud_virtuel()
+static void ecrire_etat_noeud_virtuel(Arbre* noeud, gboolean etat) {
+    set_property_of_node(noeud, get_property_of_node(noeud, "checked") ? "checked" : "active",
+                         etat ? "1" : "0");
+}
+
+static gboolean est_radio_virtuel(WidgetType type) {
+    return type == WIDGET_RADIO || type == WIDGET_BUTTON_RADIO;
+}
+
+static GtkWidget* creer_label_virtuel(void) { return gtk_label_new(""); }
+//Le groupe GTK du radio est choisi à chaque liaison (voir lier_radio_groupe)
+static GtkWidget* creer_radio_virtuel(void) { return gtk_radio_button_new(NULL); }
+
+static void lier_label_virtuel(GtkWidget* widget, Arbre* noeud) {
+    gtk_label_set_text(GTK_LABEL(widget), texte_noeud_virtuel(noeud));
+}
+
+static void lier_bouton_virtuel(GtkWidget* widget, Arbre* noeud) {
+    gtk_button_set_label(GTK_BUTTON(widget), texte_noeud_virtuel(noeud));
+}
+
+//checkbox et toggle: texte et état
+static void lier_coche_virtuel(GtkWidget* widget, Arbre* noeud) {
+    gtk_button_set_label(GTK_BUTTON(widget), texte_noeud_virtuel(noeud));
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(widget), etat_noeud_virtuel(noeud));
+}
+
+static void lier_switch_virtuel(GtkWidget* widget, Arbre* noeud) {
+    gtk_switch_set_active(GTK_SWITCH(widget), etat_noeud_virtuel(noeud));
+}
+
+static void lier_entry_virtuel(GtkWidget* widget, Arbre* noeud) {
+    const char* texte = get_property_of_node(noeud, "default_text");
+    const char* indice = get_property_of_node(noeud, "placeholder");
+    gtk_entry_set_text(GTK_ENTRY(widget), texte ? texte : "");
+    gtk_entry_set_placeholder_text(GTK_ENTRY(widget), indice ? indice : "");
+    gtk_entry_set_visibility(GTK_ENTRY(widget), noeud->type != WIDGET_ENTRY_PASSWORD);
+}
+
+//Fabriques des widgets simples du projet, enregistrées à la création du premier fixed virtuel
+static void fabriques_virtuelles_par_defaut() {
+    if (fabriques_virtuelles)
+        return;
+    enregistrer_fabrique_virtuelle(WIDGET_LABEL, creer_label_virtuel, lier_label_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_BUTTON, gtk_button_new, lier_bouton_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_BUTTON_NORMAL, gtk_button_new, lier_bouton_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_CHECKBOX, gtk_check_button_new, lier_coche_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_BUTTON_CHECKBOX, gtk_check_button_new, lier_coche_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_BUTTON_TOGGLE, gtk_toggle_button_new, lier_coche_virtuel);
+    //L'état d'un radio vient du choix de son groupe (lier_radio_groupe)
+    enregistrer_fabrique_virtuelle(WIDGET_RADIO, creer_radio_virtuel, lier_bouton_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_BUTTON_RADIO, creer_radio_virtuel, lier_bouton_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_SWITCH, gtk_switch_new, lier_switch_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_BUTTON_SWITCH, gtk_switch_new, lier_switch_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_ENTRY_BASIC, gtk_entry_new, lier_entry_virtuel);
+    enregistrer_fabrique_virtuelle(WIDGET_ENTRY_PASSWORD, gtk_entry_new, lier_entry_virtuel);
+}
+
+//Groupe d'un noeud radio, créé à la première demande
+static groupe_virtuel* groupe_du_noeud(fixed_virtuel* fv, Arbre* noeud) {
+    const char* nom = get_property_of_node(noeud, "groupe");
+    if (!nom) nom = "";
+    groupe_virtuel* g = g_hash_table_lookup(fv->groupes, nom);
+    if (!g) {
+        g = g_new0(groupe_virtuel, 1);
+        g->leurre = g_object_ref_sink(gtk_radio_button_new(NULL));
+        g_hash_table_insert(fv->groupes, g_strdup(nom), g);
+    }
+    return g;
+}
+
+static void liberer_groupe_virtuel(gpointer data) {
+    groupe_virtuel* g = data;
+    g_object_unref(g->leurre);
+    g_free(g);
+}
+
+//Met le radio dans le groupe de son noeud. Un radio actif ne se décoche pas lui-meme:
+//quand le noeud n'est pas le choix du groupe, c'est le leurre qui devient actif.
+static void lier_radio_groupe(fixed_virtuel* fv, GtkWidget* radio, Arbre* noeud) {
+    groupe_virtuel* g = groupe_du_noeud(fv, noeud);
+    gtk_radio_button_join_group(GTK_RADIO_BUTTON(radio), GTK_RADIO_BUTTON(g->leurre));
+    if (g->actif == noeud)
+        gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(radio), TRUE);
+    else if (gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(radio)))
+        gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(g->leurre), TRUE);
+}
+
+//Recopie dans le noeud d'un widget matérialisé ce que l'utilisateur y a changé
+static void on_coche_virtuelle(GtkToggleButton* bouton, gpointer data) {
+    fixed_virtuel* fv = data;
+    Arbre* noeud = g_object_get_data(G_OBJECT(bouton), "noeud_virtuel");
+    if (fv->liaison || !noeud)
+        return;
+    gboolean etat = gtk_toggle_button_get_active(bouton);
+    if (!est_radio_virtuel(noeud->type)) {
+        ecrire_etat_noeud_virtuel(noeud, etat);
+        return;
+    }
+    //Radio: seul le radio qui devient actif change le choix du groupe
+    groupe_virtuel* g = groupe_du_noeud(fv, noeud);
+    if (!etat || g->actif == noeud)
+        return;
+    if (g->actif)
+        ecrire_etat_noeud_virtuel(g->actif, FALSE);
+    ecrire_etat_noeud_virtuel(noeud, TRUE);
+    g->actif = noeud;
+}
+
+static void on_switch_virtuel(GObject* objet, GParamSpec* pspec, gpointer data) {
+    fixed_virtuel* fv = data;
+    Arbre* noeud = g_object_get_data(objet, "noeud_virtuel");
+    if (!fv->liaison && noeud)
+        ecrire_etat_noeud_virtuel(noeud, gtk_switch_get_active(GTK_SWITCH(objet)));
+}
+
+static void on_entry_virtuelle(GtkEditable* editable, gpointer data) {
+    fixed_virtuel* fv = data;
+    Arbre* noeud = g_object_get_data(G_OBJECT(editable), "noeud_virtuel");
+    if (!fv->liaison && noeud)
+        set_property_of_node(noeud, "default_text", gtk_entry_get_text(GTK_ENTRY(editable)));
+}
+
+//Branche la recopie vers le noeud sur un widget qui vient d'etre construit
+static void suivre_widget_virtuel(fixed_virtuel* fv, GtkWidget* widget) {
+    if (GTK_IS_TOGGLE_BUTTON(widget))
+        g_signal_connect(widget, "toggled", G_CALLBACK(on_coche_virtuelle), fv);
+    else if (GTK_IS_SWITCH(widget))
+        g_signal_connect(widget, "notify::active", G_CALLBACK(on_switch_virtuel), fv);
+    else if (GTK_IS_ENTRY(widget))
+        g_signal_connect(widget, "changed", G_CALLBACK(on_entry_virtuelle), fv);
+}
+
+//Géométrie d'un noeud, avec la taille par défaut s'il n'en a pas
+static gboolean geometrie_virtuelle(Arbre* noeud, GdkRectangle* rect) {
+    if (!get_node_geometry(noeud, rect))
+        return FALSE;
+    if (rect->width < 0) rect->width = FIXED_VIRTUEL_LARGEUR_DEFAUT;
+    if (rect->height < 0) rect->height = FIXED_VIRTUEL_HAUTEUR_DEFAUT;
+    return TRUE;
+}
+
+//Zone visible du scrolled window (coordonnées du fixed), élargie de la marge
+static void zone_virtuelle(fixed_virtuel* fv, GdkRectangle* zone) {
+    GtkAdjustment* h = gtk_scrolled_window_get_hadjustment(GTK_SCROLLED_WINDOW(fv->scroll));
+    GtkAdjustment* v = gtk_scrolled_window_get_vadjustment(GTK_SCROLLED_WINDOW(fv->scroll));
+    zone->x = (gint)gtk_adjustment_get_value(h) - fv->marge;
+    zone->y = (gint)gtk_adjustment_get_value(v) - fv->marge;
+    zone->width = (gint)gtk_adjustment_get_page_size(h) + 2 * fv->marge;
+    zone->height = (gint)gtk_adjustment_get_page_size(v) + 2 * fv->marge;
+}
+
+//Cache un widget et le range dans la réserve de son type
+static void ranger_widget_virtuel(fixed_virtuel* fv, WidgetType type, GtkWidget* widget) {
+    GQueue* reserve = g_hash_table_lookup(fv->reserves, GINT_TO_POINTER(type));
+    if (!reserve) {
+        reserve = g_queue_new();
+        g_hash_table_insert(fv->reserves, GINT_TO_POINTER(type), reserve);
+    }
+    gtk_widget_hide(widget);
+    g_object_set_data(G_OBJECT(widget), "noeud_virtuel", NULL);
+    g_queue_push_head(reserve, widget);
+}
+
+//Donne un widget au noeud: réutilisé depuis la réserve de son type, sinon construit
+static void materialiser_noeud(fixed_virtuel* fv, Arbre* noeud, GdkRectangle* rect) {
+    fabrique_virtuelle* f = g_hash_table_lookup(fabriques_virtuelles, GINT_TO_POINTER(noeud->type));
+    if (!f)
+        return;
+
+    GQueue* reserve = g_hash_table_lookup(fv->reserves, GINT_TO_POINTER(noeud->type));
+    GtkWidget* widget = reserve ? g_queue_pop_head(reserve) : NULL;
+    if (widget) {
+        gtk_fixed_move(GTK_FIXED(fv->fixed), widget, rect->x, rect->y);
+        fv->nb_recycles++;
+    } else {
+        widget = f->creer();
+        //Un show_all de la fenetre ne doit pas réafficher les widgets rangés
+        gtk_widget_set_no_show_all(widget, TRUE);
+        suivre_widget_virtuel(fv, widget);
+        gtk_fixed_put(GTK_FIXED(fv->fixed), widget, rect->x, rect->y);
+        fv->nb_crees++;
+    }
+    fv->liaison = TRUE;
+    if (est_radio_virtuel(noeud->type) && GTK_IS_RADIO_BUTTON(widget))
+        lier_radio_groupe(fv, widget, noeud);
+    f->lier(widget, noeud);
+    fv->liaison = FALSE;
+    g_object_set_data(G_OBJECT(widget), "noeud_virtuel", noeud);
+    gtk_widget_set_size_request(widget, rect->width, rect->height);
+    gtk_widget_show(widget);
+
+    noeud->widget = widget;
+    g_hash_table_insert(fv->actifs, noeud, widget);
+}
+
+/**********************************************************************************************************
+ Nom            : fixed_virtuel_mettre_a_jour()
+ Entrée         : fv - Le fixed virtuel
+ Sortie         : Aucune
+ Description    : Range les widgets sortis de la zone visible (plus la marge) puis matérialise les
+                  noeuds qui y sont entrés. Les widgets rangés sont réutilisés dans le meme passage.
+**********************************************************************************************************/
+void fixed_virtuel_mettre_a_jour(fixed_virtuel* fv) {
+    GdkRectangle zone, rect;
+    zone_virtuelle(fv, &zone);
+
+    //1) Ranger d'abord les widgets sortis, pour remplir les réserves
+    GHashTableIter iter;
+    gpointer cle, valeur;
+    g_hash_table_iter_init(&iter, fv->actifs);
+    while (g_hash_table_iter_next(&iter, &cle, &valeur)) {
+        Arbre* noeud = cle;
+        if (index_spatial_rectangle(fv->index, noeud, &rect) && gdk_rectangle_intersect(&zone, &rect, NULL))
+            continue;
+        ranger_widget_virtuel(fv, noeud->type, valeur);
+        if (noeud->widget == valeur)
+            noeud->widget = NULL;
+        g_hash_table_iter_remove(&iter);
+    }
+
+    //2) Matérialiser les noeuds entrés dans la zone: seules les cellules de la zone sont lues
+    GPtrArray* visibles = index_spatial_chercher(fv->index, &zone);
+    for (guint i = 0; i < visibles->len; i++) {
+        Arbre* noeud = g_ptr_array_index(visibles, i);
+        if (!g_hash_table_contains(fv->actifs, noeud) && index_spatial_rectangle(fv->index, noeud, &rect))
+            materialiser_noeud(fv, noeud, &rect);
+    }
+    g_ptr_array_free(visibles, TRUE);
+}
+
+static gboolean fixed_virtuel_idle(gpointer data) {
+    fixed_virtuel* fv = data;
+    fv->idle_id = 0;
+    fixed_virtuel_mettre_a_jour(fv);
+    return G_SOURCE_REMOVE;
+}
+
+//Défilement ou redimensionnement: une seule mise à jour avant la prochaine image.
+//Elle n'est pas faite dans le signal lui-meme, qui peut etre émis pendant l'allocation.
+static void planifier_fixed_virtuel(GtkAdjustment* adjustment, gpointer data) {
+    fixed_virtuel* fv = data;
+    if (!fv->idle_id)
+        fv->idle_id = g_idle_add_full(G_PRIORITY_HIGH_IDLE, fixed_virtuel_idle, fv, NULL);
+}
+
+/**********************************************************************************************************
+ Nom            : fixed_virtuel_recharger()
+ Entrée         : fv - Le fixed virtuel
+ Sortie         : Aucune
+ Description    : A appeler après une modification des fils du conteneur (ajout, déplacement,
+                  changement de propriétés): recalcule la taille du canevas et l'index spatial des
+                  fils, et relie les widgets affichés à leurs noeuds.
+**********************************************************************************************************/
+void fixed_virtuel_recharger(fixed_virtuel* fv) {
+    GdkRectangle rect;
+    gint largeur = 0, hauteur = 0;
+    //Le seul passage qui lit les propriétés de tous les fils
+    detruire_index_spatial(fv->index);
+    fv->index = creer_index_spatial(INDEX_SPATIAL_CELLULE);
+    g_hash_table_remove_all(fv->noms);
+    GHashTableIter it_groupes;
+    gpointer groupe;
+    g_hash_table_iter_init(&it_groupes, fv->groupes);
+    while (g_hash_table_iter_next(&it_groupes, NULL, &groupe))
+        ((groupe_virtuel*)groupe)->actif = NULL;
+    for (Arbre* noeud = fv->conteneur->fils; noeud; noeud = noeud->frere) {
+        if (noeud->nom[0] && !g_hash_table_contains(fv->noms, noeud->nom))
+            g_hash_table_insert(fv->noms, noeud->nom, noeud);
+        //Le dernier radio coché d'un groupe est son choix, les autres sont décochés
+        if (est_radio_virtuel(noeud->type) && etat_noeud_virtuel(noeud)) {
+            groupe_virtuel* g = groupe_du_noeud(fv, noeud);
+            if (g->actif)
+                ecrire_etat_noeud_virtuel(g->actif, FALSE);
+            g->actif = noeud;
+        }
+        if (!geometrie_virtuelle(noeud, &rect))
+            continue;
+        index_spatial_placer(fv->index, noeud, &rect);
+        largeur = MAX(largeur, rect.x + rect.width);
+        hauteur = MAX(hauteur, rect.y + rect.height);
+    }
+    gtk_widget_set_size_request(fv->fixed, largeur, hauteur);
+
+    //Tout ranger: les widgets reviennent de la réserve, reliés avec les nouvelles propriétés
+    GHashTableIter iter;
+    gpointer cle, valeur;
+    g_hash_table_iter_init(&iter, fv->actifs);
+    while (g_hash_table_iter_next(&iter, &cle, &valeur)) {
+        Arbre* noeud = cle;
+        ranger_widget_virtuel(fv, noeud->type, valeur);
+        if (noeud->widget == valeur)
+            noeud->widget = NULL;
+    }
+    g_hash_table_remove_all(fv->actifs);
+    fixed_virtuel_mettre_a_jour(fv);
+}
+
+/**********************************************************************************************************
+ Nom            : fixed_virtuel_oublier()
+ Entrée         : fv    - Le fixed virtuel
+                  noeud - Un fils du conteneur qui va etre supprimé de l'arbre
+ Sortie         : Aucune
+ Description    : Range le widget du noeud s'il est matérialisé. A appeler avant de libérer le noeud.
+**********************************************************************************************************/
+void fixed_virtuel_oublier(fixed_virtuel* fv, Arbre* noeud) {
+    index_spatial_retirer(fv->index, noeud);
+    if (g_hash_table_lookup(fv->noms, noeud->nom) == noeud)
+        g_hash_table_remove(fv->noms, noeud->nom);
+    if (est_radio_virtuel(noeud->type) && groupe_du_noeud(fv, noeud)->actif == noeud)
+        groupe_du_noeud(fv, noeud)->actif = NULL;
+    GtkWidget* widget = g_hash_table_lookup(fv->actifs, noeud);
+    if (!widget)
+        return;
+    ranger_widget_virtuel(fv, noeud->type, widget);
+    if (noeud->widget == widget)
+        noeud->widget = NULL;
+    g_hash_table_remove(fv->actifs, noeud);
+}
+
+//Libère le fixed virtuel quand son scrolled window est détruit
+static void liberer_fixed_virtuel(gpointer data) {
+    fixed_virtuel* fv = data;
+    if (fv->idle_id)
+        g_source_remove(fv->idle_id);
+    g_hash_table_destroy(fv->actifs);
+    g_hash_table_destroy(fv->reserves);
+    g_hash_table_destroy(fv->groupes);
+    g_hash_table_destroy(fv->noms);
+    detruire_index_spatial(fv->index);
+    g_free(fv);
+}
+
+//Fixed virtuel d'un scrolled window créé par creer_fixed_virtuel() (NULL sinon)
+fixed_virtuel* fixed_virtuel_du_scroll(GtkWidget* scroll) {
+    return scroll ? g_object_get_data(G_OBJECT(scroll), "fixed_virtuel") : NULL;
+}
+
+//Fils du conteneur de nom 'nom' (NULL s'il n'existe pas). Ses propriétés suivent les
+//modifications faites dans les widgets, meme quand il n'est pas matérialisé.
+Arbre* fixed_virtuel_chercher(fixed_virtuel* fv, const char* nom) {
+    return fv && nom ? g_hash_table_lookup(fv->noms, nom) : NULL;
+}
+
+/**********************************************************************************************************
+ Nom            : creer_fixed_virtuel()
+ Entrée         : conteneur - Le noeud Arbre dont les fils sont à afficher
+                  marge     - Marge (px) matérialisée autour de la zone visible
+ Sortie         : Le fixed virtuel; son scrolled window (champ scroll) est à placer dans l'interface
+ Description    : Crée un GtkFixed dans un scrolled window et n'y construit que les fils visibles du
+                  conteneur. Le fixed virtuel est libéré avec son scrolled window.
+**********************************************************************************************************/
+fixed_virtuel* creer_fixed_virtuel(Arbre* conteneur, gint marge) {
+    if (!conteneur) {
+        g_print("Conteneur du fixed virtuel NULL\n");
+        return NULL;
+    }
+    fabriques_virtuelles_par_defaut();
+
+    fixed_virtuel* fv = g_new0(fixed_virtuel, 1);
+    fv->conteneur = conteneur;
+    fv->marge = marge;
+    fv->actifs = g_hash_table_new(g_direct_hash, g_direct_equal);
+    fv->reserves = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                         (GDestroyNotify)g_queue_free);
+    fv->groupes = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, liberer_groupe_virtuel);
+    fv->noms = g_hash_table_new(g_str_hash, g_str_equal);
+
+    fv->scroll = gtk_scrolled_window_new(NULL, NULL);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(fv->scroll),
+                                   GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+    fv->fixed = gtk_fixed_new();
+    gtk_container_add(GTK_CONTAINER(fv->scroll), fv->fixed);
+    g_object_set_data_full(G_OBJECT(fv->scroll), "fixed_virtuel", fv, liberer_fixed_virtuel);
+
+    //value-changed: défilement; changed: taille de la page (redimensionnement)
+    GtkAdjustment* h = gtk_scrolled_window_get_hadjustment(GTK_SCROLLED_WINDOW(fv->scroll));
+    GtkAdjustment* v = gtk_scrolled_window_get_vadjustment(GTK_SCROLLED_WINDOW(fv->scroll));
+    g_signal_connect(h, "value-changed", G_CALLBACK(planifier_fixed_virtuel), fv);
+    g_signal_connect(v, "value-changed", G_CALLBACK(planifier_fixed_virtuel), fv);
+    g_signal_connect(h, "changed", G_CALLBACK(planifier_fixed_virtuel), fv);
+    g_signal_connect(v, "changed", G_CALLBACK(planifier_fixed_virtuel), fv);
+
+    fixed_virtuel_recharger(fv);
+    return fv;
+}
+
+
+#endif //TEST1_FIXED_VIRTUEL_H
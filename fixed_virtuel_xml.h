@@ -0,0 +1,113 @@
+//
+// Created by ACER on 06/01/2025.
+//
+
+#ifndef TEST1_FIXED_VIRTUEL_XML_H
+#define TEST1_FIXED_VIRTUEL_XML_H
+
+#include <gtk/gtk.h>
+#include "xml_utility.h"
+#include "fixed_virtuel.h"
+
+//Marge (px) matérialisée autour de la zone visible quand le XML n'en donne pas
+#define FIXED_VIRTUEL_MARGE_DEFAUT 200
+
+//Balise d'un fils du <fixedvirtuel> -> type de son noeud (WIDGET_UNKNOWN si non virtualisable)
+static WidgetType type_fils_virtuel(int id)
+{
+    switch(id)
+    {
+        case 2: return WIDGET_BUTTON_NORMAL;
+        case 3: return WIDGET_CHECKBOX;
+        case 4: return WIDGET_RADIO;
+        case 5: return WIDGET_LABEL;
+        case 21: return WIDGET_ENTRY_BASIC;
+        default: return WIDGET_UNKNOWN;
+    }
+}
+
+//Libère le noeud du conteneur et ses fils. supprimer_noeud() n'est pas utilisé: il lit le
+//widget des noeuds, et les widgets matérialisés sont déjà détruits avec le scrolled window.
+static void liberer_arbre_virtuel(gpointer data)
+{
+    Arbre *racine = data;
+    Arbre *noeud = racine->fils;
+    while(noeud)
+    {
+        Arbre *suivant = noeud->frere;
+        memoire_liberer(noeud);
+        noeud = suivant;
+    }
+    memoire_liberer(racine);
+}
+
+/*********************************************************************************
+ -Nom : fixed_virtuel_xml
+ -Entrees : File *file : pointeur sur le fichier text,
+            int parent : indice de parent
+ -Sortie: -
+ -Description: Crée un fixed virtuel (fixed_virtuel.h) pour un très grand formulaire.
+ Les propriétés lues avant <children> sont celles du conteneur (nom, x, y, width,
+ height, marge); chaque <button>, <checkbox>, <radio>, <label> ou <entry> de
+ <children> devient un noeud Arbre qui garde toutes ses propriétés, sans créer de
+ widget: seuls les fils visibles sont construits à l'affichage.
+ Les radios d'un meme groupe ont la meme propriété "groupe".
+ L'Arbre appartient au scrolled window et est libéré avec lui.
+*********************************************************************************/
+void fixed_virtuel_xml(FILE *file, int parent)
+{
+    int test;
+    char nom[MAX_PROP_NAME], valeur[MAX_PROP_VALUE];
+    Arbre *racine = allouer_arbre("", NULL, NULL, NULL, 1);
+    racine->type = WIDGET_SCROLLED_WINDOW;
+    Arbre *courant = racine, *dernier = NULL;
+
+    //Jusqu'à </fixedvirtuel> (ou la fin du fichier)
+    while((test = balise(file)) != -38 && !feof(file))
+    {
+        //propriété du conteneur (avant le premier fils) ou du fils en cours
+        if(test == 22)
+        {
+            Epeurerblanc(file);
+            fseek(file, 6, SEEK_CUR);
+            fscanf(file, "%63s", nom); //MAX_PROP_NAME - 1 caractères au plus
+            char *guillemet = strchr(nom, '"');
+            if(guillemet) *guillemet = '\0';
+            lire_gchar_str_borne(file, valeur, sizeof(valeur));
+            set_property_of_node(courant, nom, valeur);
+            if(!strcmp(nom, "nom"))
+                g_strlcpy(courant->nom, valeur, sizeof(courant->nom));
+            else if(!strcmp(nom, "type") && courant->type == WIDGET_ENTRY_BASIC && !strcmp(valeur, "pass"))
+                courant->type = WIDGET_ENTRY_PASSWORD;
+        }
+        //début d'un fils: chainé après le précédent (insererArbre reparcourt tous les frères)
+        else if(type_fils_virtuel(test) != WIDGET_UNKNOWN)
+        {
+            courant = allouer_arbre("", NULL, NULL, NULL, 0);
+            courant->type = type_fils_virtuel(test);
+            if(dernier) dernier->frere = courant; else racine->fils = courant;
+            dernier = courant;
+        }
+    }
+
+    const char *marge = get_property_of_node(racine, "marge");
+    fixed_virtuel *fv = creer_fixed_virtuel(racine, marge ? atoi(marge) : FIXED_VIRTUEL_MARGE_DEFAUT);
+    g_object_set_data_full(G_OBJECT(fv->scroll), "arbre_virtuel", racine, liberer_arbre_virtuel);
+    if(racine->nom[0]) gtk_widget_set_name(fv->scroll, racine->nom);
+
+    //placer le scrolled window comme le ferait un <fixed>, ou à sa position dans un fixed
+    GdkRectangle rect;
+    gboolean place = get_node_geometry(racine, &rect);
+    gtk_widget_set_size_request(fv->scroll, rect.width, rect.height);
+    if(GTK_IS_FIXED(parents[parent]))
+        gtk_fixed_put(GTK_FIXED(parents[parent]), fv->scroll, place ? rect.x : 0, place ? rect.y : 0);
+    else if(hasOverlay==1 && parent==0)
+        gtk_overlay_add_overlay(GTK_OVERLAY(overlay), fv->scroll);
+    else
+        gtk_container_add(GTK_CONTAINER(parents[parent]), fv->scroll);
+    afficher_plus_tard(fv->scroll);
+    TRACER(TRACE_XML, TRACE_INFO, "fixed virtuel '%s': %d fils", racine->nom, compterNoeuds(racine->fils));
+    creer_object(file, parent);
+}//fin de la fonction fixed_virtuel_xml
+
+#endif //TEST1_FIXED_VIRTUEL_XML_H
@@ -7,10 +7,17 @@
 #include "stdio.h"
 #include "stdlib.h"
 #include "gtk/gtk.h"
+#include "trace.h"
+#include "memoire.h"
+#include "pool_travail.h"
 #define MAX 200
 #include "coordonnees.h"
 #include "dimension.h"
 #include "colors.h"
+#include "style.h"
+#include "pixbuf_cache.h"
+#include "affichage.h"
+#include "index_spatial.h"
 #include "image.h"
 #include "icone.h"
 #include "window.h"
@@ -14,16 +14,15 @@ typedef struct ic{
 
 GdkPixbuf* create_icon_from_file(const gchar file_path[50])
 {
-    GdkPixbuf *icon;
-    GError *error = NULL;
-    icon = gdk_pixbuf_new_from_file(file_path, &error);
-    if (error != NULL)
+    //L'icone est décodée une seule fois et partagée via le cache des pixbufs
+    //(la référence retournée appartient à l'appelant)
+    GdkPixbuf *icon = cache_pixbuf_obtenir(file_path, -1, -1);
+    if (icon == NULL)
     {
         // Affichage de l'erreur en cas d'échec du chargement de l'icône
-        g_printerr("Erreur lors du chargement de l'icône : %s\n", error->message);
-        g_error_free(error);
+        g_printerr("Erreur lors du chargement de l'icône : %s\n", file_path);
         return NULL;
-    }//FIn if (error != NULL)
+    }//FIn if (icon == NULL)
     return icon;
 }//FIN fonction create_icon_from_file()
 
@@ -18,6 +18,7 @@ typedef struct img {
 } MonImage;
 
 // Fonction pour redimensionner une image
+// L'image est redimensionnée sur place: le widget retourné est celui passé en parametre.
 GtkWidget* redimensionner_image(GtkWidget *image, gint width, gint height) {
     if (!image) {
         g_print("\nErreur : image invalide.\n");
@@ -36,9 +37,9 @@ GtkWidget* redimensionner_image(GtkWidget *image, gint width, gint height) {
         return NULL;
     }
 
-    GtkWidget *resized_image = gtk_image_new_from_pixbuf(scaled_pixbuf);
-    //g_object_unref(scaled_pixbuf); // Libération du pixbuf redimensionné
-    return resized_image;
+    gtk_image_set_from_pixbuf(GTK_IMAGE(image), scaled_pixbuf);
+    g_object_unref(scaled_pixbuf); // Libération du pixbuf redimensionné (le GtkImage garde sa référence)
+    return image;
 }
 
 // Fonction pour créer une image
@@ -48,7 +49,7 @@ MonImage* init_image(const gchar path[300], dimension dim, coordonnees cord) {
         return NULL;
     }
 
-    MonImage *new_img = (MonImage *)malloc(sizeof(MonImage));
+    MonImage *new_img = (MonImage *)memoire_allouer(MEMOIRE_IMAGES, sizeof(MonImage));
     if (!new_img) {
         g_print("\nErreur d'allocation mémoire pour MonImage.\n");
         return NULL;
@@ -72,17 +73,10 @@ void creer_image(MonImage *img){
         exit(EXIT_FAILURE);
     }
 
-img->Image = gtk_image_new_from_file(img->path);
-    if (!img->Image) {
-        g_print("\nErreur .\n");
-        exit(EXIT_FAILURE);
-    }
-    img->Image= redimensionner_image(GTK_WIDGET(img->Image),img->dim.width,img->dim.height);
-    if (!img->Image) {
-        g_print("\nErreur lors du redimensionnement de l'image.\n");
-
-        exit(EXIT_FAILURE);
-    }
+    //L'image est décodée en arriere plan (espace réservé en attendant) et partagée
+    //via le cache des pixbufs
+    img->Image = gtk_image_new();
+    cache_pixbuf_charger_async(GTK_IMAGE(img->Image), img->path, img->dim.width, img->dim.height);
 }
 
 
@@ -15,16 +15,20 @@
 /*************************MACORS***************************/
 //Certains sont utils, permettant de réduire le nombre de paramétres en retirant ceux indésirable.
 //Et certains sert juste à simplifier l'écriture et l'appel de certains fonctions.
-#define dim(width,height) creer_dimension(height, width)
+//dim(), cord(), margin() et spinObj() ne font aucune allocation: ils retournent l'adresse d'une
+//valeur temporaire (littéral composé) qui vit jusqu'à la fin du bloc de l'appelant. Les fonctions
+//d'initialisation (initBtn, init_label, init_styled_box...) en gardent une copie.
+//Pour garder la valeur au-delà du bloc, utiliser creer_dimension, create_coordonnees...
+#define dim(w,h) (&(dimension){ .height = (h), .width = (w) })
 //#define pos(x,y) creer_position(x, y)
-#define margin(top,right,bottom,left) creer_margin(top,right,bottom,left)
-#define cord(x,y) create_coordonnees(x,y)
+#define margin(top,right,bottom,left) (&(Margin){ .mleft = (left), .mright = (right), .mtop = (top), .mbottom = (bottom) })
+#define cord(px,py) (&(coordonnees){ .x = (px), .y = (py) })
 //Macro pour un spin qui comporte des entiers naturels, elle a comme borne sup: 100 et borne inf: -100
-#define spinObj(start, step)  createSpinObj(start, -100, 100, step, 0)
+#define spinObj(debut, pas)  (&(spinObj){ .start = (debut), .borneInf = -100, .borneSup = 100, .step = (pas), .digits = 0 })
 //Les valeurs par défaults
-#define DEFAULT_BTN_DIM dim(8, 8) //La dimension par défaut d'un bouton
-#define DEFAULT_BTN_POS cord(0, 0) //La position par défaut d'un bouton
-#define DEFAULT_BTN_MARGIN margin(0,0,0,0);//La margine par défaut d'un bouton
+#define DEFAULT_BTN_DIM (dimension){ .height = 8, .width = 8 } //La dimension par défaut d'un bouton
+#define DEFAULT_BTN_POS (coordonnees){ .x = 0, .y = 0 } //La position par défaut d'un bouton
+#define DEFAULT_BTN_MARGIN (Margin){ 0 }//La margine par défaut d'un bouton
 /*******IMAGE**********/
 //Le macro dim(x,y) retourne un pointeur vers une dimension, cependant
 // la fonction creer_image a besoin d'un passage par valeur, quant aux coordonnées ils ne sont
@@ -74,12 +78,12 @@ typedef struct margin{
     gint mbottom;//margin bottom
 }Margin;
 
-// fonction pour creer margine
+// fonction pour creer margine (initBtn copie la marge: libérer avec memoire_liberer)
 
 Margin* creer_margin(gint mtop, gint mright,gint mbottom, gint mleft)
 {
     //Allocation
-    Margin *mar=(Margin *) malloc(sizeof (Margin ));
+    Margin *mar=(Margin *) memoire_allouer(MEMOIRE_WIDGETS, sizeof (Margin ));
     //Si Erreur d'allocation alors sortir avec un code d'erreur
     if(mar == NULL){
         g_print("\n Erreur d'allocation ");
@@ -104,10 +108,11 @@ typedef struct spinObj{
 }spinObj;
 
 //Creation et initialisation et retourne d'un objet de type spinObj
+//(initBtn copie l'objet: libérer avec memoire_liberer)
 spinObj* createSpinObj(gdouble start, gdouble borneInf, gdouble borneSup, gdouble step, guint digits)
 {
     //Allocation
-    spinObj *sp=(spinObj *) malloc(sizeof (spinObj ));
+    spinObj *sp=(spinObj *) memoire_allouer(MEMOIRE_WIDGETS, sizeof (spinObj ));
     //Si Erreur d'allocation alors sortir avec un code d'erreur
     if(sp == NULL){
         g_print("\n Erreur d'allocation de spinObj");
@@ -0,0 +1,323 @@
+//
+// Created by ACER on 06/01/2025.
+//
+
+#ifndef TEST1_INDEX_SPATIAL_H
+#define TEST1_INDEX_SPATIAL_H
+#include "global.h"
+
+//Index spatial des widgets d'un GtkFixed (grille uniforme).
+//Le plan est découpé en cellules carrées; chaque rectangle est rangé dans les cellules qu'il
+//couvre. Une recherche (point, rectangle, voisins) ne regarde que les cellules de la zone
+//demandée au lieu de parcourir tous les fils du conteneur: le cout dépend de la densité
+//locale, pas du nombre total de widgets.
+
+//Coté d'une cellule (px): de l'ordre de la taille d'un widget courant
+#define INDEX_SPATIAL_CELLULE 64
+
+typedef struct {
+    gpointer cle;           // Objet indexé (un GtkWidget pour les fixed)
+    GdkRectangle rect;      // Position et taille
+    guint ordre;            // Ordre d'ajout: le dernier ajouté est dessiné au-dessus
+    guint marque;           // Dernière recherche qui a rendu l'entrée (dédoublonnage)
+} entree_spatiale;
+
+typedef struct {
+    gint taille_cellule;
+    GHashTable* cellules;   // numéro de cellule -> GPtrArray* d'entree_spatiale
+    GHashTable* entrees;    // cle -> entree_spatiale*
+    guint ordre;            // Compteur d'ajouts
+    guint marque;           // Compteur de recherches
+} index_spatial;
+
+
+/**********************************************************************************************************
+ Nom            : creer_index_spatial()
+ Entrée         : taille_cellule - Coté (px) des cellules de la grille
+ Sortie         : Un index vide
+**********************************************************************************************************/
+index_spatial* creer_index_spatial(gint taille_cellule) {
+    index_spatial* idx = g_new0(index_spatial, 1);
+    idx->taille_cellule = taille_cellule > 0 ? taille_cellule : INDEX_SPATIAL_CELLULE;
+    idx->cellules = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                          (GDestroyNotify)g_ptr_array_unref);
+    idx->entrees = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    return idx;
+}
+
+void detruire_index_spatial(index_spatial* idx) {
+    if (!idx) return;
+    g_hash_table_destroy(idx->cellules);
+    g_hash_table_destroy(idx->entrees);
+    g_free(idx);
+}
+
+//Numéro d'une cellule: colonne et ligne sur 16 bits chacune (les collisions au-delà ne
+//coutent qu'un test d'intersection de plus)
+static gpointer cellule_spatiale(gint colonne, gint ligne) {
+    return GUINT_TO_POINTER(((guint)(colonne & 0xFFFF) << 16) | (guint)(ligne & 0xFFFF));
+}
+
+//Division arrondie vers le bas (les coordonnées peuvent etre négatives)
+static gint division_spatiale(gint a, gint t) {
+    return a >= 0 ? a / t : -((-a + t - 1) / t);
+}
+
+//Plage de cellules couverte par un rectangle
+static void plage_spatiale(index_spatial* idx, const GdkRectangle* r,
+                           gint* c0, gint* l0, gint* c1, gint* l1) {
+    gint t = idx->taille_cellule;
+    *c0 = division_spatiale(r->x, t);
+    *l0 = division_spatiale(r->y, t);
+    *c1 = division_spatiale(r->x + MAX(r->width, 1) - 1, t);
+    *l1 = division_spatiale(r->y + MAX(r->height, 1) - 1, t);
+}
+
+static void ranger_entree_spatiale(index_spatial* idx, entree_spatiale* e) {
+    gint c0, l0, c1, l1;
+    plage_spatiale(idx, &e->rect, &c0, &l0, &c1, &l1);
+    for (gint c = c0; c <= c1; c++)
+        for (gint l = l0; l <= l1; l++) {
+            GPtrArray* cellule = g_hash_table_lookup(idx->cellules, cellule_spatiale(c, l));
+            if (!cellule) {
+                cellule = g_ptr_array_new();
+                g_hash_table_insert(idx->cellules, cellule_spatiale(c, l), cellule);
+            }
+            g_ptr_array_add(cellule, e);
+        }
+}
+
+static void sortir_entree_spatiale(index_spatial* idx, entree_spatiale* e) {
+    gint c0, l0, c1, l1;
+    plage_spatiale(idx, &e->rect, &c0, &l0, &c1, &l1);
+    for (gint c = c0; c <= c1; c++)
+        for (gint l = l0; l <= l1; l++) {
+            GPtrArray* cellule = g_hash_table_lookup(idx->cellules, cellule_spatiale(c, l));
+            if (!cellule) continue;
+            g_ptr_array_remove_fast(cellule, e);
+            if (cellule->len == 0)
+                g_hash_table_remove(idx->cellules, cellule_spatiale(c, l));
+        }
+}
+
+/**********************************************************************************************************
+ Nom            : index_spatial_placer()
+ Entrée         : idx  - L'index
+                  cle  - L'objet à placer
+                  rect - Sa position et sa taille
+ Sortie         : Aucune
+ Description    : Ajoute l'objet, ou le déplace s'il est déjà indexé. Un objet déplacé garde sa
+                  place dans l'ordre d'empilement.
+**********************************************************************************************************/
+void index_spatial_placer(index_spatial* idx, gpointer cle, const GdkRectangle* rect) {
+    entree_spatiale* e = g_hash_table_lookup(idx->entrees, cle);
+    if (e) {
+        if (gdk_rectangle_equal(&e->rect, rect))
+            return;
+        sortir_entree_spatiale(idx, e);
+    } else {
+        e = g_new0(entree_spatiale, 1);
+        e->cle = cle;
+        e->ordre = ++idx->ordre;
+        g_hash_table_insert(idx->entrees, cle, e);
+    }
+    e->rect = *rect;
+    ranger_entree_spatiale(idx, e);
+}
+
+void index_spatial_retirer(index_spatial* idx, gpointer cle) {
+    entree_spatiale* e = g_hash_table_lookup(idx->entrees, cle);
+    if (!e) return;
+    sortir_entree_spatiale(idx, e);
+    g_hash_table_remove(idx->entrees, cle);
+}
+
+//Rectangle indexé d'un objet (FALSE s'il n'est pas dans l'index)
+gboolean index_spatial_rectangle(index_spatial* idx, gpointer cle, GdkRectangle* rect) {
+    entree_spatiale* e = g_hash_table_lookup(idx->entrees, cle);
+    if (!e) return FALSE;
+    *rect = e->rect;
+    return TRUE;
+}
+
+static gint comparer_ordre_spatial(gconstpointer a, gconstpointer b) {
+    const entree_spatiale* ea = *(entree_spatiale* const*)a;
+    const entree_spatiale* eb = *(entree_spatiale* const*)b;
+    return (ea->ordre > eb->ordre) - (ea->ordre < eb->ordre);
+}
+
+/**********************************************************************************************************
+ Nom            : index_spatial_chercher()
+ Entrée         : idx  - L'index
+                  zone - Le rectangle de recherche
+ Sortie         : Tableau des objets qui coupent la zone, du dessous vers le dessus
+                  (à libérer avec g_ptr_array_free(resultat, TRUE))
+ Description    : Sert à la sélection par rectangle et à la détection des chevauchements.
+**********************************************************************************************************/
+GPtrArray* index_spatial_chercher(index_spatial* idx, const GdkRectangle* zone) {
+    GPtrArray* trouvees = g_ptr_array_new();
+    gint c0, l0, c1, l1;
+    guint marque = ++idx->marque;
+    plage_spatiale(idx, zone, &c0, &l0, &c1, &l1);
+    for (gint c = c0; c <= c1; c++)
+        for (gint l = l0; l <= l1; l++) {
+            GPtrArray* cellule = g_hash_table_lookup(idx->cellules, cellule_spatiale(c, l));
+            if (!cellule) continue;
+            for (guint i = 0; i < cellule->len; i++) {
+                entree_spatiale* e = g_ptr_array_index(cellule, i);
+                if (e->marque == marque || !gdk_rectangle_intersect(&e->rect, zone, NULL))
+                    continue;
+                e->marque = marque;
+                g_ptr_array_add(trouvees, e);
+            }
+        }
+    g_ptr_array_sort(trouvees, comparer_ordre_spatial);
+
+    GPtrArray* resultat = g_ptr_array_sized_new(trouvees->len);
+    for (guint i = 0; i < trouvees->len; i++)
+        g_ptr_array_add(resultat, ((entree_spatiale*)g_ptr_array_index(trouvees, i))->cle);
+    g_ptr_array_free(trouvees, TRUE);
+    return resultat;
+}
+
+/**********************************************************************************************************
+ Nom            : index_spatial_au_point()
+ Entrée         : idx  - L'index
+                  x, y - Le point (par exemple la position du curseur)
+ Sortie         : L'objet le plus haut sous le point, NULL s'il n'y en a pas
+**********************************************************************************************************/
+gpointer index_spatial_au_point(index_spatial* idx, gint x, gint y) {
+    gint t = idx->taille_cellule;
+    GPtrArray* cellule = g_hash_table_lookup(idx->cellules,
+                                             cellule_spatiale(division_spatiale(x, t),
+                                                              division_spatiale(y, t)));
+    entree_spatiale* dessus = NULL;
+    if (!cellule) return NULL;
+    for (guint i = 0; i < cellule->len; i++) {
+        entree_spatiale* e = g_ptr_array_index(cellule, i);
+        if (x >= e->rect.x && x < e->rect.x + e->rect.width &&
+            y >= e->rect.y && y < e->rect.y + e->rect.height &&
+            (!dessus || e->ordre > dessus->ordre))
+            dessus = e;
+    }
+    return dessus ? dessus->cle : NULL;
+}
+
+//Objets qui chevauchent cle (tableau vide si aucun, à libérer avec g_ptr_array_free)
+GPtrArray* index_spatial_chevauchements(index_spatial* idx, gpointer cle) {
+    entree_spatiale* e = g_hash_table_lookup(idx->entrees, cle);
+    if (!e) return g_ptr_array_new();
+    GPtrArray* resultat = index_spatial_chercher(idx, &e->rect);
+    g_ptr_array_remove(resultat, cle);
+    return resultat;
+}
+
+//Garde le décalage le plus petit (en valeur absolue) qui aligne a sur b à moins de seuil
+static void aimanter_bord(gint a, gint b, gint seuil, gint* meilleur) {
+    gint d = b - a;
+    if (ABS(d) <= seuil && ABS(d) < ABS(*meilleur))
+        *meilleur = d;
+}
+
+/**********************************************************************************************************
+ Nom            : index_spatial_aimanter()
+ Entrée         : idx   - L'index
+                  cle   - L'objet déplacé (ignoré dans la recherche des voisins, peut etre NULL)
+                  rect  - La position voulue; corrigée en sortie
+                  seuil - Distance maximale (px) d'aimantation
+ Sortie         : TRUE si rect a été déplacé
+ Description    : Aligne les bords gauche/droit et haut/bas de rect sur ceux des voisins proches
+                  (bord à bord ou dans le prolongement), indépendamment sur chaque axe.
+**********************************************************************************************************/
+gboolean index_spatial_aimanter(index_spatial* idx, gpointer cle, GdkRectangle* rect, gint seuil) {
+    GdkRectangle zone = {rect->x - seuil, rect->y - seuil,
+                         rect->width + 2 * seuil, rect->height + 2 * seuil};
+    GPtrArray* voisins = index_spatial_chercher(idx, &zone);
+    gint dx = seuil + 1, dy = seuil + 1;
+
+    for (guint i = 0; i < voisins->len; i++) {
+        gpointer voisin = g_ptr_array_index(voisins, i);
+        entree_spatiale* v = g_hash_table_lookup(idx->entrees, voisin);
+        if (voisin == cle || !v) continue;
+        gint gauche = rect->x, droite = rect->x + rect->width;
+        gint haut = rect->y, bas = rect->y + rect->height;
+        aimanter_bord(gauche, v->rect.x, seuil, &dx);
+        aimanter_bord(gauche, v->rect.x + v->rect.width, seuil, &dx);
+        aimanter_bord(droite, v->rect.x, seuil, &dx);
+        aimanter_bord(droite, v->rect.x + v->rect.width, seuil, &dx);
+        aimanter_bord(haut, v->rect.y, seuil, &dy);
+        aimanter_bord(haut, v->rect.y + v->rect.height, seuil, &dy);
+        aimanter_bord(bas, v->rect.y, seuil, &dy);
+        aimanter_bord(bas, v->rect.y + v->rect.height, seuil, &dy);
+    }
+    g_ptr_array_free(voisins, TRUE);
+
+    gboolean deplace = FALSE;
+    if (ABS(dx) <= seuil && dx != 0) { rect->x += dx; deplace = TRUE; }
+    if (ABS(dy) <= seuil && dy != 0) { rect->y += dy; deplace = TRUE; }
+    return deplace;
+}
+
+
+//Index des fils d'un GtkFixed, créé à la première utilisation et libéré avec le fixed
+index_spatial* index_spatial_du_fixed(GtkWidget* fixed) {
+    index_spatial* idx = g_object_get_data(G_OBJECT(fixed), "index_spatial");
+    if (!idx) {
+        idx = creer_index_spatial(INDEX_SPATIAL_CELLULE);
+        g_object_set_data_full(G_OBJECT(fixed), "index_spatial", idx,
+                               (GDestroyNotify)detruire_index_spatial);
+    }
+    return idx;
+}
+
+//Un widget détruit sans passer par desindexer_widget_fixed() sort quand meme de l'index
+static void on_widget_indexe_detruit(GtkWidget* widget, gpointer fixed) {
+    index_spatial* idx = g_object_get_data(G_OBJECT(fixed), "index_spatial");
+    if (idx) index_spatial_retirer(idx, widget);
+}
+
+//Retire un widget de l'index de son fixed (avant de l'enlever du conteneur)
+void desindexer_widget_fixed(GtkWidget* widget) {
+    GtkWidget* fixed = g_object_get_data(G_OBJECT(widget), "index_spatial_fixed");
+    if (!fixed) return;
+    index_spatial* idx = g_object_get_data(G_OBJECT(fixed), "index_spatial");
+    if (idx) index_spatial_retirer(idx, widget);
+}
+
+
+/**********************************************************************************************************
+ Nom            : indexer_widget_fixed()
+ Entrée         : widget - Un fils d'un GtkFixed
+                  rect   - Reçoit la position et la taille indexées (peut etre NULL)
+ Sortie         : FALSE si le widget n'est pas dans un GtkFixed
+ Description    : Lit la position du widget dans son fixed et sa taille (demandée, sinon naturelle)
+                  et met l'index du fixed à jour. A rappeler après chaque déplacement.
+**********************************************************************************************************/
+gboolean indexer_widget_fixed(GtkWidget* widget, GdkRectangle* rect) {
+    GtkWidget* fixed = gtk_widget_get_parent(widget);
+    GdkRectangle r;
+    if (!fixed || !GTK_IS_FIXED(fixed))
+        return FALSE;
+
+    gtk_container_child_get(GTK_CONTAINER(fixed), widget, "x", &r.x, "y", &r.y, NULL);
+    gtk_widget_get_size_request(widget, &r.width, &r.height);
+    if (r.width < 0 || r.height < 0) {
+        GtkRequisition naturelle;
+        gtk_widget_get_preferred_size(widget, NULL, &naturelle);
+        if (r.width < 0) r.width = naturelle.width;
+        if (r.height < 0) r.height = naturelle.height;
+    }
+
+    //Widget passé d'un fixed à un autre: il quitte l'ancien index
+    GtkWidget* ancien = g_object_get_data(G_OBJECT(widget), "index_spatial_fixed");
+    if (ancien != fixed) {
+        if (ancien) desindexer_widget_fixed(widget);
+        g_object_set_data(G_OBJECT(widget), "index_spatial_fixed", fixed);
+        g_signal_connect_object(widget, "destroy", G_CALLBACK(on_widget_indexe_detruit), fixed, 0);
+    }
+    index_spatial_placer(index_spatial_du_fixed(fixed), widget, &r);
+    if (rect) *rect = r;
+    return TRUE;
+}
+
+#endif //TEST1_INDEX_SPATIAL_H
@@ -14,13 +14,14 @@ typedef struct {
     GtkWidget *elem;       // Widget du label
     gchar *texte;          // Texte du label
     gchar *titre;          // Titre du label
-    coordonnees* Crd;       // Coordonnées du label
-    dimension* dim;         // Dimensions du label
+    coordonnees Crd;        // Coordonnées du label
+    dimension dim;          // Dimensions du label (-1: taille naturelle)
     GtkWidget* container;
     char* color;
     gboolean bold;
     char* taille;
     char* police;
+    SharedStyle* style;    // Style partagé (classe CSS commune aux labels identiques)
 } Monlabel;
 
 
@@ -32,7 +33,7 @@ Monlabel *init_label(const gchar *texte, const gchar *tit, coordonnees* C, dimen
         exit(-1);
     }
 
-    Monlabel *L = (Monlabel *)malloc(sizeof(Monlabel));
+    Monlabel *L = (Monlabel *)memoire_allouer(MEMOIRE_WIDGETS, sizeof(Monlabel));
     if (!L) {
         printf("Erreur d'allocation mémoire pour le label.\n");
         exit(-1);
@@ -40,7 +41,7 @@ Monlabel *init_label(const gchar *texte, const gchar *tit, coordonnees* C, dimen
 
     // Allocation et initialisation du titre
     if (tit) {
-        L->titre = (gchar *)malloc(30 * sizeof(gchar));
+        L->titre = (gchar *)memoire_allouer(MEMOIRE_WIDGETS, 30 * sizeof(gchar));
         if (!L->titre) {
             printf("Erreur d'allocation mémoire pour le titre du label.\n");
             exit(-1);
@@ -51,67 +52,79 @@ Monlabel *init_label(const gchar *texte, const gchar *tit, coordonnees* C, dimen
     }
 
     // Allocation et initialisation du texte
-    L->texte = (gchar *)malloc(300 * sizeof(gchar));
+    L->texte = (gchar *)memoire_allouer(MEMOIRE_WIDGETS, 300 * sizeof(gchar));
     if (!L->texte) {
         printf("Erreur d'allocation mémoire pour le texte du label.\n");
         exit(-1);
     }
     strcpy(L->texte, texte);
 
-    // Initialisation des coordonnées et dimensions
-    L->Crd = C;
-    L->dim = D;
+    // Initialisation des coordonnées et dimensions (copiées)
+    L->Crd = C ? *C : (coordonnees){0, 0};
+    L->dim = D ? *D : (dimension){-1, -1};
     L->container = container;
 
     L-> color= color;
     L-> bold = bold;
     L-> taille = taille;
     L->police= police;
+    L->style = NULL;
 
     return L;
 }
 
+// Fonction pour libérer un Monlabel: texte, titre et style partagé.
+// Appelée à la destruction du label (voir creer_label). Les chaines de style (color, taille,
+// police) appartiennent à l'appelant.
+void liberer_label(gpointer data) {
+    Monlabel *L = (Monlabel *)data;
+    if (!L)
+        return;
+    memoire_liberer(L->texte);
+    memoire_liberer(L->titre);
+    liberer_style_partage(L->style);
+    memoire_liberer(L);
+}
+
 // Fonction pour créer un label GTK à partir d'un objet Monlabel
 Monlabel *creer_label(Monlabel *L) {
+    TRACE_SPAN_DEBUT(debut);
     L->elem = gtk_label_new(L->texte);
+    // Le label possède sa structure: elle est libérée à sa destruction
+    memoire_attacher(L->elem, L, liberer_label);
 
     if (L->titre) {
         gtk_widget_set_name(L->elem, L->titre);
     }
 
-    if(L->dim)
-        gtk_widget_set_size_request(L->elem, L->dim->width, L->dim->height);
+    gtk_widget_set_size_request(L->elem, L->dim.width, L->dim.height);
 
     if(GTK_IS_FIXED(L->container)){
-        gtk_fixed_put(GTK_FIXED(L->container), L->elem, L->Crd->x, L->Crd->y);
+        gtk_fixed_put(GTK_FIXED(L->container), L->elem, L->Crd.x, L->Crd.y);
     }
     gtk_container_add(GTK_CONTAINER(L->container), L->elem);
 
 
 
-    //Regler style
-    GtkCssProvider *provider = gtk_css_provider_new();
-
-    char* css = g_strdup_printf("#%s { color: %s ; \
-                                        font-size: %s;\
-                                        font-family: %s;\
-                                        font-weight: %s \
-                                        }",
-                          L->titre, L->color, L->taille, L->police, L->bold == 1? "bold": "normal");
-
-    // Load the CSS into the provider
-    gtk_css_provider_load_from_data(provider, css, -1, NULL);
-
-    // Get the style context of the button
-    GtkStyleContext *context = gtk_widget_get_style_context(L->elem);
-    gtk_style_context_add_provider(context,
-                                   GTK_STYLE_PROVIDER(provider),
-                                   GTK_STYLE_PROVIDER_PRIORITY_USER);
-
-    // Free allocated memory
-    g_free(css);
-    g_object_unref(provider);
+    //Regler style: les labels ayant les memes valeurs partagent une seule classe CSS
+    HexColor couleur;
+    couleur.color = NULL;
+    g_strlcpy(couleur.hex_code, L->color ? L->color : "", sizeof(couleur.hex_code));
+    Style st;
+    st.police = (L->police && L->police[0] != '\0') ? L->police : NULL;
+    st.color = (L->color && L->color[0] != '\0') ? &couleur : NULL;
+    st.taille = (L->taille && L->taille[0] != '\0') ? atoi(L->taille) : -1;
+    st.gras = L->bold == 1 ? 1 : 0;
+    st.bgcolor = NULL;
+    st.border = -1;
+    st.border_radius = -1;
+
+    SharedStyle* ancien = L->style;
+    L->style = intern_style(&st);
+    appliquer_style_partage(L->elem, L->style);
+    liberer_style_partage(ancien);
     //Fin style
+    TRACE_SPAN_FIN(debut, TRACE_AFFICHAGE, "creer_label");
     return L;
 }
 
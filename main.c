@@ -7,6 +7,8 @@
 #include "radio_xml.h"
 #include "taha_template.h"
 #include "box.h"
+#include "menu_xml.h"
+#include "fixed_virtuel_xml.h"
 #include "app_data.h"
 #include "widget_types.h"
 // #include "forms.h"
@@ -17,14 +19,15 @@
 #include "property_panel.h"
 #include "dialogs.h"
 #include "callbacks.h"
-#include "menu.h"
 #include "menu_dialog.h"
 #include "tree_sync.h"
 #include "entry_editing.h"
+#include "open_layout.h"
 
 void on_open_file_button_clicked(GtkWidget *button, gpointer user_data) {
     GtkWidget *file_dialog;
-    GtkWindow *parent_window = GTK_WINDOW(user_data);
+    GtkWidget *container = GTK_WIDGET(user_data);
+    GtkWindow *parent_window = GTK_WINDOW(gtk_widget_get_toplevel(container));
 
     // Créer la boîte de dialogue FileChooser
     file_dialog = gtk_file_chooser_dialog_new("Ouvrir un fichier",
@@ -42,6 +45,8 @@ void on_open_file_button_clicked(GtkWidget *button, gpointer user_data) {
         // Récupérer le chemin du fichier sélectionné
         filename = gtk_file_chooser_get_filename(chooser);
         g_print("Fichier sélectionné : %s\n", filename);
+        //Chargement en arrière-plan: la fenetre reste utilisable, la barre montre l'avancement
+        open_layout_start(filename, container, NULL);
 
         // Libérer la mémoire
         g_free(filename);
@@ -54,6 +59,8 @@ void on_open_file_button_clicked(GtkWidget *button, gpointer user_data) {
 int main(int argc, char *argv[]) {
     // Initialize GTK
     gtk_init(&argc, &argv);
+    // --memory-report: print live memory by subsystem at exit
+    memoire_lire_options(argc, argv);
     
     // App data structure to hold our widgets
     AppData app_data;
@@ -183,6 +190,7 @@ fixed= init_fixed("principal",dim);
 
     // Connecter le signal "clicked" du bouton à la fonction qui ouvre le FileChooser
     g_signal_connect(button, "clicked", G_CALLBACK(on_open_file_button_clicked), fixed->fixed_container);
+    fixed_add_widget(fixed, create_open_layout_bar(), 700, 440);
 //////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////:---image---////////////////////////////////////////////////////:
  MonImage *image;
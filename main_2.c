@@ -1,6 +1,7 @@
 #include <gtk/gtk.h>
 #include "global.h"
 #include "entry.h"
+#include "perf_panel.h"
 // #include "Scale.h"
 // #include "scroll.h"
 
@@ -98,12 +99,14 @@ void run_demo(GtkWidget *widget, gpointer data) {
 
 // Function to add an item to the hierarchy tree
 static void add_to_hierarchy(AppData *app_data, const gchar *widget_type, GtkWidget *widget) {
+    gint64 op_start = perf_op_begin();
     GtkTreeIter iter;
     gtk_tree_store_append(app_data->hierarchy_store, &iter, NULL);
     gtk_tree_store_set(app_data->hierarchy_store, &iter, 0, widget_type, 1, widget, -1);
     
     // Expand all rows to show the newly added item
     gtk_tree_view_expand_all(GTK_TREE_VIEW(app_data->hierarchy_view));
+    perf_op_end(PERF_OP_ADD_WIDGET, op_start);
 }
 
 // Container creation callback for Box
@@ -829,6 +832,11 @@ int main(int argc, char *argv[]) {
     gtk_container_add(GTK_CONTAINER(preview_frame), app_data.preview_area);
     gtk_box_pack_start(GTK_BOX(main_box), preview_frame, TRUE, TRUE, 0);
     
+    // Live performance stats, right above the hierarchy (this UI has no Arbre)
+    gtk_box_pack_end(GTK_BOX(left_panel),
+                     create_perf_panel(app_data.preview_area, GTK_TREE_MODEL(app_data.hierarchy_store), NULL),
+                     FALSE, FALSE, 0);
+    
     // Create right properties panel
     app_data.properties_panel = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
     gtk_widget_set_size_request(app_data.properties_panel, 200, -1);
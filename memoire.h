@@ -0,0 +1,402 @@
+//
+// Created by ACER on 06/01/2025.
+//
+
+#ifndef TEST1_MEMOIRE_H
+#define TEST1_MEMOIRE_H
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <glib.h>
+#include <glib-object.h>
+
+//Comptage de la mémoire par sous-système.
+//Les structures allouées par l'application (noeuds de l'Arbre, structures des widgets, styles,
+//images, menus, chaines lues par le parseur) passent par memoire_allouer()/memoire_liberer()
+//au lieu de malloc()/free(). Chaque bloc est précédé d'un petit en-tete qui garde sa taille et
+//sa catégorie: la libération retrouve ce qu'il faut décompter sans table ni verrou, et les
+//compteurs de chaque catégorie sont mis à jour par des opérations atomiques. On obtient:
+// - les octets et le nombre d'objets vivants par catégorie (et le pic atteint);
+// - avec -DMEMOIRE_SUIVI_BLOCS=1 (pour chercher une fuite), les endroits du code dont les
+//   blocs ne sont jamais libérés: l'en-tete note aussi l'endroit de l'allocation et les blocs
+//   vivants sont chainés dans une liste protégée par un verrou.
+//Le rapport est disponible à la demande (memoire_rapport) et à la sortie du programme avec
+//l'option --memory-report. Avec -DMEMOIRE_COMPTEURS=0 les fonctions se réduisent à
+//malloc()/free() et le rapport est vide.
+//Un bloc de memoire_allouer() ne doit etre libéré que par memoire_liberer() (et un bloc de
+//malloc() jamais par memoire_liberer()): l'adresse rendue n'est pas celle de malloc().
+
+#ifndef MEMOIRE_COMPTEURS
+#define MEMOIRE_COMPTEURS 1
+#endif
+
+#ifndef MEMOIRE_SUIVI_BLOCS
+#define MEMOIRE_SUIVI_BLOCS 0
+#endif
+#if !MEMOIRE_COMPTEURS
+#undef MEMOIRE_SUIVI_BLOCS
+#define MEMOIRE_SUIVI_BLOCS 0
+#endif
+
+//Nombre maximal d'endroits du code listés dans le rapport des fuites
+#define MEMOIRE_RAPPORT_SITES 15
+
+typedef enum {
+    MEMOIRE_ARBRE,      // Noeuds de l'Arbre
+    MEMOIRE_WIDGETS,    // Structures des widgets, dimensions et coordonnées
+    MEMOIRE_STYLES,     // Styles, styles partagés et couleurs
+    MEMOIRE_IMAGES,     // Structures d'images (les pixels sont comptés par le cache des pixbufs)
+    MEMOIRE_MENUS,      // Modèle des menus
+    MEMOIRE_PARSEUR,    // Chaines et structures créées par la lecture du XML
+    MEMOIRE_NB_CATEGORIES
+} CategorieMemoire;
+
+//Les macros notent l'endroit de l'allocation (fichier:ligne) pour le rapport des fuites
+#define memoire_allouer(categorie, taille) \
+    memoire_allouer_depuis((categorie), (taille), FALSE, G_STRLOC)
+#define memoire_allouer0(categorie, taille) \
+    memoire_allouer_depuis((categorie), (taille), TRUE, G_STRLOC)
+#define memoire_strdup(categorie, texte) \
+    memoire_strdup_depuis((categorie), (texte), G_STRLOC)
+#define memoire_reallouer(categorie, bloc, taille) \
+    memoire_reallouer_depuis((categorie), (bloc), (taille), G_STRLOC)
+
+//Compteurs d'une catégorie, lus et écrits seulement par g_atomic_pointer_*()
+typedef struct {
+    gsize octets;           // Octets vivants
+    gsize objets;           // Blocs vivants
+    gsize pic;              // Maximum d'octets vivants atteint
+    gsize allocations;      // Nombre total d'allocations
+} CompteurMemoire;
+
+//En-tete placé devant chaque bloc. L'union avec max_align_t garde pour le bloc qui suit
+//l'alignement de malloc().
+typedef union EnteteMemoire {
+    struct {
+        gsize taille;
+        CategorieMemoire categorie;
+#if MEMOIRE_SUIVI_BLOCS
+        const char* site;                   // Chaine statique "fichier:ligne"
+        union EnteteMemoire* precedent;     // Liste des blocs vivants (memoire_verrou)
+        union EnteteMemoire* suivant;
+#endif
+    } bloc;
+    max_align_t alignement;
+} EnteteMemoire;
+
+#define MEMOIRE_ENTETE(adresse) ((EnteteMemoire*)(adresse) - 1)
+
+static CompteurMemoire memoire_compteurs[MEMOIRE_NB_CATEGORIES];
+#if MEMOIRE_SUIVI_BLOCS
+//Blocs vivants, du plus récent au plus ancien
+static EnteteMemoire* memoire_blocs = NULL;
+static GMutex memoire_verrou;
+#endif
+
+static const char* memoire_noms_categories[MEMOIRE_NB_CATEGORIES] = {
+    "arbre", "widgets", "styles", "images", "menus", "parseur"
+};
+
+//Ajoute un bloc aux compteurs de sa catégorie
+static void memoire_compter(CategorieMemoire categorie, gsize taille) {
+    CompteurMemoire* c = &memoire_compteurs[categorie];
+    gsize octets = (gsize)g_atomic_pointer_add(&c->octets, taille) + taille;
+    g_atomic_pointer_add(&c->objets, 1);
+    g_atomic_pointer_add(&c->allocations, 1);
+    //Pic: remplacé seulement s'il est toujours plus petit
+    gsize pic = (gsize)g_atomic_pointer_get(&c->pic);
+    while (octets > pic && !g_atomic_pointer_compare_and_exchange((gpointer*)&c->pic,
+                                                                  GSIZE_TO_POINTER(pic),
+                                                                  GSIZE_TO_POINTER(octets)))
+        pic = (gsize)g_atomic_pointer_get(&c->pic);
+}
+
+//Retire un bloc des compteurs de sa catégorie
+static void memoire_decompter(CategorieMemoire categorie, gsize taille) {
+    CompteurMemoire* c = &memoire_compteurs[categorie];
+    g_atomic_pointer_add(&c->octets, -(gssize)taille);
+    g_atomic_pointer_add(&c->objets, -1);
+}
+
+#if MEMOIRE_SUIVI_BLOCS
+//Chaine un bloc en tete de la liste des blocs vivants (verrou tenu)
+static void memoire_chainer(EnteteMemoire* e) {
+    e->bloc.precedent = NULL;
+    e->bloc.suivant = memoire_blocs;
+    if (memoire_blocs)
+        memoire_blocs->bloc.precedent = e;
+    memoire_blocs = e;
+}
+
+//Retire un bloc de la liste des blocs vivants (verrou tenu)
+static void memoire_dechainer(EnteteMemoire* e) {
+    if (e->bloc.precedent)
+        e->bloc.precedent->bloc.suivant = e->bloc.suivant;
+    else
+        memoire_blocs = e->bloc.suivant;
+    if (e->bloc.suivant)
+        e->bloc.suivant->bloc.precedent = e->bloc.precedent;
+}
+#endif
+
+//Remplit l'en-tete d'un bloc qui vient d'etre alloué, le compte et rend l'adresse du bloc
+static void* memoire_enregistrer(EnteteMemoire* e, gsize taille, CategorieMemoire categorie, const char* site) {
+    e->bloc.taille = taille;
+    e->bloc.categorie = categorie;
+#if MEMOIRE_SUIVI_BLOCS
+    e->bloc.site = site;
+    g_mutex_lock(&memoire_verrou);
+    memoire_chainer(e);
+    g_mutex_unlock(&memoire_verrou);
+#endif
+    memoire_compter(categorie, taille);
+    return e + 1;
+}
+
+
+/**********************************************************************************************************
+ Nom            : memoire_allouer_depuis()   (à utiliser via memoire_allouer / memoire_allouer0)
+ Entrée         : categorie - Le sous-système propriétaire du bloc
+                  taille    - La taille en octets
+                  zero      - TRUE pour remplir le bloc de zéros (comme calloc)
+                  site      - L'endroit de l'appel (G_STRLOC)
+ Sortie         : Le bloc alloué, NULL en cas d'échec
+ Description    : malloc()/calloc() compté. Le bloc doit etre libéré par memoire_liberer().
+**********************************************************************************************************/
+void* memoire_allouer_depuis(CategorieMemoire categorie, gsize taille, gboolean zero, const char* site) {
+#if MEMOIRE_COMPTEURS
+    if (taille > G_MAXSIZE - sizeof(EnteteMemoire))
+        return NULL;
+    EnteteMemoire* e = zero ? calloc(1, sizeof(EnteteMemoire) + taille)
+                            : malloc(sizeof(EnteteMemoire) + taille);
+    return e ? memoire_enregistrer(e, taille, categorie, site) : NULL;
+#else
+    return zero ? calloc(1, taille) : malloc(taille);
+#endif
+}
+
+//Copie comptée d'une chaine (NULL si texte est NULL)
+gchar* memoire_strdup_depuis(CategorieMemoire categorie, const gchar* texte, const char* site) {
+    if (!texte)
+        return NULL;
+    gsize taille = strlen(texte) + 1;
+    gchar* copie = memoire_allouer_depuis(categorie, taille, FALSE, site);
+    if (copie)
+        memcpy(copie, texte, taille);
+    return copie;
+}
+
+//realloc() compté: le bloc prend la catégorie et la taille données
+void* memoire_reallouer_depuis(CategorieMemoire categorie, void* bloc, gsize taille, const char* site) {
+#if MEMOIRE_COMPTEURS
+    if (!bloc)
+        return memoire_allouer_depuis(categorie, taille, FALSE, site);
+    if (taille > G_MAXSIZE - sizeof(EnteteMemoire))
+        return NULL;
+    EnteteMemoire* ancien = MEMOIRE_ENTETE(bloc);
+    CategorieMemoire ancienne_categorie = ancien->bloc.categorie;
+    gsize ancienne_taille = ancien->bloc.taille;
+#if MEMOIRE_SUIVI_BLOCS
+    //realloc() peut déplacer l'en-tete: il est retiré de la liste avant et rechainé après
+    g_mutex_lock(&memoire_verrou);
+    memoire_dechainer(ancien);
+    g_mutex_unlock(&memoire_verrou);
+#endif
+    EnteteMemoire* e = realloc(ancien, sizeof(EnteteMemoire) + taille);
+    if (!e) {
+        //L'ancien bloc reste valide et reste compté
+#if MEMOIRE_SUIVI_BLOCS
+        g_mutex_lock(&memoire_verrou);
+        memoire_chainer(ancien);
+        g_mutex_unlock(&memoire_verrou);
+#endif
+        return NULL;
+    }
+    memoire_decompter(ancienne_categorie, ancienne_taille);
+    return memoire_enregistrer(e, taille, categorie, site);
+#else
+    return realloc(bloc, taille);
+#endif
+}
+
+//Libère un bloc alloué par memoire_allouer() (NULL accepté)
+void memoire_liberer(void* adresse) {
+    if (!adresse)
+        return;
+#if MEMOIRE_COMPTEURS
+    EnteteMemoire* e = MEMOIRE_ENTETE(adresse);
+#if MEMOIRE_SUIVI_BLOCS
+    g_mutex_lock(&memoire_verrou);
+    memoire_dechainer(e);
+    g_mutex_unlock(&memoire_verrou);
+#endif
+    memoire_decompter(e->bloc.categorie, e->bloc.taille);
+    free(e);
+#else
+    free(adresse);
+#endif
+}
+
+//Octets vivants d'une catégorie
+gsize memoire_octets(CategorieMemoire categorie) {
+    return (gsize)g_atomic_pointer_get(&memoire_compteurs[categorie].octets);
+}
+
+//Objets vivants d'une catégorie
+gsize memoire_objets(CategorieMemoire categorie) {
+    return (gsize)g_atomic_pointer_get(&memoire_compteurs[categorie].objets);
+}
+
+#if MEMOIRE_SUIVI_BLOCS
+typedef struct {
+    const char* site;
+    CategorieMemoire categorie;
+    gsize objets;
+    gsize octets;
+} SiteMemoire;
+
+//Regroupe les blocs vivants par endroit d'allocation (verrou tenu)
+static void memoire_ajouter_site(EnteteMemoire* e, GHashTable* sites) {
+    SiteMemoire* s = g_hash_table_lookup(sites, e->bloc.site);
+    if (!s) {
+        s = g_new0(SiteMemoire, 1);
+        s->site = e->bloc.site;
+        s->categorie = e->bloc.categorie;
+        g_hash_table_insert(sites, (gpointer)e->bloc.site, s);
+    }
+    s->objets++;
+    s->octets += e->bloc.taille;
+}
+
+static gint memoire_comparer_sites(gconstpointer a, gconstpointer b) {
+    const SiteMemoire* sa = *(SiteMemoire* const*)a;
+    const SiteMemoire* sb = *(SiteMemoire* const*)b;
+    return sa->octets < sb->octets ? 1 : (sa->octets > sb->octets ? -1 : 0);
+}
+#endif
+
+
+/**********************************************************************************************************
+ Nom            : memoire_rapport_texte()
+ Entrée         : texte - La chaine où ajouter le rapport
+ Sortie         : Aucune
+ Description    : Ajoute le rapport: octets et objets vivants, pic et nombre d'allocations par
+                  catégorie, puis (avec MEMOIRE_SUIVI_BLOCS) les endroits du code qui retiennent le
+                  plus de mémoire. Un endroit dont le nombre d'objets ne fait que croitre pendant
+                  l'édition est une fuite.
+**********************************************************************************************************/
+void memoire_rapport_texte(GString* texte) {
+#if MEMOIRE_COMPTEURS
+    gsize total_octets = 0, total_objets = 0;
+
+    g_string_append_printf(texte, "%-10s %12s %9s %12s %12s\n",
+                           "categorie", "octets", "objets", "pic", "allocations");
+    for (int c = 0; c < MEMOIRE_NB_CATEGORIES; c++) {
+        CompteurMemoire* compteur = &memoire_compteurs[c];
+        gsize octets = (gsize)g_atomic_pointer_get(&compteur->octets);
+        gsize objets = (gsize)g_atomic_pointer_get(&compteur->objets);
+        g_string_append_printf(texte, "%-10s %12" G_GSIZE_FORMAT " %9" G_GSIZE_FORMAT " %12"
+                               G_GSIZE_FORMAT " %12" G_GSIZE_FORMAT "\n",
+                               memoire_noms_categories[c], octets, objets,
+                               (gsize)g_atomic_pointer_get(&compteur->pic),
+                               (gsize)g_atomic_pointer_get(&compteur->allocations));
+        total_octets += octets;
+        total_objets += objets;
+    }
+    g_string_append_printf(texte, "%-10s %12" G_GSIZE_FORMAT " %9" G_GSIZE_FORMAT "\n",
+                           "total", total_octets, total_objets);
+
+#if MEMOIRE_SUIVI_BLOCS
+    //Endroits du code qui retiennent le plus de mémoire
+    GHashTable* sites = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, g_free);
+    g_mutex_lock(&memoire_verrou);
+    for (EnteteMemoire* e = memoire_blocs; e; e = e->bloc.suivant)
+        memoire_ajouter_site(e, sites);
+    g_mutex_unlock(&memoire_verrou);
+
+    GPtrArray* tries = g_ptr_array_new();
+    GHashTableIter it;
+    gpointer cle, valeur;
+    g_hash_table_iter_init(&it, sites);
+    while (g_hash_table_iter_next(&it, &cle, &valeur))
+        g_ptr_array_add(tries, valeur);
+    g_ptr_array_sort(tries, memoire_comparer_sites);
+
+    if (tries->len)
+        g_string_append(texte, "\nBlocs vivants par endroit d'allocation:\n");
+    for (guint i = 0; i < tries->len && i < MEMOIRE_RAPPORT_SITES; i++) {
+        SiteMemoire* s = g_ptr_array_index(tries, i);
+        g_string_append_printf(texte, "%12" G_GSIZE_FORMAT " octets %9" G_GSIZE_FORMAT " objets  [%s] %s\n",
+                               s->octets, s->objets, memoire_noms_categories[s->categorie], s->site);
+    }
+    if (tries->len > MEMOIRE_RAPPORT_SITES)
+        g_string_append_printf(texte, "... et %u autre(s) endroit(s)\n", tries->len - MEMOIRE_RAPPORT_SITES);
+
+    g_ptr_array_free(tries, TRUE);
+    g_hash_table_destroy(sites);
+#else
+    g_string_append(texte, "\nEndroits d'allocation non suivis (compiler avec MEMOIRE_SUIVI_BLOCS=1)\n");
+#endif
+#else
+    g_string_append(texte, "Comptage de la memoire desactive (MEMOIRE_COMPTEURS=0)\n");
+#endif
+}
+
+//Ecrit le rapport de la mémoire dans un fichier (stdout, stderr...)
+void memoire_rapport(FILE* sortie) {
+    GString* texte = g_string_new("");
+    memoire_rapport_texte(texte);
+    fprintf(sortie, "=== Rapport memoire ===\n%s", texte->str);
+    fflush(sortie);
+    g_string_free(texte, TRUE);
+}
+
+static void memoire_rapport_sortie(void) {
+    memoire_rapport(stderr);
+}
+
+/**********************************************************************************************************
+ Nom            : memoire_lire_options()
+ Entrée         : argc, argv - Les arguments du programme
+ Sortie         : Aucune
+ Description    : Avec l'option --memory-report, le rapport est écrit sur stderr à la sortie du
+                  programme: les blocs encore vivants à ce moment sont les fuites.
+**********************************************************************************************************/
+void memoire_lire_options(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++)
+        if (!strcmp(argv[i], "--memory-report")) {
+            atexit(memoire_rapport_sortie);
+            break;
+        }
+}
+
+
+//Propriété des structures de widgets.
+//Chaque structure (btn, Monlabel, StyledBox...) appartient au GtkWidget qu'elle décrit: elle est
+//attachée au widget à sa création et sa fonction de libération est appelée à la destruction du
+//widget. Retirer un widget de son conteneur libère donc aussi sa structure et ce qu'elle possède.
+#define MEMOIRE_CLE_STRUCTURE "structure_widget"
+
+/**********************************************************************************************************
+ Nom            : memoire_attacher()
+ Entrée         : widget - Le GtkWidget (ou tout GObject) propriétaire
+                  structure - La structure qui décrit le widget
+                  liberer - Fonction appelée avec la structure à la destruction du widget
+ Sortie         : Aucune
+ Description    : Donne la structure au widget. Une structure déjà attachée au même widget est
+                  libérée avant d'etre remplacée.
+**********************************************************************************************************/
+void memoire_attacher(gpointer widget, gpointer structure, GDestroyNotify liberer) {
+    if (!widget || !structure)
+        return;
+    g_object_set_data_full(G_OBJECT(widget), MEMOIRE_CLE_STRUCTURE, structure, liberer);
+}
+
+//Structure attachée au widget (NULL s'il n'en a pas)
+gpointer memoire_structure(gpointer widget) {
+    return widget ? g_object_get_data(G_OBJECT(widget), MEMOIRE_CLE_STRUCTURE) : NULL;
+}
+
+
+#endif //TEST1_MEMOIRE_H
@@ -6,49 +6,7 @@
 #include "hierarchy.h"
 
 #include "property_panel.h"
-
-// Maximum string length for names and labels
-#define MAX_LABEL_LENGTH 100
-
-/**
- * Menu orientation enumeration
- */
-typedef enum {
-    MENU_ORIENTATION_VERTICAL,   // Standard dropdown menu
-    MENU_ORIENTATION_HORIZONTAL  // Horizontal menu items
-} MenuOrientation;
-
-/**
- * MenuItem structure - represents a single menu item
- */
-typedef struct {
-    char label[MAX_LABEL_LENGTH];        // Menu item text
-    char callback[MAX_LABEL_LENGTH];     // Optional callback function name
-    GtkWidget *widget;                   // The GTK menu item widget
-    gboolean is_separator;               // Whether this is a separator
-} MenuItem;
-
-/**
- * Menu structure - represents a menu that contains menu items
- */
-typedef struct Menu {
-    char name[MAX_LABEL_LENGTH];         // Menu name (shown in menu bar)
-    GtkWidget *menu_widget;              // The GTK menu widget 
-    GtkWidget *menu_item;                // Menu's item in parent (bar or submenu)
-    GList *items;                        // List of MenuItems and submenus
-    MenuOrientation orientation;         // Menu orientation
-    struct Menu *parent;                 // Parent menu (NULL if attached to bar)
-} Menu;
-
-/**
- * MenuBar structure - represents the top-level menu bar
- */
-typedef struct {
-    GtkWidget *widget;                   // The GTK menu bar widget
-    GList *menus;                        // List of attached menus
-    int x_position;                      // X coordinate in parent container
-    int y_position;                      // Y coordinate in parent container
-} MenuBar;
+#include "menu_model.h"
 
 /**
  * Structure to hold dialog data during menu creation
@@ -56,7 +14,7 @@ typedef struct {
 typedef struct {
     // Current menu being edited
     char current_menu_name[MAX_LABEL_LENGTH];
-    GList *current_items;                // List of items for current menu
+    GPtrArray *current_items;            // Items of the menu being composed (not yet owned by a menu)
     Menu *selected_parent;               // Selected parent menu for submenu
     MenuOrientation current_orientation;
     
@@ -66,7 +24,7 @@ typedef struct {
     GtkWidget *items_list_view;
     GtkListStore *items_list_store;
     GtkWidget *menu_tree_view;
-    GtkTreeStore *menu_tree_store;
+    GtkTreeStore *menu_tree_store;       // Columns: MENU_TREE_COL_*
     GtkWidget *parent_combo;
     GtkWidget *orientation_combo;
     GtkWidget *x_position_spin;
@@ -74,7 +32,7 @@ typedef struct {
     
     // Result data
     MenuBar *menu_bar;
-    GList *all_menus;                    // All menus created in this session
+    GHashTable *menus_by_name;           // Menu name -> Menu*, for every menu of the bar
     
     // Application data
     GtkTreeStore *hierarchy_store;       // App's widget hierarchy store
@@ -82,222 +40,25 @@ typedef struct {
 
 
 
-// Forward declarations for functions used before defined
-static void build_menu_hierarchy(GtkTreeStore *store, GtkTreeIter *parent, GList *items);
-static void add_submenus_to_tree(GtkTreeStore *store, GtkTreeIter *parent, const char *parent_name, GList *menus);
-static void show_menu_bar_dialog(AppData *app_data);
-static void create_submenu_clicked(GtkWidget *button, MenuDialogData *main_dialog_data);
-
-
-
-
 /**
- * Create a new menu item
+ * Columns of the dialog's menu structure tree. Rows point straight at the
+ * model so edits never have to parse labels or search for menus.
  */
-static MenuItem* create_menu_item(const char *label, const char *callback) {
-    MenuItem *item = g_malloc(sizeof(MenuItem));
-    
-    // Initialize with default values
-    strncpy(item->label, label, MAX_LABEL_LENGTH - 1);
-    item->label[MAX_LABEL_LENGTH - 1] = '\0';
-    
-    if (callback) {
-        strncpy(item->callback, callback, MAX_LABEL_LENGTH - 1);
-        item->callback[MAX_LABEL_LENGTH - 1] = '\0';
-    } else {
-        item->callback[0] = '\0';
-    }
-    
-    item->widget = NULL;
-    item->is_separator = FALSE;
-    
-    return item;
-}
+enum {
+    MENU_TREE_COL_LABEL,                 // Displayed text
+    MENU_TREE_COL_MENU,                  // Menu* for menu rows, NULL for item rows
+    MENU_TREE_COL_ITEM,                  // MenuItem* for item rows, NULL for menu rows
+    MENU_TREE_N_COLUMNS
+};
 
-/**
- * Create a menu separator item
- */
-static MenuItem* create_menu_separator() {
-    MenuItem *item = g_malloc(sizeof(MenuItem));
-    
-    // Initialize as separator
-    item->label[0] = '\0';
-    item->callback[0] = '\0';
-    item->widget = NULL;
-    item->is_separator = TRUE;
-    
-    return item;
-}
-
-/**
- * Create a new menu
- */
-static Menu* create_menu(const char *name, MenuOrientation orientation) {
-    Menu *menu = g_malloc(sizeof(Menu));
-    
-    // Initialize menu
-    strncpy(menu->name, name, MAX_LABEL_LENGTH - 1);
-    menu->name[MAX_LABEL_LENGTH - 1] = '\0';
-    
-    menu->menu_widget = gtk_menu_new();
-    menu->menu_item = NULL;
-    menu->items = NULL;
-    menu->orientation = orientation;
-    menu->parent = NULL;
-    
-    return menu;
-}
-
-/**
- * Create a new menu bar
- */
-static MenuBar* create_menu_bar() {
-    MenuBar *bar = g_malloc(sizeof(MenuBar));
-    
-    // Initialize menu bar
-    bar->widget = gtk_menu_bar_new();
-    bar->menus = NULL;
-    bar->x_position = 0;
-    bar->y_position = 0;
-    
-    return bar;
-}
-
-/**
- * Add a menu item to a menu
- */
-static void add_item_to_menu(Menu *menu, MenuItem *item) {
-    if (!menu || !item) return;
-    
-    // Create the GTK widget for this item
-    if (item->is_separator) {
-        item->widget = gtk_separator_menu_item_new();
-    } else {
-        item->widget = gtk_menu_item_new_with_label(item->label);
-    }
-    
-    // Add the item to the menu
-    if (menu->orientation == MENU_ORIENTATION_VERTICAL) {
-        // Standard vertical menu
-        gtk_menu_shell_append(GTK_MENU_SHELL(menu->menu_widget), item->widget);
-    } else {
-        // Horizontal menu - use menu_attach to place items side by side
-        int position = g_list_length(menu->items);
-        gtk_menu_attach(GTK_MENU(menu->menu_widget), item->widget, 
-                       position, position + 1, 0, 1);
-    }
-    
-    // Store the item in the menu's items list
-    menu->items = g_list_append(menu->items, item);
-    
-    // Show the widget
-    gtk_widget_show(item->widget);
-}
-
-/**
- * Add a submenu to a parent menu
- */
-static void add_submenu_to_menu(Menu *parent, Menu *submenu) {
-    if (!parent || !submenu) return;
-    
-    // Create a menu item for the submenu
-    submenu->menu_item = gtk_menu_item_new_with_label(submenu->name);
-    
-    // Set the menu as submenu of this item
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(submenu->menu_item), submenu->menu_widget);
-    
-    // Add the menu item to the parent menu
-    if (parent->orientation == MENU_ORIENTATION_VERTICAL) {
-        gtk_menu_shell_append(GTK_MENU_SHELL(parent->menu_widget), submenu->menu_item);
-    } else {
-        int position = g_list_length(parent->items);
-        gtk_menu_attach(GTK_MENU(parent->menu_widget), submenu->menu_item,
-                       position, position + 1, 0, 1);
-    }
-    
-    // Update parent reference
-    submenu->parent = parent;
-    
-    // Add to parent's items list (for tracking)
-    parent->items = g_list_append(parent->items, submenu);
-    
-    // Show the widget
-    gtk_widget_show(submenu->menu_item);
-}
-
-/**
- * Add a menu to a menu bar
- */
-static void add_menu_to_bar(MenuBar *bar, Menu *menu) {
-    if (!bar || !menu) return;
-    
-    // Create a menu item for the menu
-    menu->menu_item = gtk_menu_item_new_with_label(menu->name);
-    
-    // Set the menu widget as submenu of this item
-    gtk_menu_item_set_submenu(GTK_MENU_ITEM(menu->menu_item), menu->menu_widget);
-    
-    // Add the menu item to the menu bar
-    gtk_menu_shell_append(GTK_MENU_SHELL(bar->widget), menu->menu_item);
-    
-    // Add to bar's menus list
-    bar->menus = g_list_append(bar->menus, menu);
-    
-    // Show the widget
-    gtk_widget_show(menu->menu_item);
-}
-
-/**
- * Free memory used by a menu item
- */
-static void free_menu_item(MenuItem *item) {
-    if (item) {
-        // GTK will handle freeing the widget
-        g_free(item);
-    }
-}
+// Forward declarations for functions used before defined
+static void build_menu_hierarchy(GtkTreeStore *store, GtkTreeIter *parent, MenuBar *bar);
+static void add_menu_to_hierarchy(GtkTreeStore *store, GtkTreeIter *parent, Menu *menu, const char *kind);
+static void show_menu_bar_dialog(AppData *app_data);
+static void create_submenu_clicked(GtkWidget *button, MenuDialogData *main_dialog_data);
 
-/**
- * Free memory used by a menu and its items
- */
-static void free_menu(Menu *menu) {
-    if (menu) {
-        // Free all menu items
-        g_list_free_full(menu->items, (GDestroyNotify)free_menu_item);
-        
-        // GTK will handle freeing the widgets
-        g_free(menu);
-    }
-}
 
-/**
- * Free memory used by a menu bar and all its menus
- */
-static void free_menu_bar(MenuBar *bar) {
-    if (bar) {
-        // Free all menus
-        g_list_free_full(bar->menus, (GDestroyNotify)free_menu);
-        
-        // GTK will handle freeing the widget
-        g_free(bar);
-    }
-}
 
-/**
- * Add menu to container at specified position
- */
-static void add_menu_bar_to_container(GtkWidget *container, MenuBar *bar) {
-    if (!GTK_IS_FIXED(container) || !bar) return;
-    // MenuBar
-    // / Register the widget for property editing
-            // g_signal_connect(bar, "button-press-event",
-                            //  G_CALLBACK(on_widget_button_press_select), app_data);
-    // Add the menu bar to the fixed container at specified position
-    gtk_fixed_put(GTK_FIXED(container), bar->widget, bar->x_position, bar->y_position);
-    
-    // Show the widget
-    gtk_widget_show(bar->widget);
-}
 
 /**
  * Add a menu item to the current menu being created
@@ -348,8 +109,8 @@ static void add_item_clicked(GtkWidget *button, MenuDialogData *dialog_data) {
             // Create a new menu item
             MenuItem *item = create_menu_item(label_text, callback_text);
             
-            // Add to current items list
-            dialog_data->current_items = g_list_append(dialog_data->current_items, item);
+            // Add to current items
+            g_ptr_array_add(dialog_data->current_items, item);
             
             // Add to list store for display
             GtkTreeIter iter;
@@ -371,8 +132,8 @@ static void add_separator_clicked(GtkWidget *button, MenuDialogData *dialog_data
     // Create a separator item
     MenuItem *separator = create_menu_separator();
     
-    // Add to current items list
-    dialog_data->current_items = g_list_append(dialog_data->current_items, separator);
+    // Add to current items
+    g_ptr_array_add(dialog_data->current_items, separator);
     
     // Add to list store for display
     GtkTreeIter iter;
@@ -398,15 +159,9 @@ static void remove_item_clicked(GtkWidget *button, MenuDialogData *dialog_data)
         gint *indices = gtk_tree_path_get_indices(path);
         gint index = indices[0];
         
-        // Find and remove the item from the list
-        GList *item_node = g_list_nth(dialog_data->current_items, index);
-        if (item_node) {
-            // Free the menu item
-            free_menu_item((MenuItem*)item_node->data);
-            
-            // Remove from the list
-            dialog_data->current_items = g_list_delete_link(
-                dialog_data->current_items, item_node);
+        // Remove the item and free it
+        if (index >= 0 && (guint)index < dialog_data->current_items->len) {
+            free_menu_item(g_ptr_array_remove_index(dialog_data->current_items, index));
         }
         
         // Remove from the list store
@@ -417,48 +172,97 @@ static void remove_item_clicked(GtkWidget *button, MenuDialogData *dialog_data)
 }
 
 /**
- * Find a menu by name in the list of all menus
+ * Find a menu by name
  */
 static Menu* find_menu_by_name(MenuDialogData *dialog_data, const char *name) {
-    for (GList *node = dialog_data->all_menus; node; node = node->next) {
-        Menu *menu = (Menu*)node->data;
-        if (strcmp(menu->name, name) == 0) {
-            return menu;
-        }
+    return g_hash_table_lookup(dialog_data->menus_by_name, name);
+}
+
+/**
+ * Show an error message over the dialog
+ */
+static void show_menu_dialog_error(GtkWidget *parent, const char *message) {
+    GtkWidget *error_dialog = gtk_message_dialog_new(
+        GTK_WINDOW(parent),
+        GTK_DIALOG_MODAL,
+        GTK_MESSAGE_ERROR,
+        GTK_BUTTONS_OK,
+        "%s", message
+    );
+    gtk_dialog_run(GTK_DIALOG(error_dialog));
+    gtk_widget_destroy(error_dialog);
+}
+
+/**
+ * Check a new menu name: it must be set and unique, since menus are indexed by name
+ */
+static gboolean validate_menu_name(MenuDialogData *dialog_data, GtkWidget *parent, const char *name) {
+    if (!name || !*name) {
+        show_menu_dialog_error(parent, "Please enter a menu name");
+        return FALSE;
     }
-    return NULL;
+    if (find_menu_by_name(dialog_data, name)) {
+        show_menu_dialog_error(parent, "A menu with this name already exists");
+        return FALSE;
+    }
+    return TRUE;
 }
 
 /**
- * Parse a menu name from a tree label
- * Handles both "Menu: Name (Orientation)" and "Submenu: Name (Orientation)" formats
+ * Create a menu from the items being composed; the items now belong to the menu
  */
-static char* parse_menu_name(const char *tree_label) {
-    char *result = NULL;
-    char *label_copy = g_strdup(tree_label);
+static Menu* create_menu_from_current_items(MenuDialogData *dialog_data, const char *name,
+                                            MenuOrientation orientation) {
+    Menu *menu = create_menu(name, orientation);
+    
+    for (guint i = 0; i < dialog_data->current_items->len; i++) {
+        add_item_to_menu(menu, g_ptr_array_index(dialog_data->current_items, i));
+    }
+    g_ptr_array_set_size(dialog_data->current_items, 0);
     
-    // Find the first space after "Menu:" or "Submenu:"
-    char *start = strchr(label_copy, ' ');
-    if (start) {
-        start++; // Skip the space
+    g_hash_table_insert(dialog_data->menus_by_name, menu->name, menu);
+    return menu;
+}
+
+/**
+ * Append the rows of a new menu (the menu and its plain items) under parent.
+ * Only the new rows are added; the rest of the tree is left untouched.
+ */
+static void append_menu_rows(GtkTreeStore *store, GtkTreeIter *parent, Menu *menu, const char *kind) {
+    GtkTreeIter menu_iter;
+    gchar *label = g_strdup_printf("%s: %s (%s)", kind, menu->name,
+                                   menu->orientation == MENU_ORIENTATION_VERTICAL ?
+                                   "Vertical" : "Horizontal");
+    gtk_tree_store_insert_with_values(store, &menu_iter, parent, -1,
+                                      MENU_TREE_COL_LABEL, label,
+                                      MENU_TREE_COL_MENU, menu,
+                                      MENU_TREE_COL_ITEM, NULL, -1);
+    g_free(label);
+    
+    // Add menu items as children
+    for (guint i = 0; i < menu->items->len; i++) {
+        MenuItem *item = g_ptr_array_index(menu->items, i);
+        if (item->submenu) continue;
         
-        // Find the opening parenthesis for orientation
-        char *end = strchr(start, '(');
-        if (end) {
-            end--; // Back up before the space
-            *end = '\0'; // Terminate the string
-            result = g_strdup(start);
-        } else {
-            // No orientation part found
-            result = g_strdup(start);
+        gtk_tree_store_insert_with_values(store, NULL, &menu_iter, -1,
+                                          MENU_TREE_COL_LABEL,
+                                          item->is_separator ? "--- Separator ---" : item->label,
+                                          MENU_TREE_COL_MENU, NULL,
+                                          MENU_TREE_COL_ITEM, item, -1);
+    }
+}
+
+/**
+ * Remove a menu and all its submenus from the name index
+ */
+static void unindex_menu(MenuDialogData *dialog_data, Menu *menu) {
+    g_hash_table_remove(dialog_data->menus_by_name, menu->name);
+    for (guint i = 0; i < menu->items->len; i++) {
+        MenuItem *item = g_ptr_array_index(menu->items, i);
+        if (item->submenu) {
+            unindex_menu(dialog_data, item->submenu);
         }
-    } else {
-        // Unexpected format, return whole string
-        result = g_strdup(label_copy);
     }
-    
-    g_free(label_copy);
-    return result;
 }
 
 /**
@@ -481,30 +285,13 @@ static void add_menu_clicked(GtkWidget *button, MenuDialogData *dialog_data) {
     const char *menu_name = gtk_entry_get_text(GTK_ENTRY(dialog_data->menu_name_entry));
     
     // Validate menu name
-    if (!menu_name || !*menu_name) {
-        GtkWidget *error_dialog = gtk_message_dialog_new(
-            GTK_WINDOW(dialog_data->dialog),
-            GTK_DIALOG_MODAL,
-            GTK_MESSAGE_ERROR,
-            GTK_BUTTONS_OK,
-            "Please enter a menu name"
-        );
-        gtk_dialog_run(GTK_DIALOG(error_dialog));
-        gtk_widget_destroy(error_dialog);
+    if (!validate_menu_name(dialog_data, dialog_data->dialog, menu_name)) {
         return;
     }
     
     // Validate that we have at least one item
-    if (!dialog_data->current_items) {
-        GtkWidget *error_dialog = gtk_message_dialog_new(
-            GTK_WINDOW(dialog_data->dialog),
-            GTK_DIALOG_MODAL,
-            GTK_MESSAGE_ERROR,
-            GTK_BUTTONS_OK,
-            "Please add at least one menu item"
-        );
-        gtk_dialog_run(GTK_DIALOG(error_dialog));
-        gtk_widget_destroy(error_dialog);
+    if (dialog_data->current_items->len == 0) {
+        show_menu_dialog_error(dialog_data->dialog, "Please add at least one menu item");
         return;
     }
     
@@ -513,19 +300,30 @@ static void add_menu_clicked(GtkWidget *button, MenuDialogData *dialog_data) {
     MenuOrientation orientation = (orientation_idx == 0) ? 
                                 MENU_ORIENTATION_VERTICAL : MENU_ORIENTATION_HORIZONTAL;
     
-    // Create the menu
-    Menu *menu = create_menu(menu_name, orientation);
+    // Get parent selection
+    gint parent_idx = gtk_combo_box_get_active(GTK_COMBO_BOX(dialog_data->parent_combo));
+    Menu *parent_menu = NULL;
+    GtkTreeIter parent_iter;
     
-    // Add all items to the menu
-    for (GList *node = dialog_data->current_items; node; node = node->next) {
-        MenuItem *item = (MenuItem*)node->data;
-        add_item_to_menu(menu, item);
+    if (parent_idx != 0) {
+        // Attach to the menu selected in the tree
+        GtkTreeSelection *selection = gtk_tree_view_get_selection(
+            GTK_TREE_VIEW(dialog_data->menu_tree_view));
+        GtkTreeModel *model;
+        
+        if (gtk_tree_selection_get_selected(selection, &model, &parent_iter)) {
+            gtk_tree_model_get(model, &parent_iter, MENU_TREE_COL_MENU, &parent_menu, -1);
+        }
+        if (!parent_menu) {
+            show_menu_dialog_error(dialog_data->dialog, "Please select a parent menu in the tree");
+            return;
+        }
     }
     
-    // Get parent selection
-    gint parent_idx = gtk_combo_box_get_active(GTK_COMBO_BOX(dialog_data->parent_combo));
+    // Create the menu
+    Menu *menu = create_menu_from_current_items(dialog_data, menu_name, orientation);
     
-    if (parent_idx == 0) {
+    if (!parent_menu) {
         // Attach to menu bar
         if (!dialog_data->menu_bar) {
             dialog_data->menu_bar = create_menu_bar();
@@ -541,117 +339,18 @@ static void add_menu_clicked(GtkWidget *button, MenuDialogData *dialog_data) {
         add_menu_to_bar(dialog_data->menu_bar, menu);
         
         // Add to tree view (top level)
-        GtkTreeIter iter;
-        gtk_tree_store_append(dialog_data->menu_tree_store, &iter, NULL);
-        gtk_tree_store_set(dialog_data->menu_tree_store, &iter, 0, 
-                          g_strdup_printf("Menu: %s (%s)", menu->name, 
-                                         orientation == MENU_ORIENTATION_VERTICAL ? 
-                                         "Vertical" : "Horizontal"), 
-                          -1);
-        
-        // Add menu items as children
-        for (GList *node = menu->items; node; node = node->next) {
-            MenuItem *item = (MenuItem*)node->data;
-            
-            GtkTreeIter child_iter;
-            gtk_tree_store_append(dialog_data->menu_tree_store, &child_iter, &iter);
-            
-            if (item->is_separator) {
-                gtk_tree_store_set(dialog_data->menu_tree_store, &child_iter, 
-                                  0, "--- Separator ---", -1);
-            } else {
-                gtk_tree_store_set(dialog_data->menu_tree_store, &child_iter, 
-                                  0, item->label, -1);
-            }
-        }
+        append_menu_rows(dialog_data->menu_tree_store, NULL, menu, "Menu");
     } else {
-        // Attach to selected menu as submenu
-        GtkTreeSelection *selection = gtk_tree_view_get_selection(
-            GTK_TREE_VIEW(dialog_data->menu_tree_view));
-        GtkTreeModel *model;
-        GtkTreeIter iter;
-        
-        if (gtk_tree_selection_get_selected(selection, &model, &iter)) {
-            gchar *parent_label;
-            gtk_tree_model_get(model, &iter, 0, &parent_label, -1);
-            
-            // Extract parent menu name
-            char *parent_name = parse_menu_name(parent_label);
-            Menu *parent_menu = find_menu_by_name(dialog_data, parent_name);
-            
-            if (parent_menu) {
-                // Add as submenu
-                add_submenu_to_menu(parent_menu, menu);
-                
-                // Add to tree view (as child of selected item)
-                GtkTreeIter submenu_iter;
-                gtk_tree_store_append(dialog_data->menu_tree_store, &submenu_iter, &iter);
-                gtk_tree_store_set(dialog_data->menu_tree_store, &submenu_iter, 0, 
-                                  g_strdup_printf("Submenu: %s (%s)", menu->name, 
-                                               orientation == MENU_ORIENTATION_VERTICAL ? 
-                                               "Vertical" : "Horizontal"), 
-                                  -1);
-                
-                // Add menu items as children
-                for (GList *node = menu->items; node; node = node->next) {
-                    MenuItem *item = (MenuItem*)node->data;
-                    
-                    GtkTreeIter child_iter;
-                    gtk_tree_store_append(dialog_data->menu_tree_store, &child_iter, &submenu_iter);
-                    
-                    if (item->is_separator) {
-                        gtk_tree_store_set(dialog_data->menu_tree_store, &child_iter, 
-                                          0, "--- Separator ---", -1);
-                    } else {
-                        gtk_tree_store_set(dialog_data->menu_tree_store, &child_iter, 
-                                          0, item->label, -1);
-                    }
-                }
-            } else {
-                // Parent menu not found
-                GtkWidget *error_dialog = gtk_message_dialog_new(
-                    GTK_WINDOW(dialog_data->dialog),
-                    GTK_DIALOG_MODAL,
-                    GTK_MESSAGE_ERROR,
-                    GTK_BUTTONS_OK,
-                    "Parent menu not found"
-                );
-                gtk_dialog_run(GTK_DIALOG(error_dialog));
-                gtk_widget_destroy(error_dialog);
-                g_free(parent_name);
-                g_free(parent_label);
-                free_menu(menu);
-                return;
-            }
-            
-            g_free(parent_name);
-            g_free(parent_label);
-        } else {
-            // No item selected
-            GtkWidget *error_dialog = gtk_message_dialog_new(
-                GTK_WINDOW(dialog_data->dialog),
-                GTK_DIALOG_MODAL,
-                GTK_MESSAGE_ERROR,
-                GTK_BUTTONS_OK,
-                "Please select a parent menu in the tree"
-            );
-            gtk_dialog_run(GTK_DIALOG(error_dialog));
-            gtk_widget_destroy(error_dialog);
-            free_menu(menu);
-            return;
-        }
+        // Add as submenu, under the selected menu's row
+        add_submenu_to_menu(parent_menu, menu);
+        append_menu_rows(dialog_data->menu_tree_store, &parent_iter, menu, "Submenu");
     }
     
-    // Add to all_menus list
-    dialog_data->all_menus = g_list_append(dialog_data->all_menus, menu);
-    
     // Expand tree to show new items
     gtk_tree_view_expand_all(GTK_TREE_VIEW(dialog_data->menu_tree_view));
     
     // Clear current menu data
     dialog_data->current_menu_name[0] = '\0';
-    g_list_free(dialog_data->current_items);
-    dialog_data->current_items = NULL;
     
     // Clear items list store
     gtk_list_store_clear(dialog_data->items_list_store);
@@ -669,131 +368,111 @@ static void remove_menu_clicked(GtkWidget *button, MenuDialogData *dialog_data)
     GtkTreeModel *model;
     GtkTreeIter iter;
     
-    if (gtk_tree_selection_get_selected(selection, &model, &iter)) {
-        gchar *menu_label;
-        gtk_tree_model_get(model, &iter, 0, &menu_label, -1);
+    if (!gtk_tree_selection_get_selected(selection, &model, &iter)) {
+        return;
+    }
+    
+    Menu *menu_to_remove = NULL;
+    MenuItem *item_to_remove = NULL;
+    gtk_tree_model_get(model, &iter,
+                       MENU_TREE_COL_MENU, &menu_to_remove,
+                       MENU_TREE_COL_ITEM, &item_to_remove, -1);
+    
+    if (menu_to_remove) {
+        // Drop the menu and its submenus from the index
+        unindex_menu(dialog_data, menu_to_remove);
         
-        // Check if this is a menu/submenu or just an item
-        if (strstr(menu_label, "Menu:") == menu_label || 
-            strstr(menu_label, "Submenu:") == menu_label) {
-            
-            // Extract menu name
-            char *menu_name = parse_menu_name(menu_label);
-            Menu *menu_to_remove = find_menu_by_name(dialog_data, menu_name);
-            
-            if (menu_to_remove) {
-                // Remove from parent's list
-                if (menu_to_remove->parent) {
-                    // Remove from parent menu
-                    menu_to_remove->parent->items = g_list_remove(
-                        menu_to_remove->parent->items, menu_to_remove);
-                    
-                    // GTK will handle removing the widget when we destroy it
-                } else if (dialog_data->menu_bar) {
-                    // Remove from menu bar
-                    dialog_data->menu_bar->menus = g_list_remove(
-                        dialog_data->menu_bar->menus, menu_to_remove);
-                }
-                
-                // Remove from all_menus list
-                dialog_data->all_menus = g_list_remove(
-                    dialog_data->all_menus, menu_to_remove);
-                
-                // Free the menu and its items
-                free_menu(menu_to_remove);
-                
-                // Remove from tree view
-                gtk_tree_store_remove(dialog_data->menu_tree_store, &iter);
-            }
-            
-            g_free(menu_name);
-        } else {
-            // This is just a menu item, not a menu - get parent menu
-            GtkTreeIter parent_iter;
-            if (gtk_tree_model_iter_parent(model, &parent_iter, &iter)) {
-                gchar *parent_label;
-                gtk_tree_model_get(model, &parent_iter, 0, &parent_label, -1);
-                
-                // Extract parent menu name
-                char *parent_name = parse_menu_name(parent_label);
-                Menu *parent_menu = find_menu_by_name(dialog_data, parent_name);
-                
-                if (parent_menu) {
-                    // Get path to determine item index
-                    GtkTreePath *path = gtk_tree_model_get_path(model, &iter);
-                    gint *indices = gtk_tree_path_get_indices(path);
-                    gint index = indices[1]; // Second level is item index
-                    
-                    // Find and remove the item
-                    GList *item_node = g_list_nth(parent_menu->items, index);
-                    if (item_node) {
-                        MenuItem *item = (MenuItem*)item_node->data;
-                        
-                        // Remove from parent's menu widget
-                        if (item->widget && GTK_IS_WIDGET(item->widget)) {
-                            gtk_container_remove(
-                                GTK_CONTAINER(parent_menu->menu_widget), item->widget);
-                        }
-                        
-                        // Free the menu item
-                        free_menu_item(item);
-                        
-                        // Remove from the list
-                        parent_menu->items = g_list_delete_link(
-                            parent_menu->items, item_node);
-                    }
-                    
-                    gtk_tree_path_free(path);
+        // Destroying the item also destroys its attached GtkMenu
+        if (menu_to_remove->menu_item) {
+            gtk_widget_destroy(menu_to_remove->menu_item);
+        }
+        
+        if (menu_to_remove->parent) {
+            // Remove the entry that opens it from the parent menu;
+            // freeing the entry frees the submenu
+            GPtrArray *siblings = menu_to_remove->parent->items;
+            for (guint i = 0; i < siblings->len; i++) {
+                MenuItem *entry = g_ptr_array_index(siblings, i);
+                if (entry->submenu == menu_to_remove) {
+                    free_menu_item(g_ptr_array_remove_index(siblings, i));
+                    break;
                 }
-                
-                g_free(parent_name);
-                g_free(parent_label);
             }
-            
-            // Remove from tree view
-            gtk_tree_store_remove(dialog_data->menu_tree_store, &iter);
+        } else if (dialog_data->menu_bar) {
+            // Remove from menu bar
+            g_ptr_array_remove(dialog_data->menu_bar->menus, menu_to_remove);
+            free_menu(menu_to_remove);
+        }
+    } else if (item_to_remove) {
+        // This is just a menu item - its parent row holds the menu
+        GtkTreeIter parent_iter;
+        Menu *parent_menu = NULL;
+        if (gtk_tree_model_iter_parent(model, &parent_iter, &iter)) {
+            gtk_tree_model_get(model, &parent_iter, MENU_TREE_COL_MENU, &parent_menu, -1);
         }
         
-        g_free(menu_label);
+        if (parent_menu && g_ptr_array_remove(parent_menu->items, item_to_remove)) {
+            // Remove from parent's menu widget
+            if (item_to_remove->widget) {
+                gtk_widget_destroy(item_to_remove->widget);
+            }
+            free_menu_item(item_to_remove);
+        }
     }
+    
+    // Remove the row (and its children) from tree view
+    gtk_tree_store_remove(dialog_data->menu_tree_store, &iter);
 }
 
 /**
- * Add submenu items to the tree recursively
+ * Add a menu and, recursively, its submenus to the application's hierarchy.
+ * Rows point at the model, not at widgets, so unopened menus stay unbuilt;
+ * menu_hierarchy_row_widget() reads the widget when it is needed.
  */
-static void add_submenus_to_tree(GtkTreeStore *store, GtkTreeIter *parent, const char *parent_name, GList *menus) {
-    for (GList *node = menus; node; node = node->next) {
-        Menu *submenu = (Menu*)node->data;
-        
-        // Only process menus where this is the parent
-        if (!submenu->parent || strcmp(submenu->parent->name, parent_name) != 0)
-            continue;
-            
-        // Add this submenu to the tree
-        GtkTreeIter submenu_iter;
-        gtk_tree_store_append(store, &submenu_iter, parent);
-        
-        // Add with its type
-        gtk_tree_store_set(store, &submenu_iter, 0, 
-                         g_strdup_printf("Submenu: %s", submenu->name),
-                         1, submenu->menu_item, -1);
-        
-        // Add menu items
-        for (GList *item_node = submenu->items; item_node; item_node = item_node->next) {
-            // Check if this is a MenuItem
-            MenuItem *item = (MenuItem*)item_node->data;
-            if (!item->is_separator) {
-                GtkTreeIter item_iter;
-                gtk_tree_store_append(store, &item_iter, &submenu_iter);
-                gtk_tree_store_set(store, &item_iter, 0, item->label, 1, item->widget, -1);
-            }
+static void add_menu_to_hierarchy(GtkTreeStore *store, GtkTreeIter *parent, Menu *menu, const char *kind) {
+    GtkTreeIter menu_iter;
+    gchar *label = g_strdup_printf("%s: %s", kind, menu->name);
+    gtk_tree_store_insert_with_values(store, &menu_iter, parent, -1,
+                                      HIERARCHY_COL_LABEL, label,
+                                      HIERARCHY_COL_MENU, menu, -1);
+    g_free(label);
+    
+    // Add menu items first, then submenus, as the editor tree shows them
+    for (guint i = 0; i < menu->items->len; i++) {
+        MenuItem *item = g_ptr_array_index(menu->items, i);
+        if (!item->is_separator && !item->submenu) {
+            gtk_tree_store_insert_with_values(store, NULL, &menu_iter, -1,
+                                              HIERARCHY_COL_LABEL, item->label,
+                                              HIERARCHY_COL_ITEM, item, -1);
+        }
+    }
+    for (guint i = 0; i < menu->items->len; i++) {
+        MenuItem *item = g_ptr_array_index(menu->items, i);
+        if (item->submenu) {
+            add_menu_to_hierarchy(store, &menu_iter, item->submenu, "Submenu");
         }
-        
-        // Recursively add submenus of this submenu
-        add_submenus_to_tree(store, &submenu_iter, submenu->name, menus);
     }
 }
 
+/**
+ * Widget of a row of the application's hierarchy. Menu rows hold the model:
+ * their widget is read from it, and is NULL while the menu holding it is unbuilt.
+ */
+GtkWidget* menu_hierarchy_row_widget(GtkTreeModel *model, GtkTreeIter *iter) {
+    GtkWidget *widget = NULL;
+    Menu *menu = NULL;
+    MenuItem *item = NULL;
+    gtk_tree_model_get(model, iter,
+                       HIERARCHY_COL_WIDGET, &widget,
+                       HIERARCHY_COL_MENU, &menu,
+                       HIERARCHY_COL_ITEM, &item, -1);
+    if (menu)
+        return menu->menu_item;
+    if (item)
+        return item->widget;
+    return widget;
+}
+
 /**
  * Show the dialog for creating a menu bar
  */
@@ -946,13 +625,14 @@ static void show_menu_bar_dialog(AppData *app_data) {
     gtk_widget_set_halign(right_title, GTK_ALIGN_START);
     
     // Menu tree
-    menu_tree_store = gtk_tree_store_new(1, G_TYPE_STRING);
+    menu_tree_store = gtk_tree_store_new(MENU_TREE_N_COLUMNS, G_TYPE_STRING,
+                                         G_TYPE_POINTER, G_TYPE_POINTER);
     menu_tree_view = gtk_tree_view_new_with_model(GTK_TREE_MODEL(menu_tree_store));
     
     // Add column
     renderer = gtk_cell_renderer_text_new();
     column = gtk_tree_view_column_new_with_attributes(
-        "Menu Structure", renderer, "text", 0, NULL);
+        "Menu Structure", renderer, "text", MENU_TREE_COL_LABEL, NULL);
     gtk_tree_view_append_column(GTK_TREE_VIEW(menu_tree_view), column);
     
     // Add scrolled window for tree
@@ -986,8 +666,8 @@ static void show_menu_bar_dialog(AppData *app_data) {
         .orientation_combo = orientation_combo,
         .x_position_spin = x_position_spin,
         .y_position_spin = y_position_spin,
-        .current_items = NULL,
-        .all_menus = NULL,
+        .current_items = g_ptr_array_new(),
+        .menus_by_name = g_hash_table_new(g_str_hash, g_str_equal),
         .menu_bar = NULL,
         .hierarchy_store = app_data->hierarchy_store
     };
@@ -1011,26 +691,36 @@ static void show_menu_bar_dialog(AppData *app_data) {
                              G_CALLBACK(on_widget_button_press_select), app_data);
         // Add menu bar to preview area
         add_menu_bar_to_container(app_data->preview_area, dialog_data.menu_bar);
+        // The bar owns its model: destroying it frees the menus and their items
+        memoire_attacher(dialog_data.menu_bar->widget, dialog_data.menu_bar,
+                         (GDestroyNotify)free_menu_bar);
         
         // Add to hierarchy
         GtkTreeIter iter;
-        gtk_tree_store_append(app_data->hierarchy_store, &iter, NULL);
-        gtk_tree_store_set(app_data->hierarchy_store, &iter, 
-                          0, g_strdup_printf("Menu Bar (x:%d, y:%d)", 
+        gchar *bar_label = g_strdup_printf("Menu Bar (x:%d, y:%d)",
                                            dialog_data.menu_bar->x_position,
-                                           dialog_data.menu_bar->y_position),
-                          1, dialog_data.menu_bar->widget, -1);
+                                           dialog_data.menu_bar->y_position);
+        gtk_tree_store_insert_with_values(app_data->hierarchy_store, &iter, NULL, -1,
+                                          HIERARCHY_COL_LABEL, bar_label,
+                                          HIERARCHY_COL_WIDGET, dialog_data.menu_bar->widget, -1);
+        g_free(bar_label);
         
         // Build hierarchy
-        build_menu_hierarchy(app_data->hierarchy_store, &iter, dialog_data.all_menus);
+        build_menu_hierarchy(app_data->hierarchy_store, &iter, dialog_data.menu_bar);
         
         // Expand tree
         gtk_tree_view_expand_all(GTK_TREE_VIEW(app_data->hierarchy_view));
+    } else if (dialog_data.menu_bar) {
+        // Cancelled: the bar was never placed
+        gtk_widget_destroy(dialog_data.menu_bar->widget);
+        free_menu_bar(dialog_data.menu_bar);
     }
     
     // Cleanup
-    g_list_free_full(dialog_data.current_items, (GDestroyNotify)free_menu_item);
-    // Note: dialog_data.all_menus and dialog_data.menu_bar are now owned by the app
+    g_ptr_array_foreach(dialog_data.current_items, (GFunc)free_menu_item, NULL);
+    g_ptr_array_free(dialog_data.current_items, TRUE);
+    g_hash_table_destroy(dialog_data.menus_by_name);
+    // Note: a placed dialog_data.menu_bar and its menus are now owned by its widget
     
     gtk_widget_destroy(dialog);
 }
@@ -1038,36 +728,9 @@ static void show_menu_bar_dialog(AppData *app_data) {
 /**
  * Build menu hierarchy in application's tree view
  */
-static void build_menu_hierarchy(GtkTreeStore *store, GtkTreeIter *parent, GList *menus) {
-    for (GList *node = menus; node; node = node->next) {
-        Menu *menu = (Menu*)node->data;
-        
-        // Skip submenus - they'll be added by their parents
-        if (menu->parent)
-            continue;
-        
-        // Add this menu to the tree
-        GtkTreeIter menu_iter;
-        gtk_tree_store_append(store, &menu_iter, parent);
-        
-        // Add menu with its type as the label
-        gtk_tree_store_set(store, &menu_iter, 0, 
-                         g_strdup_printf("Menu: %s", menu->name),
-                         1, menu->menu_item, -1);
-        
-        // Add menu items
-        for (GList *item_node = menu->items; item_node; item_node = item_node->next) {
-            // Check if this is a MenuItem
-            MenuItem *item = (MenuItem*)item_node->data;
-            if (!item->is_separator) {
-                GtkTreeIter item_iter;
-                gtk_tree_store_append(store, &item_iter, &menu_iter);
-                gtk_tree_store_set(store, &item_iter, 0, item->label, 1, item->widget, -1);
-            }
-        }
-            
-        // Recursively add its submenus
-        add_submenus_to_tree(store, &menu_iter, menu->name, menus);
+static void build_menu_hierarchy(GtkTreeStore *store, GtkTreeIter *parent, MenuBar *bar) {
+    for (guint i = 0; i < bar->menus->len; i++) {
+        add_menu_to_hierarchy(store, parent, g_ptr_array_index(bar->menus, i), "Menu");
     }
 }
 
@@ -1092,36 +755,16 @@ static void create_submenu_clicked(GtkWidget *button, MenuDialogData *main_dialo
     GtkTreeIter selected_iter;
      
     if (!gtk_tree_selection_get_selected(selection, &model, &selected_iter)) {
-        GtkWidget *error_dialog = gtk_message_dialog_new(
-            GTK_WINDOW(main_dialog_data->dialog),
-            GTK_DIALOG_MODAL,
-            GTK_MESSAGE_ERROR,
-            GTK_BUTTONS_OK,
-            "Please select a parent menu in the tree"
-        );
-        gtk_dialog_run(GTK_DIALOG(error_dialog));
-        gtk_widget_destroy(error_dialog);
+        show_menu_dialog_error(main_dialog_data->dialog, "Please select a parent menu in the tree");
         return;
     }
      
-    // Get selected menu name
-    gchar *parent_label;
-    gtk_tree_model_get(model, &selected_iter, 0, &parent_label, -1);
-    char *parent_name = parse_menu_name(parent_label);
-    Menu *parent_menu = find_menu_by_name(main_dialog_data, parent_name);
+    // Get selected menu
+    Menu *parent_menu = NULL;
+    gtk_tree_model_get(model, &selected_iter, MENU_TREE_COL_MENU, &parent_menu, -1);
      
     if (!parent_menu) {
-        GtkWidget *error_dialog = gtk_message_dialog_new(
-            GTK_WINDOW(main_dialog_data->dialog),
-            GTK_DIALOG_MODAL,
-            GTK_MESSAGE_ERROR,
-            GTK_BUTTONS_OK,
-            "Invalid parent menu selected"
-        );
-        gtk_dialog_run(GTK_DIALOG(error_dialog));
-        gtk_widget_destroy(error_dialog);
-        g_free(parent_name);
-        g_free(parent_label);
+        show_menu_dialog_error(main_dialog_data->dialog, "Invalid parent menu selected");
         return;
     }
      
@@ -1155,7 +798,9 @@ static void create_submenu_clicked(GtkWidget *button, MenuDialogData *main_dialo
     gtk_grid_attach(GTK_GRID(grid), orientation_combo, 1, 1, 2, 1);
      
     // Parent menu info
-    GtkWidget *parent_info = gtk_label_new(g_strdup_printf("Will be added to menu: %s", parent_name));
+    gchar *parent_text = g_strdup_printf("Will be added to menu: %s", parent_menu->name);
+    GtkWidget *parent_info = gtk_label_new(parent_text);
+    g_free(parent_text);
     gtk_grid_attach(GTK_GRID(grid), parent_info, 0, 2, 3, 1);
      
     gtk_container_add(GTK_CONTAINER(content_area), grid);
@@ -1167,6 +812,7 @@ static void create_submenu_clicked(GtkWidget *button, MenuDialogData *main_dialo
     gtk_container_add(GTK_CONTAINER(items_frame), items_box);
      
     // List store and view for items
+     items_list_store = gtk_list_store_new(2, G_TYPE_STRING, G_TYPE_STRING);
      items_list_view = gtk_tree_view_new_with_model(GTK_TREE_MODEL(items_list_store));
      
      // Add columns
@@ -1209,11 +855,11 @@ static void create_submenu_clicked(GtkWidget *button, MenuDialogData *main_dialo
          .items_list_view = items_list_view,
          .items_list_store = items_list_store,
          .orientation_combo = orientation_combo,
-         .current_items = NULL,
+         .current_items = g_ptr_array_new(),
          .selected_parent = parent_menu,
          .menu_tree_store = main_dialog_data->menu_tree_store,
          .menu_tree_view = main_dialog_data->menu_tree_view,
-         .all_menus = main_dialog_data->all_menus
+         .menus_by_name = main_dialog_data->menus_by_name
      };
      
      // Connect signals for item management
@@ -1228,82 +874,34 @@ static void create_submenu_clicked(GtkWidget *button, MenuDialogData *main_dialo
          const char *submenu_name = gtk_entry_get_text(GTK_ENTRY(name_entry));
          
          // Validate submenu name
-         if (!submenu_name || !*submenu_name) {
-             GtkWidget *error_dialog = gtk_message_dialog_new(
-                 GTK_WINDOW(dialog),
-                 GTK_DIALOG_MODAL,
-                 GTK_MESSAGE_ERROR,
-                 GTK_BUTTONS_OK,
-                 "Please enter a submenu name"
-             );
-             gtk_dialog_run(GTK_DIALOG(error_dialog));
-             gtk_widget_destroy(error_dialog);
-         } else if (!submenu_data.current_items) {
+         if (!validate_menu_name(main_dialog_data, dialog, submenu_name)) {
+             // Nothing is added
+         } else if (submenu_data.current_items->len == 0) {
              // Validate that we have at least one item
-             GtkWidget *error_dialog = gtk_message_dialog_new(
-                 GTK_WINDOW(dialog),
-                 GTK_DIALOG_MODAL,
-                 GTK_MESSAGE_ERROR,
-                 GTK_BUTTONS_OK,
-                 "Please add at least one menu item"
-             );
-             gtk_dialog_run(GTK_DIALOG(error_dialog));
-             gtk_widget_destroy(error_dialog);
+             show_menu_dialog_error(dialog, "Please add at least one menu item");
          } else {
              // Get orientation
              gint orientation_idx = gtk_combo_box_get_active(GTK_COMBO_BOX(orientation_combo));
              MenuOrientation orientation = (orientation_idx == 0) ? 
                                         MENU_ORIENTATION_VERTICAL : MENU_ORIENTATION_HORIZONTAL;
              
-             // Create the submenu
-             Menu *submenu = create_menu(submenu_name, orientation);
-             
-             // Add all items to the submenu
-             for (GList *node = submenu_data.current_items; node; node = node->next) {
-                 MenuItem *item = (MenuItem*)node->data;
-                 add_item_to_menu(submenu, item);
-             }
+             // Create the submenu with the composed items
+             Menu *submenu = create_menu_from_current_items(&submenu_data, submenu_name, orientation);
              
              // Add submenu to parent menu
              add_submenu_to_menu(parent_menu, submenu);
              
-             // Add to all_menus list
-             main_dialog_data->all_menus = g_list_append(main_dialog_data->all_menus, submenu);
-             
-             // Update tree view
-             GtkTreeIter submenu_iter;
-             gtk_tree_store_append(main_dialog_data->menu_tree_store, &submenu_iter, &selected_iter);
-             gtk_tree_store_set(main_dialog_data->menu_tree_store, &submenu_iter, 0, 
-                              g_strdup_printf("Submenu: %s (%s)", submenu->name, 
-                                            orientation == MENU_ORIENTATION_VERTICAL ? 
-                                            "Vertical" : "Horizontal"), 
-                              -1);
-             
-             // Add menu items as children in tree view
-             for (GList *node = submenu->items; node; node = node->next) {
-                 MenuItem *item = (MenuItem*)node->data;
-                 
-                 GtkTreeIter item_iter;
-                 gtk_tree_store_append(main_dialog_data->menu_tree_store, &item_iter, &submenu_iter);
-                 
-                 if (item->is_separator) {
-                     gtk_tree_store_set(main_dialog_data->menu_tree_store, &item_iter, 
-                                       0, "--- Separator ---", -1);
-                 } else {
-                     gtk_tree_store_set(main_dialog_data->menu_tree_store, &item_iter, 
-                                       0, item->label, -1);
-                 }
-             }
+             // Update tree view under the parent's row only
+             append_menu_rows(main_dialog_data->menu_tree_store, &selected_iter, submenu, "Submenu");
              
              // Expand tree to show new items
              gtk_tree_view_expand_all(GTK_TREE_VIEW(main_dialog_data->menu_tree_view));
          }
      }
      
-     // Cleanup
-     g_list_free_full(submenu_data.current_items, (GDestroyNotify)free_menu_item);
-     g_free(parent_name);
-     g_free(parent_label);
+     // Cleanup: items that were not added to a submenu
+     g_ptr_array_foreach(submenu_data.current_items, (GFunc)free_menu_item, NULL);
+     g_ptr_array_free(submenu_data.current_items, TRUE);
      
      gtk_widget_destroy(dialog);
  }
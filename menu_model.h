@@ -0,0 +1,331 @@
+#ifndef MENU_MODEL_H
+#define MENU_MODEL_H
+
+#include <gtk/gtk.h>
+#include "global.h"
+
+/**
+ * Menu model shared by the menu editor (menu_dialog.h) and the XML loader
+ * (menu_xml.h). It holds no editor state, so loaders can build menus with it.
+ */
+
+// Maximum string length for names and labels
+#define MAX_LABEL_LENGTH 100
+
+/**
+ * Menu orientation enumeration
+ */
+typedef enum {
+    MENU_ORIENTATION_VERTICAL,   // Standard dropdown menu
+    MENU_ORIENTATION_HORIZONTAL  // Horizontal menu items
+} MenuOrientation;
+
+/**
+ * MenuItem structure - represents a single menu item
+ */
+typedef struct {
+    char label[MAX_LABEL_LENGTH];        // Menu item text
+    char callback[MAX_LABEL_LENGTH];     // Optional callback function name
+    GtkWidget *widget;                   // The GTK menu item widget (NULL until its menu is built)
+    gboolean is_separator;               // Whether this is a separator
+    struct Menu *submenu;                // Submenu opened by this entry (NULL for plain items)
+} MenuItem;
+
+/**
+ * Menu structure - represents a menu that contains menu items
+ */
+typedef struct Menu {
+    char name[MAX_LABEL_LENGTH];         // Menu name (shown in menu bar)
+    GtkWidget *menu_widget;              // The GTK menu widget (NULL until its item exists)
+    GtkWidget *menu_item;                // Menu's item in parent (bar or submenu)
+    GPtrArray *items;                    // Child MenuItems, in order (submenus are entries with ->submenu set)
+    MenuOrientation orientation;         // Menu orientation
+    struct Menu *parent;                 // Parent menu (NULL if attached to bar)
+    gboolean built;                      // TRUE once menu_widget holds the item widgets
+} Menu;
+
+/**
+ * MenuBar structure - represents the top-level menu bar
+ */
+typedef struct {
+    GtkWidget *widget;                   // The GTK menu bar widget
+    GPtrArray *menus;                    // Attached menus, in order
+    int x_position;                      // X coordinate in parent container
+    int y_position;                      // Y coordinate in parent container
+} MenuBar;
+
+/**
+ * Create a new menu item
+ */
+static MenuItem* create_menu_item(const char *label, const char *callback) {
+    MenuItem *item = memoire_allouer(MEMOIRE_MENUS, sizeof(MenuItem));
+    
+    // Initialize with default values
+    strncpy(item->label, label, MAX_LABEL_LENGTH - 1);
+    item->label[MAX_LABEL_LENGTH - 1] = '\0';
+    
+    if (callback) {
+        strncpy(item->callback, callback, MAX_LABEL_LENGTH - 1);
+        item->callback[MAX_LABEL_LENGTH - 1] = '\0';
+    } else {
+        item->callback[0] = '\0';
+    }
+    
+    item->widget = NULL;
+    item->is_separator = FALSE;
+    item->submenu = NULL;
+    
+    return item;
+}
+
+/**
+ * Create a menu separator item
+ */
+static MenuItem* create_menu_separator() {
+    MenuItem *item = memoire_allouer(MEMOIRE_MENUS, sizeof(MenuItem));
+    
+    // Initialize as separator
+    item->label[0] = '\0';
+    item->callback[0] = '\0';
+    item->widget = NULL;
+    item->is_separator = TRUE;
+    item->submenu = NULL;
+    
+    return item;
+}
+
+/**
+ * Create a new menu. Only the data model is allocated here: the GtkMenu and
+ * its item widgets are built the first time the menu is about to open.
+ */
+static Menu* create_menu(const char *name, MenuOrientation orientation) {
+    Menu *menu = memoire_allouer(MEMOIRE_MENUS, sizeof(Menu));
+    
+    // Initialize menu
+    strncpy(menu->name, name, MAX_LABEL_LENGTH - 1);
+    menu->name[MAX_LABEL_LENGTH - 1] = '\0';
+    
+    menu->menu_widget = NULL;
+    menu->menu_item = NULL;
+    menu->items = g_ptr_array_new();
+    menu->orientation = orientation;
+    menu->parent = NULL;
+    menu->built = FALSE;
+    
+    return menu;
+}
+
+/**
+ * Create a new menu bar
+ */
+static MenuBar* create_menu_bar() {
+    MenuBar *bar = memoire_allouer(MEMOIRE_MENUS, sizeof(MenuBar));
+    
+    // Initialize menu bar
+    bar->widget = gtk_menu_bar_new();
+    bar->menus = g_ptr_array_new();
+    bar->x_position = 0;
+    bar->y_position = 0;
+    
+    return bar;
+}
+
+static void build_menu_widgets(Menu *menu);
+
+/**
+ * Build the menu when the pointer enters its parent item (prefetch on hover)
+ */
+static gboolean on_lazy_menu_item_enter(GtkWidget *widget, GdkEvent *event, Menu *menu) {
+    build_menu_widgets(menu);
+    return FALSE;
+}
+
+/**
+ * Build the menu when its parent item is selected (keyboard navigation, mnemonics)
+ */
+static void on_lazy_menu_item_select(GtkMenuItem *menu_item, Menu *menu) {
+    build_menu_widgets(menu);
+}
+
+/**
+ * Create the item that opens a menu, with an empty GtkMenu attached to it.
+ * The GtkMenu is only filled by build_menu_widgets() when the item is first
+ * hovered or selected, so deep menus cost nothing until they are opened.
+ */
+static GtkWidget* create_lazy_menu_item(Menu *menu) {
+    menu->menu_item = gtk_menu_item_new_with_label(menu->name);
+    menu->menu_widget = gtk_menu_new();
+    menu->built = FALSE;
+    gtk_menu_item_set_submenu(GTK_MENU_ITEM(menu->menu_item), menu->menu_widget);
+    
+    g_signal_connect(menu->menu_item, "enter-notify-event",
+                     G_CALLBACK(on_lazy_menu_item_enter), menu);
+    g_signal_connect(menu->menu_item, "select",
+                     G_CALLBACK(on_lazy_menu_item_select), menu);
+    
+    return menu->menu_item;
+}
+
+/**
+ * Create the widget of one menu entry and place it in the built menu
+ */
+static void attach_menu_entry(Menu *menu, MenuItem *item, int position) {
+    // Create the GTK widget for this item
+    if (item->is_separator) {
+        item->widget = gtk_separator_menu_item_new();
+    } else if (item->submenu) {
+        item->widget = create_lazy_menu_item(item->submenu);
+    } else {
+        item->widget = gtk_menu_item_new_with_label(item->label);
+    }
+    
+    // Add the item to the menu
+    if (menu->orientation == MENU_ORIENTATION_VERTICAL) {
+        // Standard vertical menu
+        gtk_menu_shell_append(GTK_MENU_SHELL(menu->menu_widget), item->widget);
+    } else {
+        // Horizontal menu - use menu_attach to place items side by side
+        gtk_menu_attach(GTK_MENU(menu->menu_widget), item->widget, 
+                       position, position + 1, 0, 1);
+    }
+    
+    // Show the widget
+    gtk_widget_show(item->widget);
+}
+
+/**
+ * Create the widgets of a menu's entries the first time it is needed.
+ * Submenus only get their (empty) parent item here, one level at a time.
+ */
+static void build_menu_widgets(Menu *menu) {
+    if (!menu || menu->built || !menu->menu_widget) return;
+    
+    menu->built = TRUE;
+    for (guint i = 0; i < menu->items->len; i++) {
+        attach_menu_entry(menu, g_ptr_array_index(menu->items, i), i);
+    }
+}
+
+/**
+ * Add a menu item to a menu
+ */
+static void add_item_to_menu(Menu *menu, MenuItem *item) {
+    if (!menu || !item) return;
+    
+    int position = menu->items->len;
+    
+    // Store the item in the menu's items array
+    g_ptr_array_add(menu->items, item);
+    
+    // Menus that were already opened get the widget right away
+    if (menu->built) {
+        attach_menu_entry(menu, item, position);
+    }
+}
+
+/**
+ * Add a submenu to a parent menu
+ */
+static void add_submenu_to_menu(Menu *parent, Menu *submenu) {
+    if (!parent || !submenu) return;
+    
+    // The submenu is an entry of its parent, opened through its own item
+    MenuItem *entry = create_menu_item(submenu->name, NULL);
+    entry->submenu = submenu;
+    
+    // Update parent reference
+    submenu->parent = parent;
+    
+    add_item_to_menu(parent, entry);
+}
+
+/**
+ * Add a menu to a menu bar
+ */
+static void add_menu_to_bar(MenuBar *bar, Menu *menu) {
+    if (!bar || !menu) return;
+    
+    // Create the menu's item; its entries are built on first hover/activation
+    create_lazy_menu_item(menu);
+    
+    // Add the menu item to the menu bar
+    gtk_menu_shell_append(GTK_MENU_SHELL(bar->widget), menu->menu_item);
+    
+    // Add to bar's menus array
+    g_ptr_array_add(bar->menus, menu);
+    
+    // Show the widget
+    gtk_widget_show(menu->menu_item);
+}
+
+static void free_menu(Menu *menu);
+
+/**
+ * Free memory used by a menu item (and the submenu it opens, if any)
+ */
+static void free_menu_item(MenuItem *item) {
+    if (item) {
+        // GTK will handle freeing the widget
+        free_menu(item->submenu);
+        memoire_liberer(item);
+    }
+}
+
+/**
+ * Free memory used by a menu, its items and its submenus.
+ * Submenus are queued rather than freed recursively, so a deep chain of
+ * submenus (loaded from XML) does not cost one stack frame per level.
+ */
+static void free_menu(Menu *menu) {
+    if (!menu) return;
+    GPtrArray *pending = g_ptr_array_new();
+    g_ptr_array_add(pending, menu);
+    
+    while (pending->len > 0) {
+        Menu *current = g_ptr_array_remove_index_fast(pending, pending->len - 1);
+        // Free all menu items, keeping their submenus for later
+        for (guint i = 0; i < current->items->len; i++) {
+            MenuItem *item = g_ptr_array_index(current->items, i);
+            if (item->submenu)
+                g_ptr_array_add(pending, item->submenu);
+            memoire_liberer(item);
+        }
+        g_ptr_array_free(current->items, TRUE);
+        
+        // GTK will handle freeing the widgets
+        memoire_liberer(current);
+    }
+    g_ptr_array_free(pending, TRUE);
+}
+
+/**
+ * Free memory used by a menu bar and all its menus
+ */
+static void free_menu_bar(MenuBar *bar) {
+    if (bar) {
+        // Free all menus
+        g_ptr_array_foreach(bar->menus, (GFunc)free_menu, NULL);
+        g_ptr_array_free(bar->menus, TRUE);
+        
+        // GTK will handle freeing the widget
+        memoire_liberer(bar);
+    }
+}
+
+/**
+ * Add menu to container at specified position
+ */
+static void add_menu_bar_to_container(GtkWidget *container, MenuBar *bar) {
+    if (!GTK_IS_FIXED(container) || !bar) return;
+    // MenuBar
+    // / Register the widget for property editing
+            // g_signal_connect(bar, "button-press-event",
+                            //  G_CALLBACK(on_widget_button_press_select), app_data);
+    // Add the menu bar to the fixed container at specified position
+    gtk_fixed_put(GTK_FIXED(container), bar->widget, bar->x_position, bar->y_position);
+    
+    // Show the widget with the rest of the batch
+    afficher_plus_tard(bar->widget);
+}
+
+#endif /* MENU_MODEL_H */
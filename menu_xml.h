@@ -8,339 +8,200 @@
 #include <gtk/gtk.h>
 #include "button.h"
 #include "xml_utility.h"
+#include "menu_model.h"
 #define MAX 40
 
-typedef struct sp
+//Un niveau de la pile: un menu ouvert pendant la lecture
+typedef struct
 {
-    Menu *parent;/* l'élement de la liste */
-    struct sp *svt; /* poiteur sur l'élement au suivant */
-}subPile;
+    Menu *menu;             /* le menu qui reçoit les menuitem lus */
+    int ouvert_par_submenu; /* 1: ouvert par le <submenu> d'un menuitem, 0: un <menu> de la barre */
+}NiveauMenu;
 
-//
-subPile *Creer_Cellule(Menu *parent)
+//Pile des menus ouverts, dans un tableau qui grandit par doublement:
+//aucune allocation par niveau, empiler et depiler sont en O(1)
+typedef struct
 {
-    subPile *NE;
-    /* Allouer la mémoire pour NE */
-    NE=(subPile*) malloc(sizeof (subPile));
-    if(!NE)/*L'allocation est mal passé */
-    {
-        /* Afficher un message d'errreur */
-        printf("\nErreur d allocation du memoire.");
-        /*Sortir du programme */
-        exit(-1);
-    }
-    /* Ajouter l'élément */
-    NE->parent=parent;
-    /* Indiquer que le noueud crée n'a pas de séccessur */
-    NE->svt=NULL;
-    return ((subPile*)NE);/* Recupérere le noeud cré */
-}
+    NiveauMenu *niveaux;    /* le tableau des niveaux (le sommet est à la fin) */
+    int taille;             /* nombre de niveaux empilés */
+    int capacite;           /* nombre de niveaux alloués */
+}PileMenus;
 
-
-int Est_Vide_subPile(subPile *mapile)
+//Elément dont on lit les propriétés et qui n'est pas encore créé
+typedef struct
 {
-    return ((int)(mapile==NULL));
-}
+    int type;               /* 0: aucun, 14: <menu>, 16: <menuitem> */
+    char label[MAX_LABEL_LENGTH];/* le titre du menu ou le label du menuitem */
+}ElementMenu;
 
-subPile *Vider_subPile(subPile *mapile)
+
+void Empiler_Menu(PileMenus *pile, Menu *menu, int ouvert_par_submenu)
 {
-    subPile *tmp;
-    // Utilisation d'une boucle pour parcourir la liste
-    while (mapile)
+    if(pile->taille == pile->capacite)
     {
-        tmp = mapile; // Stockage du pointeur vers le nœud actuel dans tmp
-        mapile = mapile->svt; /* Mise à jour du pointeur Liste pour passer
-		au nœud suivant*/
-        free(tmp); // Libération de la mémoire occupée par le nœud actuel
+        pile->capacite = pile->capacite ? 2 * pile->capacite : 8;
+        pile->niveaux = (NiveauMenu*) memoire_reallouer(MEMOIRE_MENUS, pile->niveaux,
+                                                        pile->capacite * sizeof(NiveauMenu));
+        if(!pile->niveaux)
+        {
+            printf("\nErreur d allocation du memoire.");
+            exit(-1);
+        }
     }
-    // À la fin, Liste est NULL, indiquant que la liste est vidée
-    return ((subPile*)mapile);
+    pile->niveaux[pile->taille].menu = menu;
+    pile->niveaux[pile->taille].ouvert_par_submenu = ouvert_par_submenu;
+    pile->taille++;
 }
 
-subPile *Empiler(subPile *mapile,  Menu *parent)
+void Depiler_Menu(PileMenus *pile)
 {
-    subPile*ne=Creer_Cellule(parent);
-    // Vérification que macel n'est pas vide (pile non vide)
-    if (!Est_Vide_subPile(mapile))
-    {
-        ne->svt = mapile; /* Mise à jour du pointeur svt de macel
- pour pointer vers l'ancienne sommet de pile*/
-        mapile = ne; /*Mise à jour de mapile pour pointer vers macel,
- qui est maintenant la nouvelle sommet de pile*/
-    }
-    return ((subPile*)ne);/*Renvoi du pointeur mis à jour vers la
- sommet de la pile*/
+    if(pile->taille > 0) pile->taille--;
 }
-//////////////////
-subPile *Depiler(subPile *mapile)
+
+//Le niveau au sommet de la pile, NULL si la pile est vide
+NiveauMenu *Sommet_Menu(PileMenus *pile)
 {
-    subPile *tmp;
-    // Vérification que la pile n'est pas vide
-    if (!Est_Vide_subPile(mapile))
-    {
-        tmp = mapile; // Stockage du premier nœud dans tmp
-        mapile = mapile->svt; /* Mise à jour de mapile pour pointer
-	 vers le deuxième nœud*/
-        free(tmp); // Libération de la mémoire occupée par le premier nœud
-    }
-    // Renvoi du pointeur mis à jour vers la pile
-    return ((subPile *)mapile);
+    return ((pile->taille > 0) ? &pile->niveaux[pile->taille - 1] : NULL);
 }
 
-void Afficher_Ppile(subPile *mapile)
+void Liberer_Pile_Menus(PileMenus *pile)
 {
-    printf("\naffichage de la pile:\n");
-    subPile *tmp, *pcrt;
-    int i =0;
-    // Si la pile est vide, affichage d'un message approprié et retour
-    if (Est_Vide_subPile(mapile))
-    {
-        printf("\nLa pile est vide");
-        return;
-    }
-    tmp = NULL;
-    // Affichage des éléments de la pile
-    while (!Est_Vide_subPile(mapile))
-    {
-        printf("\n%deme sub", i+1);//Afficher la valeur de l'élément
-        pcrt = mapile;
-        mapile = mapile->svt;
-        pcrt->svt = tmp;
-        tmp = pcrt; // tmp conserve la cellule pour replacer plus tard
-        i++;
-    }
-    // Replacer les cellules dans l'ordre initial de la pile
-    while (!Est_Vide_subPile(tmp))
-    {
-        pcrt = tmp;
-        tmp = tmp->svt;
-        pcrt->svt = mapile;
-        mapile = pcrt;
-    }
+    memoire_liberer(pile->niveaux);
+    pile->niveaux = NULL;
+    pile->taille = pile->capacite = 0;
 }
 
-
-//fct de creation d'un sous menu a partir xml
 /**********************************************************************************
- -Nom : submenu_xml
- -Entrees : File *file : pointeur sur le fichier text,
-            Menu* menu_parent : pointeur sur le menu pere
- -Sortie: un entier qui indique l'id de dernier balise lue.
- -Description: Cette fonction permet de créer un submenu et l'associer a son menu
+ -Nom : creer_element_menu
+ -Entrees : ElementMenu *element : l'élément en attente,
+            PileMenus *pile : la pile des menus ouverts,
+            MenuBar *barre : la barre de menu,
+            MenuOrientation orientation : l'orientation des menus
+ -Sortie: -
+ -Description: Crée l'élément dont les propriétés viennent d'etre lues: un <menu>
+ est ajouté à la barre et empilé, un <menuitem> est ajouté au menu du sommet.
 *********************************************************************************/
-
-void submenu_xml(FILE*file,subPile*mapile)
+void creer_element_menu(ElementMenu *element, PileMenus *pile, MenuBar *barre,
+                        MenuOrientation orientation)
 {
-    Menu*menu_parent=mapile->parent;
-    int test;
-    char val[MAX];
-    int has_accel=0, has_submenu=0;
-    gchar *title_gchar="",*icon_gchar="";
-    //creation d'ouvrir
-    Menu *submenu = NULL;
-    submenu=(Menu*)malloc(sizeof(Menu));
-    if(!submenu) exit(-1);
-    //tant qu'on a des propriete de menuitem
-    while((test=balise(file))==22)
+    NiveauMenu *sommet = Sommet_Menu(pile);
+    if(element->type == 14)
     {
-        Epeurerblanc(file);
-        fseek(file, 6, SEEK_CUR);
-        fscanf(file, "%s", val);
-        if (!(strcmp("label\"", val)))
-        {
-            lire_gchar_str(file,val);
-            title_gchar = g_strdup(val);
-        }//fin if
-        else if (!(strcmp("has_submenu\"", val)))
-            has_submenu = char_TO_int(lire_gchar(file)) ;
-        else if (!(strcmp("icon\"", val)))
-        {
-            lire_gchar_str(file,val);
-            icon_gchar = g_strdup(val);
-        }//fin else if
-        else if (!(strcmp("has_accel\"", val)))
-            has_accel= char_TO_int(lire_gchar(file));
-    }//fin   while((test=balise(file))==22)
-    ///proprietes de menu item sont fini
-    //creation de menu item de submenu
-    if(strlen(icon_gchar)==0)
-    { printf("\nicon videeeee!alors creation sans icon");
-        submenu=ajout_elem_to_submenu(menu_parent,
-                                      title_gchar,has_submenu,NULL,"");
-    }//fin if
-    else if((has_accel==0) && strlen(icon_gchar)!=0 )
-    {
-        printf("creation de submenu");
-        submenu=ajout_elem_to_submenu(menu_parent,
-                                      title_gchar,has_submenu,
-                                      NULL,icon_gchar);
-    }//fin else if
-    else if((has_accel==1) && strlen(icon_gchar)!=0 )
-        submenu=ajout_elem_to_submenu_with_accel_and_icon
-                (menu_parent,title_gchar,
-                 has_submenu,NULL,icon_gchar,
-                 GDK_KEY_o,GDK_CONTROL_MASK);
-    if(test==-15)
-    {
-        printf("\non est dans le cas de test==(-15)\nfin de submenu");
-
-        while(test==-15){
-            mapile=Depiler(mapile);
-            test=balise(file);
-        }
-
-        if(!mapile)
-        {
-            printf("\npile vide\non a sortie de submenu_xml1\n");
-
-            return;
-
-        }
-        printf("\npile n'est pas vide");
-        //test=balise(file);
-        //printf("\ntest=%d",test);
-        submenu_xml(file,mapile);
-
+        Menu *menu = create_menu(element->label, orientation);
+        add_menu_to_bar(barre, menu);
+        Empiler_Menu(pile, menu, 0);
     }
-        //printf("\n  test == %d",test);
-    else if(test==16)
+    else if(element->type == 16)
     {
-        printf("\non est dans le cas de test==16\n");
-        submenu_xml(file,mapile);
+        if(sommet)
+            add_item_to_menu(sommet->menu, create_menu_item(element->label, NULL));
+        else
+            printf("\nmenuitem \"%s\" hors d'un menu, ignore", element->label);
     }
-    else if(test == 15)
-    {
-        //
-        printf("\non est dans le cas de test ==15");
-        mapile = Empiler(mapile,submenu);
-        //on est dans le cas de submenu d'un menuitem d'un submenu de niv 1 //ex :OUvrir
-
-        test = balise(file);//on a lue un menuitem apres sub
-        //if (test == 16) printf("\non a lue un menuitem apres sub <lvl2>\n");
-        submenu_xml(file, mapile);
+    element->type = 0;
+    element->label[0] = '\0';
+}
 
-        //sub_rec_xml(file,mapile,test);
-    }
-}//fin de fonction submenu_xml
-void menu_xml(FILE*file,Menu *menu_parent);
 //fct de creation de menu barre a partir xml
 /**********************************************************************************
  -Nom : menu_barre_xml
  -Entrees : File *file : pointeur sur le fichier text,
             int parent : indice de parent
  -Sortie: -
- -Description: Cette fonction permet de créer le menu barre
- ainsi que le premier menu en respectant les propriétés décrites dans le fichier
+ -Description: Cette fonction permet de créer le menu barre avec tous ses menus
+ et sous-menus en respectant les propriétés décrites dans le fichier.
+ La lecture est une boucle sur les balises: chaque <submenu> d'un menuitem empile
+ un niveau et chaque </submenu> le dépile, sans récursion, donc la profondeur
+ des sous-menus ne dépend pas de la pile d'appels.
 *********************************************************************************/
 void menu_barre_xml(FILE *file,int parent)
 {
-    int test, has_accel=0,has_submenu=0;
-    char val[MAX],orientation,*title_gchar;
-    Menu *menu_parent = NULL;
-    menu_parent=(Menu*)malloc(sizeof(Menu));
-    if(!menu_parent) exit(-1);
-    while ((test = balise(file)) == 22)
-    {
-        Epeurerblanc(file);
-        fseek(file, 6, SEEK_CUR);
-        fscanf(file, "%s", val);
+    int test, x=0, y=0;
+    char val[MAX];
+    MenuOrientation orientation = MENU_ORIENTATION_VERTICAL;
+    MenuBar *barre = create_menu_bar();
+    PileMenus pile = {NULL, 0, 0};
+    ElementMenu element = {0, ""};
 
-        //recuperation du l'orientation de box
-        if (!(strcmp("orientation\"", val))) {
-            orientation = lire_gchar(file);
-            menu_parent->m_barre.orientation = orientation;
-        }
-    }//fin while ((test = balise(file)) == 22)
-    //lecture de premier menu de menu_barre, exit sinon
-    if(test!=14) exit(-1);
-    //lecture des proprietes de menu
-    while((test=balise(file))==22)
+    while((test = balise(file)) != -1)
     {
-        Epeurerblanc(file);
-        fseek(file, 6, SEEK_CUR);
-        fscanf(file, "%s", val);
-        if (!(strcmp("title\"", val)))
+        switch(test)
         {
-            lire_gchar_str(file,val);
-            title_gchar = g_strdup(val);
+            //propriété de la barre, du menu ou du menuitem en cours
+            case 22:
+                Epeurerblanc(file);
+                fseek(file, 6, SEEK_CUR);
+                fscanf(file, "%39s", val); //MAX - 1 caractères au plus
+                if(!(strcmp("label\"", val)) || !(strcmp("title\"", val)))
+                    lire_gchar_str_borne(file, element.label, sizeof(element.label));
+                else if(!(strcmp("orientation\"", val)))
+                    orientation = (lire_gchar(file) == 'h') ?
+                                  MENU_ORIENTATION_HORIZONTAL : MENU_ORIENTATION_VERTICAL;
+                else if(!(strcmp("x\"", val)))
+                {
+                    lire_gchar_str_borne(file, val, sizeof(val));
+                    x = atoi(val);
+                }
+                else if(!(strcmp("y\"", val)))
+                {
+                    lire_gchar_str_borne(file, val, sizeof(val));
+                    y = atoi(val);
+                }
+                else
+                    lire_gchar_str_borne(file, val, sizeof(val));  //has_submenu, has_accel, icon: ignorés
+                break;
+            //début d'un menu de la barre ou d'un menuitem
+            case 14:
+            case 16:
+                creer_element_menu(&element, &pile, barre, orientation);
+                element.type = test;
+                break;
+            //<submenu>: le contenu d'un <menu>, ou un sous-menu ouvert par un menuitem
+            case 15:
+                if(element.type == 16)
+                {
+                    NiveauMenu *sommet = Sommet_Menu(&pile);
+                    Menu *sous_menu = create_menu(element.label, MENU_ORIENTATION_VERTICAL);
+                    if(sommet) add_submenu_to_menu(sommet->menu, sous_menu);
+                    Empiler_Menu(&pile, sous_menu, 1);
+                    element.type = 0;
+                    element.label[0] = '\0';
+                }
+                else creer_element_menu(&element, &pile, barre, orientation);
+                break;
+            //</submenu>: fermer le sous-menu ouvert par un menuitem
+            case -15:
+                creer_element_menu(&element, &pile, barre, orientation);
+                if(Sommet_Menu(&pile) && Sommet_Menu(&pile)->ouvert_par_submenu)
+                    Depiler_Menu(&pile);
+                break;
+            //</menu>: fermer le menu de la barre
+            case -14:
+                creer_element_menu(&element, &pile, barre, orientation);
+                while(Sommet_Menu(&pile) && Sommet_Menu(&pile)->ouvert_par_submenu)
+                    Depiler_Menu(&pile);
+                Depiler_Menu(&pile);
+                break;
+            default:break;
         }
-        else if (!(strcmp("has_accel\"", val)))
-            has_accel= char_TO_int(lire_gchar(file));
-        else if (!(strcmp("has_submenu\"", val)))
-            has_submenu = char_TO_int(lire_gchar(file));
-    } //fin while((test=balise(file))==22)
-
-    //creation de menu_principale
-    menu_parent=Creer_Menu_principale(title_gchar,menu_parent->m_barre.orientation,
-                                      parents[parent],has_submenu,NULL,has_accel);
-    if(test==15)
-    {
-        //lire le premier menuitem de submenu
-        test=balise(file);
-        subPile*mapile=NULL;
-        mapile=Empiler(mapile,menu_parent);
-        submenu_xml(file,mapile);
-        printf("\ntest de menu_bar %d",test);
-        test=balise(file);
-        if(test==14) menu_xml(file,menu_parent);
-    }//fin if
-
-    else if(test==-14)
-    {
-        test= balise(file);
-        //printf("\n test : %d on a trouver menu barre\n",test);
-        if(test==14)  menu_xml(file,menu_parent);
     }
-    creer_object(file,2);
-}//fin de la fonction menu_barre_xml
-//fct de creation de menu a partir xml
-/**********************************************************************************
- -Nom : menu_xml
- -Entrees : File *file : pointeur sur le fichier text,
-            Menu* menu_parent : pointeur sur le menu principale
- -Sortie: -
- -Description: Cette fonction permet de créer un menu et l'associer a son parent
- menu principale.
-*********************************************************************************/
-void menu_xml(FILE*file,Menu *menu_parent)
-{
-    int test, has_submenu=0;
-    char val[MAX];
-    gchar *title_gchar;
-    Menu *menu = NULL;
-    menu=(Menu*)malloc(sizeof(Menu));
-    if(!menu) exit(-1);
-    while((test=balise(file))==22)
-    {
-        Epeurerblanc(file);
-        fseek(file, 6, SEEK_CUR);
-        fscanf(file, "%s", val);
-        if (!(strcmp("label\"", val)))
-        {
-            lire_gchar_str(file,val);
-            title_gchar = g_strdup(val);
-        }//fin if
-        else if (!(strcmp("has_submenu\"", val)))
-            has_submenu = char_TO_int(lire_gchar(file));
-    }//fin while((test=balise(file))==22)
-    //creation de menu en l'associant au menu barre
-    menu=ajout_Menu_to_barre(*menu_parent,title_gchar,has_submenu,NULL);
-    if(test==15)
-    {
-        //lire le premier menuitem de submenu
-        test=balise(file);
-        subPile*mapile=NULL;
-        mapile=Empiler(mapile,menu);
-        submenu_xml(file,mapile);
-        test=balise(file);
-        if(test==14) menu_xml(file,menu_parent);
-    }//fin if
-    else if(test==-14)
-    {
-        test= balise(file);
-        //printf("\n test : %d on a trouver menu xml\n",test);
-        if(test==14) menu_xml(file,menu_parent);
+    //</menubarre> (ou fin de fichier)
+    creer_element_menu(&element, &pile, barre, orientation);
+    if(pile.taille) printf("\nmenubarre: %d menu(s) non fermé(s)", pile.taille);
+    Liberer_Pile_Menus(&pile);
+
+    //placer la barre dans son conteneur; la barre possède ses menus et les libère à sa destruction
+    barre->x_position = x;
+    barre->y_position = y;
+    memoire_attacher(barre->widget, barre, (GDestroyNotify)free_menu_bar);
+    if(GTK_IS_FIXED(parents[parent]))
+        add_menu_bar_to_container(parents[parent], barre);
+    else
+    {
+        gtk_container_add(GTK_CONTAINER(parents[parent]), barre->widget);
+        afficher_plus_tard(barre->widget);
     }
-}//fin de fonction menu_xml
+    creer_object(file, parent);
+}//fin de la fonction menu_barre_xml
 
 #endif //XML_TAHA_MENU_XML_H
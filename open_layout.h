@@ -0,0 +1,576 @@
+#ifndef OPEN_LAYOUT_H
+#define OPEN_LAYOUT_H
+
+#include <errno.h>
+#include <string.h>
+#include <gtk/gtk.h>
+#include "global.h"
+#include "xml_utility.h"
+#include "bouton_xml.h"
+#include "checkbox_xml.h"
+#include "dialog_xml.h"
+#include "radio_xml.h"
+#include "box.h"
+#include "menu_xml.h"
+#include "fixed_virtuel_xml.h"
+#include "app_data.h"
+#include "containers.h"
+#include "property_panel.h"
+#include "perf_panel.h"
+
+// Asynchronous "Open layout".
+// 1. A worker of the shared pool reads the file and splits the <children> of its
+//    <fixed> into one step per widget (ProgressTask on OPEN_LAYOUT_CHANNEL). A <box>
+//    is flattened: its own step only covers its properties, and every element of
+//    its <child> becomes a step of its own, queued after the box. No step is
+//    bounded by the size of a subtree. The worker also reads the x/y of each
+//    top-level element and sorts the elements top to bottom.
+//    Then it joins the texts of the steps in one stream for the whole load, each
+//    followed by the </children> the readers stop at after the last element of a
+//    container: the build never opens a file (or a tmpfile on Windows) per widget.
+// 2. The main loop builds the steps with the existing XML readers (creer_object
+//    from the step's offset in the stream) in a time-sliced job
+//    (progress_slices_run): each slice stops after PROGRESS_SLICE_BUDGET_US, so the
+//    editor keeps painting, and shows the widgets it built. Elements in the visible
+//    part of the target come first.
+// 3. When everything is built, the widgets are added to the Arbre and the
+//    hierarchy in one tree_sync batch. A cancelled or failed load destroys what
+//    it built and leaves both trees untouched.
+// Only one load runs at a time: opening another file cancels the current one.
+
+#define OPEN_LAYOUT_CHANNEL "open-layout"
+#define OPEN_LAYOUT_CHECK_EVERY 1024  // Steps split between two cancel checks
+#define OPEN_LAYOUT_MAX_NESTING 64    // Boxes nested deeper are built whole by one step
+#define OPEN_LAYOUT_STEP_END "\n</children>\n"  // Ends the text of each step in the stream
+
+// One step of the build: the text given to creer_object() and where it goes
+typedef struct {
+    gsize start;                  // Bounds of its text in the file
+    gsize end;
+    gsize at;                     // Start of its text in the stream
+    gsize parent;                 // start of the box holding it, 0 for the target
+    gboolean box;                 // the step builds a box whose children are later steps
+    guint block;                  // index of its top-level step (itself for a top-level one)
+    gint x;                       // position of the top-level step, 0 when it has none
+    gint y;
+} LayoutElement;
+
+typedef struct {
+    gchar *path;
+    gchar *text;                  // File contents, then the steps' texts once split
+    gsize length;
+    FILE *stream;                 // Reads text, opened by the worker
+    GArray *elements;             // LayoutElement, top to bottom then visible ones first;
+                                  // a box always comes before its children
+    GHashTable *boxes;            // start of a box step -> its GtkWidget (built so far)
+    GtkWidget *step_parent;       // Container of the step being built
+    GtkWidget *step_widget;       // Widget built by the step being built
+    GtkWidget *target;            // GtkFixed receiving the widgets (weak pointer)
+    AppData *app_data;            // NULL: the widgets are only shown
+    GCancellable *cancellable;
+    guint next;                   // Next element to build
+    GPtrArray *built;             // Top-level widgets built so far (referenced)
+    gint64 op_start;
+} LayoutLoad;
+
+static LayoutLoad *open_layout_current = NULL;
+// Progress rows made by create_open_layout_bar(), shown while a load runs
+static GSList *open_layout_rows = NULL;
+
+static void open_layout_show_rows(gboolean visible) {
+    for (GSList *l = open_layout_rows; l; l = l->next)
+        gtk_widget_set_visible(GTK_WIDGET(l->data), visible);
+}
+
+static void open_layout_free(LayoutLoad *load) {
+    if (load->target)
+        g_object_remove_weak_pointer(G_OBJECT(load->target), (gpointer *)&load->target);
+    g_ptr_array_unref(load->built);
+    g_hash_table_unref(load->boxes);
+    g_array_unref(load->elements);
+    g_object_unref(load->cancellable);
+    if (load->stream)
+        fclose(load->stream);
+    g_free(load->text);
+    g_free(load->path);
+    g_free(load);
+}
+
+// End of a load. Without success, the widgets built so far are destroyed.
+static void open_layout_finish(LayoutLoad *load, gboolean success) {
+    if (!success)
+        for (guint i = 0; i < load->built->len; i++)
+            gtk_widget_destroy(g_ptr_array_index(load->built, i));
+    if (open_layout_current == load) {
+        open_layout_current = NULL;
+        open_layout_show_rows(FALSE);
+    }
+    if (success)
+        perf_op_end(PERF_OP_LOAD, load->op_start);
+    open_layout_free(load);
+}
+
+// Integer attribute name=value of a start tag (<radioList x=0 y=300>), quotes optional
+static gboolean open_layout_attribute(const gchar *tag, const gchar *tag_end, const gchar *name, gint *value) {
+    gsize n = strlen(name);
+    for (const gchar *a = tag; a + n + 1 < tag_end; a++) {
+        if (!g_ascii_isspace(a[0]) || strncmp(a + 1, name, n) != 0 || a[n + 1] != '=')
+            continue;
+        const gchar *v = a + n + 2;
+        if (*v == '"' || *v == '\'')
+            v++;
+        *value = (gint)g_ascii_strtoll(v, NULL, 10);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+// Position given by <property name="x" >100</property> (or "y") of an element
+static void open_layout_property(const gchar *tag, const gchar *tag_end, LayoutElement *e) {
+    const gchar *name = g_strstr_len(tag, tag_end - tag, "name=\"");
+    if (!name || (name[6] != 'x' && name[6] != 'y') || name[7] != '"')
+        return;
+    gint value = (gint)g_ascii_strtoll(tag_end + 1, NULL, 10);
+    if (name[6] == 'x')
+        e->x = value;
+    else
+        e->y = value;
+}
+
+// Top-level elements top to bottom, then left to right. The steps of one top-level
+// element stay together in document order, so a box comes before its children.
+static gint open_layout_compare(gconstpointer a, gconstpointer b) {
+    const LayoutElement *ea = a;
+    const LayoutElement *eb = b;
+    if (ea->y != eb->y)
+        return ea->y < eb->y ? -1 : 1;
+    if (ea->x != eb->x)
+        return ea->x < eb->x ? -1 : 1;
+    if (ea->block != eb->block)
+        return ea->block < eb->block ? -1 : 1;
+    return ea->start < eb->start ? -1 : (ea->start > eb->start);
+}
+
+// A box being split: its step and the depths of its tag and of its <child> content
+typedef struct {
+    guint step;
+    gint depth;
+    gint child_depth;             // -1 until its <child> is found
+} LayoutBox;
+
+// Worker: read the file and split every element under <children> into steps.
+// <property> elements belong to their widget and are skipped whole.
+static gboolean open_layout_parse(ProgressTask *task, gpointer data, GCancellable *cancellable, GError **error) {
+    LayoutLoad *load = data;
+    TRACE_SPAN_DEBUT(debut);
+
+    progress_task_report(task, 0.0, "Reading layout...");
+    if (!g_file_get_contents(load->path, &load->text, &load->length, error))
+        return FALSE;
+
+    const gchar *p = strstr(load->text, "<children>");
+    if (!p) {
+        g_set_error(error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,
+                    "%s has no <children> element", load->path);
+        return FALSE;
+    }
+    p += strlen("<children>");
+    const gchar *end = load->text + load->length;
+    LayoutBox boxes[OPEN_LAYOUT_MAX_NESTING];
+    gint n_boxes = 0;
+    gint leaf_depth = -1;         // depth of the element built whole by the current step
+    gint depth = 0;
+    guint block = 0;
+
+    while (p < end && (p = memchr(p, '<', end - p))) {
+        const gchar *close = memchr(p, '>', end - p);
+        if (!close)
+            break;
+        if (g_str_has_prefix(p, "<property")) {
+            // Position of a top-level element (a leaf or a box)
+            if (depth == 1 && load->elements->len > 0)
+                open_layout_property(p, close, &g_array_index(load->elements, LayoutElement, block));
+            const gchar *end_property = strstr(close, "</property>");
+            if (!end_property)
+                break;
+            p = end_property + strlen("</property>");
+            continue;
+        }
+        gboolean closing = p[1] == '/';
+        gboolean empty = !closing && close[-1] == '/';    // <tag/>
+        if (closing && depth == 0)
+            break;                                         // </children>
+        LayoutBox *box = n_boxes ? &boxes[n_boxes - 1] : NULL;
+        gsize offset = p - load->text;
+
+        if (!closing && leaf_depth < 0) {
+            if (box && depth == box->depth + 1 && g_str_has_prefix(p, "<child")) {
+                // The box's own step stops before its children
+                g_array_index(load->elements, LayoutElement, box->step).end = offset;
+                box->child_depth = depth + 1;
+            }
+            else if (depth == 0 || (box && depth == box->child_depth)) {
+                LayoutElement e = { offset, 0, box ? g_array_index(load->elements, LayoutElement, box->step).start : 0,
+                                    FALSE, depth == 0 ? load->elements->len : block, 0, 0 };
+                if (depth == 0) {
+                    block = load->elements->len;
+                    open_layout_attribute(p, close, "x", &e.x);
+                    open_layout_attribute(p, close, "y", &e.y);
+                }
+                if (g_str_has_prefix(p, "<box") && !empty && n_boxes < OPEN_LAYOUT_MAX_NESTING) {
+                    e.box = TRUE;
+                    boxes[n_boxes++] = (LayoutBox){ load->elements->len, depth, -1 };
+                }
+                else
+                    leaf_depth = depth;
+                g_array_append_val(load->elements, e);
+            }
+        }
+        if (!closing)
+            depth++;
+        if (closing || empty)
+            depth--;
+        p = close + 1;
+
+        // End of the element built by the current step, or of a box
+        if ((closing || empty) && depth == leaf_depth) {
+            g_array_index(load->elements, LayoutElement, load->elements->len - 1).end = p - load->text;
+            leaf_depth = -1;
+        }
+        else if (closing && box && depth == box->depth) {
+            LayoutElement *b = &g_array_index(load->elements, LayoutElement, box->step);
+            if (box->child_depth < 0)
+                b->end = p - load->text;          // a box without children is built whole
+            n_boxes--;
+        }
+        else
+            continue;
+        if (load->elements->len % OPEN_LAYOUT_CHECK_EVERY == 0) {
+            if (g_cancellable_set_error_if_cancelled(cancellable, error))
+                return FALSE;
+            progress_task_report(task, (gdouble)(p - load->text) / load->length, NULL);
+        }
+    }
+    // Unterminated element at the end of the file: build what was read
+    for (guint i = 0; i < load->elements->len; i++) {
+        LayoutElement *e = &g_array_index(load->elements, LayoutElement, i);
+        if (e->end <= e->start)
+            e->end = p ? (gsize)(p - load->text) : load->length;
+    }
+    // One stream for the whole build, in document order: an unterminated element is
+    // then the last one, and reads up to the end of the stream as it did in the file
+    GString *steps = g_string_sized_new(load->length);
+    for (guint i = 0; i < load->elements->len; i++) {
+        LayoutElement *e = &g_array_index(load->elements, LayoutElement, i);
+        e->at = steps->len;
+        g_string_append_len(steps, load->text + e->start, e->end - e->start);
+        if (i + 1 < load->elements->len)
+            g_string_append(steps, OPEN_LAYOUT_STEP_END);
+    }
+    g_free(load->text);
+    load->length = steps->len;
+    load->text = g_string_free(steps, FALSE);
+    if (load->elements->len > 0 && !(load->stream = ouvrir_texte_xml(load->text, load->length))) {
+        gint saved = errno;
+        g_set_error(error, G_IO_ERROR, g_io_error_from_errno(saved),
+                    "Could not read the steps of %s: %s", load->path, g_strerror(saved));
+        return FALSE;
+    }
+    // Every step sorts with the position of its top-level element
+    for (guint i = 0; i < load->elements->len; i++) {
+        LayoutElement *e = &g_array_index(load->elements, LayoutElement, i);
+        const LayoutElement *top = &g_array_index(load->elements, LayoutElement, e->block);
+        e->x = top->x;
+        e->y = top->y;
+    }
+    g_array_sort(load->elements, open_layout_compare);
+    TRACE_SPAN_FIN(debut, TRACE_XML, "open layout: split");
+    TRACER(TRACE_XML, TRACE_INFO, "%s: %u step(s)", load->path, load->elements->len);
+    return !g_cancellable_set_error_if_cancelled(cancellable, error);
+}
+
+// Catches the widget a step puts in its container. Only the top-level ones are kept
+// for the commit: the children of a box are found again from the box.
+static gboolean open_layout_parent_set(GSignalInvocationHint *hint, guint n_values,
+                                       const GValue *values, gpointer data) {
+    LayoutLoad *load = data;
+    GtkWidget *widget = g_value_get_object(&values[0]);
+    if (load->step_widget || gtk_widget_get_parent(widget) != load->step_parent)
+        return TRUE;
+    load->step_widget = widget;
+    if (load->step_parent == load->target)
+        g_ptr_array_add(load->built, g_object_ref(widget));
+    return TRUE;
+}
+
+// Build one step with the XML readers: in the target (parents[2] is the fixed), or in
+// its box (parents[3], as box_xml does for the elements of its <child>)
+static gboolean open_layout_build_element(LayoutLoad *load, const LayoutElement *e, GError **error) {
+    GtkWidget *parent = e->parent ? g_hash_table_lookup(load->boxes, GSIZE_TO_POINTER(e->parent)) : load->target;
+    if (!parent)
+        return TRUE;              // Its box could not be built
+    if (fseek(load->stream, (long)e->at, SEEK_SET) != 0) {
+        gint saved = errno;
+        g_set_error(error, G_IO_ERROR, g_io_error_from_errno(saved),
+                    "Could not read the steps of %s: %s", load->path, g_strerror(saved));
+        return FALSE;
+    }
+    gint slot = e->parent ? 3 : 2;
+    parents[slot] = parent;
+    hasOverlay = 0;
+    load->step_parent = parent;
+    load->step_widget = NULL;
+    guint signal = g_signal_lookup("parent-set", GTK_TYPE_WIDGET);
+    gulong hook = g_signal_add_emission_hook(signal, 0, open_layout_parent_set, load, NULL);
+    creer_object(load->stream, slot);
+    g_signal_remove_emission_hook(signal, hook);
+    if (e->box && load->step_widget)
+        g_hash_table_insert(load->boxes, GSIZE_TO_POINTER(e->start), load->step_widget);
+    return TRUE;
+}
+
+// Type string used by tree_sync, structure to store on the Arbre node and
+// whether the widget holds other widgets of the layout
+static const gchar *open_layout_widget_type(GtkWidget *widget, gpointer *structure, gboolean *is_container) {
+    gpointer owned = memoire_structure(widget);
+    *structure = NULL;
+    *is_container = FALSE;
+
+    if (GTK_IS_RADIO_BUTTON(widget)) {
+        *structure = owned;
+        return "radio";
+    }
+    if (GTK_IS_CHECK_BUTTON(widget)) {
+        *structure = owned;
+        return "checkbox";
+    }
+    if (GTK_IS_BUTTON(widget)) {
+        *structure = owned;
+        return "Button";
+    }
+    if (GTK_IS_ENTRY(widget)) {
+        *structure = owned;
+        return gtk_entry_get_visibility(GTK_ENTRY(widget)) ? "Basic Entry" : "Password Entry";
+    }
+    if (GTK_IS_TEXT_VIEW(widget)) {
+        *structure = owned;
+        return "TextView";
+    }
+    if (GTK_IS_LABEL(widget))
+        return "Label";
+    if (GTK_IS_BOX(widget)) {
+        *is_container = TRUE;
+        // A styled box owns a StyledBox; the box of a radio list owns nothing
+        *structure = owned;
+        return owned ? "Box" : "radioList";
+    }
+    return G_OBJECT_TYPE_NAME(widget);
+}
+
+// Add a built widget (and the widgets of the layout inside it) to both trees
+static void open_layout_register(LayoutLoad *load, GtkWidget *widget, GtkWidget *parent) {
+    AppData *app_data = load->app_data;
+    gpointer structure;
+    gboolean is_container;
+    const gchar *type = open_layout_widget_type(widget, &structure, &is_container);
+
+    // Unnamed widgets get a unique name: the Arbre finds containers by name
+    if (strcmp(gtk_widget_get_name(widget), G_OBJECT_TYPE_NAME(widget)) == 0) {
+        gchar *name = generate_widget_name(type, widget);
+        gtk_widget_set_name(widget, name);
+        g_free(name);
+    }
+    if (is_container)
+        add_container(app_data, widget);
+    add_widget_to_both_trees(app_data, widget, type, parent, is_container, structure);
+    g_signal_connect(widget, "button-press-event", G_CALLBACK(on_widget_button_press_select), app_data);
+
+    if (!is_container)
+        return;
+    GList *children = gtk_container_get_children(GTK_CONTAINER(widget));
+    for (GList *l = children; l; l = l->next)
+        if (memoire_structure(l->data) || GTK_IS_RADIO_BUTTON(l->data))
+            open_layout_register(load, l->data, widget);
+    g_list_free(children);
+}
+
+// Hand every built widget to the Arbre and the hierarchy in one transaction
+static void open_layout_commit(LayoutLoad *load) {
+    if (!load->app_data)
+        return;
+    TRACE_SPAN_DEBUT(debut);
+    tree_sync_begin_batch(load->app_data);
+    for (guint i = 0; i < load->built->len; i++)
+        open_layout_register(load, g_ptr_array_index(load->built, i), load->target);
+    tree_sync_end_batch(load->app_data);
+    update_container_combo(load->app_data);
+    TRACE_SPAN_FIN(debut, TRACE_ARBRE, "open layout: commit");
+}
+
+// Part of the target on screen: the page of the scrolled window around it, or its allocation
+static void open_layout_visible_area(GtkWidget *target, GdkRectangle *area) {
+    GtkWidget *scroll = gtk_widget_get_ancestor(target, GTK_TYPE_SCROLLED_WINDOW);
+    if (scroll) {
+        GtkAdjustment *h = gtk_scrolled_window_get_hadjustment(GTK_SCROLLED_WINDOW(scroll));
+        GtkAdjustment *v = gtk_scrolled_window_get_vadjustment(GTK_SCROLLED_WINDOW(scroll));
+        area->x = (gint)gtk_adjustment_get_value(h);
+        area->y = (gint)gtk_adjustment_get_value(v);
+        area->width = (gint)gtk_adjustment_get_page_size(h);
+        area->height = (gint)gtk_adjustment_get_page_size(v);
+    }
+    else {
+        area->x = area->y = 0;
+        area->width = gtk_widget_get_allocated_width(target);
+        area->height = gtk_widget_get_allocated_height(target);
+    }
+}
+
+// Move the top-level elements that start in the visible area (with all their steps) to
+// the front, keeping the order of both parts (the worker sorted them top to bottom, a
+// box before its children). Not yet allocated: no change.
+static void open_layout_visible_first(LayoutLoad *load) {
+    GdkRectangle area;
+    open_layout_visible_area(load->target, &area);
+    if (area.width <= 1 || area.height <= 1)
+        return;
+
+    GArray *ordered = g_array_sized_new(FALSE, FALSE, sizeof(LayoutElement), load->elements->len);
+    GArray *rest = g_array_new(FALSE, FALSE, sizeof(LayoutElement));
+    for (guint i = 0; i < load->elements->len; i++) {
+        LayoutElement *e = &g_array_index(load->elements, LayoutElement, i);
+        gboolean visible = e->x >= area.x && e->x < area.x + area.width
+                           && e->y >= area.y && e->y < area.y + area.height;
+        g_array_append_val(visible ? ordered : rest, *e);
+    }
+    TRACER(TRACE_XML, TRACE_DEBUG, "open layout: %u visible step(s) first", ordered->len);
+    g_array_append_vals(ordered, rest->data, rest->len);
+    g_array_unref(rest);
+    g_array_unref(load->elements);
+    load->elements = ordered;
+}
+
+// One step of the build job: one widget (a whole element for radio lists and dialogs)
+static gboolean open_layout_build_step(ProgressSlices *job, gpointer data, GError **error) {
+    LayoutLoad *load = data;
+    if (!load->target) {
+        g_set_error_literal(error, G_IO_ERROR, G_IO_ERROR_CLOSED, "The target was destroyed");
+        return FALSE;
+    }
+    if (load->next < load->elements->len
+        && !open_layout_build_element(load, &g_array_index(load->elements, LayoutElement, load->next++), error))
+        return FALSE;
+
+    gchar *text = g_strdup_printf("Building %u / %u", load->next, load->elements->len);
+    progress_slices_report(job, load->elements->len ? (gdouble)load->next / load->elements->len : 1.0, text);
+    g_free(text);
+    return load->next < load->elements->len;
+}
+
+// End of the build job: register everything, or roll back
+static void open_layout_built(ProgressSlices *job, gboolean success, GError *error, gpointer user_data) {
+    LayoutLoad *load = user_data;
+    if (success)
+        open_layout_commit(load);
+    else if (!g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        g_printerr("Could not open %s: %s\n", load->path, error->message);
+    open_layout_finish(load, success);
+}
+
+// The worker is done: build the elements from the main loop
+static void open_layout_parsed(ProgressTask *task, gboolean success, GError *error, gpointer user_data) {
+    LayoutLoad *load = user_data;
+    if (!success || !load->target) {
+        if (success)
+            g_printerr("Could not open %s: the target was destroyed\n", load->path);
+        else if (!g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+            g_printerr("Could not open %s: %s\n", load->path, error ? error->message : "unknown error");
+        open_layout_finish(load, FALSE);
+        return;
+    }
+    open_layout_visible_first(load);
+    progress_slices_run(OPEN_LAYOUT_CHANNEL, open_layout_build_step, load, NULL,
+                        load->cancellable, open_layout_built, load);
+}
+
+// Cancel the load in progress, if any
+void open_layout_cancel(void) {
+    if (open_layout_current)
+        g_cancellable_cancel(open_layout_current->cancellable);
+}
+
+/**
+ * Load the layout at path into target (a GtkFixed) without blocking the main loop.
+ * With app_data, the widgets are added to its Arbre and hierarchy once all are built.
+ */
+void open_layout_start(const gchar *path, GtkWidget *target, AppData *app_data) {
+    g_return_if_fail(path != NULL && GTK_IS_FIXED(target));
+    open_layout_cancel();
+
+    LayoutLoad *load = g_new0(LayoutLoad, 1);
+    load->path = g_strdup(path);
+    load->elements = g_array_new(FALSE, FALSE, sizeof(LayoutElement));
+    load->built = g_ptr_array_new_with_free_func(g_object_unref);
+    load->boxes = g_hash_table_new(g_direct_hash, g_direct_equal);
+    load->target = target;
+    g_object_add_weak_pointer(G_OBJECT(target), (gpointer *)&load->target);
+    load->app_data = app_data;
+    load->cancellable = g_cancellable_new();
+    load->op_start = perf_op_begin();
+
+    open_layout_current = load;
+    open_layout_show_rows(TRUE);
+    progress_task_run(OPEN_LAYOUT_CHANNEL, NULL, open_layout_parse, load, NULL,
+                      load->cancellable, open_layout_parsed, load);
+}
+
+static void on_open_layout_row_destroy(GtkWidget *row, gpointer data) {
+    open_layout_rows = g_slist_remove(open_layout_rows, row);
+}
+
+static void on_open_layout_cancel_clicked(GtkWidget *button, gpointer data) {
+    open_layout_cancel();
+}
+
+/**
+ * Progress bar and Cancel button of the loads, hidden while no load runs
+ */
+GtkWidget *create_open_layout_bar(void) {
+    GtkWidget *row = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    GtkWidget *pbar = gtk_progress_bar_new();
+    GtkWidget *cancel = gtk_button_new_with_label("Cancel");
+
+    gtk_progress_bar_set_show_text(GTK_PROGRESS_BAR(pbar), TRUE);
+    gtk_box_pack_start(GTK_BOX(row), pbar, TRUE, TRUE, 0);
+    gtk_box_pack_start(GTK_BOX(row), cancel, FALSE, FALSE, 0);
+    progress_channel_bind(pbar, OPEN_LAYOUT_CHANNEL);
+    g_signal_connect(cancel, "clicked", G_CALLBACK(on_open_layout_cancel_clicked), NULL);
+
+    gtk_widget_set_size_request(pbar, 200, -1);
+    gtk_widget_show_all(row);
+    gtk_widget_set_no_show_all(row, TRUE);
+    gtk_widget_set_visible(row, open_layout_current != NULL);
+    open_layout_rows = g_slist_prepend(open_layout_rows, row);
+    g_signal_connect(row, "destroy", G_CALLBACK(on_open_layout_row_destroy), NULL);
+    return row;
+}
+
+/**
+ * Ask for a layout file and open it in the background
+ */
+void on_open_layout_clicked(GtkWidget *button, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    GtkWidget *dialog = gtk_file_chooser_dialog_new("Open Layout",
+                                                    GTK_WINDOW(app_data->window),
+                                                    GTK_FILE_CHOOSER_ACTION_OPEN,
+                                                    "_Cancel", GTK_RESPONSE_CANCEL,
+                                                    "_Open", GTK_RESPONSE_ACCEPT,
+                                                    NULL);
+    if (gtk_dialog_run(GTK_DIALOG(dialog)) == GTK_RESPONSE_ACCEPT) {
+        gchar *filename = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(dialog));
+        open_layout_start(filename, app_data->preview_area, app_data);
+        g_free(filename);
+    }
+    gtk_widget_destroy(dialog);
+}
+
+#endif /* OPEN_LAYOUT_H */
@@ -0,0 +1,214 @@
+#ifndef PERF_PANEL_H
+#define PERF_PANEL_H
+
+#include <gtk/gtk.h>
+#include "global.h"
+#include "containers_list.h"
+
+// Live performance panel for the builder.
+// Shows the latency of the last editor operations, the number of objects the
+// editor is holding (widgets, Arbre nodes, tree rows, CSS providers, pixbufs,
+// queued worker-pool jobs) and the paint time of the preview's frames.
+// Operations are timed with perf_op_begin()/perf_op_end(); the panel only
+// refreshes while it is expanded.
+
+typedef enum {
+    PERF_OP_ADD_WIDGET,
+    PERF_OP_APPLY,
+    PERF_OP_EXPORT,
+    PERF_OP_LOAD,
+    PERF_N_OPS
+} PerfOperation;
+
+#define PERF_HISTORY 32          // Latencies kept per operation
+#define PERF_FRAME_HISTORY 120   // Preview frames kept (about 2 s at 60 fps)
+#define PERF_REFRESH_MS 500      // Refresh period of the panel
+
+// Last durations of an operation or of frames, in microseconds (ring buffer)
+typedef struct {
+    gint64 samples[PERF_FRAME_HISTORY];
+    guint size;                  // Ring size, 0 for PERF_HISTORY
+    guint count;                 // Total number of samples recorded
+} PerfHistory;
+
+static PerfHistory perf_ops[PERF_N_OPS];
+static PerfHistory perf_frames = { .size = PERF_FRAME_HISTORY };
+static const char *perf_op_names[PERF_N_OPS] = {"Add widget", "Apply", "Export", "Load"};
+
+// Start of the frame being painted (0 outside of a paint)
+static gint64 perf_paint_start = 0;
+
+typedef struct {
+    GtkWidget *expander;
+    GtkWidget *label;
+    GtkWidget *preview_area;
+    GtkTreeModel *rows;          // Hierarchy rows (may be NULL)
+    Arbre **tree;                // Root of the Arbre (may be NULL)
+    guint timer;
+} PerfPanel;
+
+static void perf_push(PerfHistory *history, gint64 sample) {
+    guint size = history->size ? history->size : PERF_HISTORY;
+    history->samples[history->count % size] = sample;
+    history->count++;
+}
+
+// Time reference for perf_op_end()
+gint64 perf_op_begin(void) {
+    return g_get_monotonic_time();
+}
+
+// Record one operation that started at 'start'
+void perf_op_end(PerfOperation op, gint64 start) {
+    if ((guint)op >= PERF_N_OPS)
+        return;
+    perf_push(&perf_ops[op], g_get_monotonic_time() - start);
+}
+
+// Last, average and maximum of the samples still in the history (in ms)
+static guint perf_stats(const PerfHistory *history, double *last, double *avg, double *max) {
+    guint size = history->size ? history->size : PERF_HISTORY;
+    guint n = MIN(history->count, size);
+    gint64 sum = 0, highest = 0;
+
+    *last = *avg = *max = 0.0;
+    if (n == 0)
+        return 0;
+    for (guint i = 0; i < n; i++) {
+        sum += history->samples[i];
+        highest = MAX(highest, history->samples[i]);
+    }
+    *last = history->samples[(history->count - 1) % size] / 1000.0;
+    *avg = sum / (double)n / 1000.0;
+    *max = highest / 1000.0;
+    return n;
+}
+
+// Count a widget and all of its descendants (internal children included)
+static void perf_count_widget(GtkWidget *widget, gpointer data) {
+    guint *count = data;
+    (*count)++;
+    if (GTK_IS_CONTAINER(widget))
+        gtk_container_forall(GTK_CONTAINER(widget), perf_count_widget, data);
+}
+
+static gboolean perf_count_row(GtkTreeModel *model, GtkTreePath *path, GtkTreeIter *iter, gpointer data) {
+    (*(guint *)data)++;
+    return FALSE;
+}
+
+static void perf_before_paint(GdkFrameClock *clock, gpointer data) {
+    perf_paint_start = g_get_monotonic_time();
+}
+
+static void perf_after_paint(GdkFrameClock *clock, gpointer data) {
+    if (perf_paint_start)
+        perf_push(&perf_frames, g_get_monotonic_time() - perf_paint_start);
+    perf_paint_start = 0;
+}
+
+// Follow the frame clock of the preview's toplevel once it exists
+static void perf_watch_frames(GtkWidget *preview_area, gpointer expander) {
+    PerfPanel *panel = g_object_get_data(G_OBJECT(expander), "perf_panel");
+    GdkFrameClock *clock = gtk_widget_get_frame_clock(preview_area);
+    if (!clock)
+        return;
+    g_signal_connect_object(clock, "before-paint", G_CALLBACK(perf_before_paint), panel->label, 0);
+    g_signal_connect_object(clock, "after-paint", G_CALLBACK(perf_after_paint), panel->label, 0);
+}
+
+// Rebuild the text of the panel
+static void perf_panel_refresh(PerfPanel *panel) {
+    GString *text = g_string_new("<span font_family='monospace'>");
+    double last, avg, max;
+
+    g_string_append(text, "<b>Operations</b>  last / avg / max ms\n");
+    for (int op = 0; op < PERF_N_OPS; op++) {
+        guint n = perf_stats(&perf_ops[op], &last, &avg, &max);
+        if (n)
+            g_string_append_printf(text, "%-10s %7.2f %7.2f %7.2f  (%u)\n",
+                                   perf_op_names[op], last, avg, max, perf_ops[op].count);
+        else
+            g_string_append_printf(text, "%-10s       -\n", perf_op_names[op]);
+    }
+
+    guint widgets = 0, rows = 0;
+    if (panel->preview_area)
+        gtk_container_forall(GTK_CONTAINER(panel->preview_area), perf_count_widget, &widgets);
+    if (panel->rows)
+        gtk_tree_model_foreach(panel->rows, perf_count_row, &rows);
+
+    g_string_append(text, "\n<b>Counts</b>\n");
+    g_string_append_printf(text, "Widgets        %u\n", widgets);
+    if (panel->tree)
+        g_string_append_printf(text, "Arbre nodes    %d\n", compterNoeuds(*panel->tree));
+    g_string_append_printf(text, "Tree rows      %u\n", rows);
+    g_string_append_printf(text, "CSS providers  %u\n", nombre_styles_partages());
+    g_string_append_printf(text, "Pixbufs        %u (%.1f MB)\n", cache_pixbuf_nombre(),
+                           cache_pixbuf_memoire() / (1024.0 * 1024.0));
+    g_string_append_printf(text, "Queued jobs    %u\n", travail_nombre_en_attente());
+
+    g_string_append(text, "\n<b>Preview frames</b>\n");
+    if (perf_stats(&perf_frames, &last, &avg, &max)) {
+        GdkFrameClock *clock = panel->preview_area ? gtk_widget_get_frame_clock(panel->preview_area) : NULL;
+        g_string_append_printf(text, "Paint ms   %7.2f %7.2f %7.2f\n", last, avg, max);
+        g_string_append_printf(text, "Frames     %u", perf_frames.count);
+        if (clock)
+            g_string_append_printf(text, "  (%.1f fps)", gdk_frame_clock_get_fps(clock));
+    }
+    else
+        g_string_append(text, "No frame painted yet");
+    g_string_append(text, "</span>");
+
+    gtk_label_set_markup(GTK_LABEL(panel->label), text->str);
+    g_string_free(text, TRUE);
+}
+
+static gboolean perf_panel_tick(gpointer data) {
+    PerfPanel *panel = data;
+    if (gtk_expander_get_expanded(GTK_EXPANDER(panel->expander)))
+        perf_panel_refresh(panel);
+    return G_SOURCE_CONTINUE;
+}
+
+// Refresh at once when the panel is opened
+static void perf_panel_expanded(GObject *expander, GParamSpec *pspec, gpointer data) {
+    if (gtk_expander_get_expanded(GTK_EXPANDER(expander)))
+        perf_panel_refresh(data);
+}
+
+static void perf_panel_free(gpointer data) {
+    PerfPanel *panel = data;
+    g_source_remove(panel->timer);
+    g_free(panel);
+}
+
+// Create the panel, collapsed. 'rows' and 'tree' may be NULL when the UI has no such structure.
+GtkWidget *create_perf_panel(GtkWidget *preview_area, GtkTreeModel *rows, Arbre **tree) {
+    PerfPanel *panel = g_new0(PerfPanel, 1);
+    panel->expander = gtk_expander_new("Performance");
+    panel->label = gtk_label_new(NULL);
+    panel->preview_area = preview_area;
+    panel->rows = rows;
+    panel->tree = tree;
+
+    gtk_label_set_xalign(GTK_LABEL(panel->label), 0.0);
+    gtk_label_set_selectable(GTK_LABEL(panel->label), TRUE);
+    gtk_container_add(GTK_CONTAINER(panel->expander), panel->label);
+
+    panel->timer = g_timeout_add(PERF_REFRESH_MS, perf_panel_tick, panel);
+    g_signal_connect(panel->expander, "notify::expanded", G_CALLBACK(perf_panel_expanded), panel);
+    g_object_set_data_full(G_OBJECT(panel->expander), "perf_panel", panel, perf_panel_free);
+
+    // Frames are painted for the whole toplevel: watch its clock once the preview is realized
+    if (preview_area) {
+        if (gtk_widget_get_realized(preview_area))
+            perf_watch_frames(preview_area, panel->expander);
+        else
+            g_signal_connect_object(preview_area, "realize", G_CALLBACK(perf_watch_frames),
+                                    panel->expander, 0);
+    }
+    return panel->expander;
+}
+
+#endif /* PERF_PANEL_H */
@@ -0,0 +1,463 @@
+//
+// Created by ACER on 05/01/2025.
+//
+
+#ifndef TEST1_PIXBUF_CACHE_H
+#define TEST1_PIXBUF_CACHE_H
+#include "global.h"
+#include <glib/gstdio.h>
+
+//Cache des images décodées, partagé par les images, les icones et les backgrounds.
+//Une entrée est identifiée par (chemin, date de modification, taille cible): un meme
+//fichier n'est décodé qu'une fois et chaque taille n'est calculée qu'une fois.
+//Les images sont décodées directement à la taille cible (pas de décodage pleine taille).
+//Une entrée vit tant qu'un widget utilise son pixbuf (référence faible). En plus, les
+//images récemment utilisées sont gardées dans une liste LRU dans la limite d'un budget
+//mémoire: au-delà, les moins récentes sont relachées.
+//cache_pixbuf_charger_async() décode dans le pool de travail partagé (pool_travail.h) et
+//affiche un espace réservé en attendant.
+
+//Budget par défaut des images gardées par le cache (en octets)
+#define CACHE_PIXBUF_BUDGET_DEFAUT (32 * 1024 * 1024)
+
+typedef struct {
+    gchar* cle;          //"chemin|mtime|largeur|hauteur"
+    gchar* demande;      //Clé de la demande asynchrone qui a chargé l'entrée (voir demande_pixbuf)
+    GdkPixbuf* pixbuf;   //Le pixbuf décodé
+    GList* lru;          //Noeud dans la liste LRU (NULL si le cache ne le retient pas)
+    gsize octets;        //Taille des pixels du pixbuf
+} EntreePixbuf;
+
+//Table des entrées (clé -> EntreePixbuf*)
+static GHashTable* cache_pixbufs = NULL;
+//Entrées retenues par le cache, de la plus récente (tete) à la plus ancienne (queue)
+static GQueue cache_pixbuf_lru = G_QUEUE_INIT;
+//Mémoire occupée par les entrées retenues et budget maximal
+static gsize cache_pixbuf_octets = 0;
+static gsize cache_pixbuf_budget = CACHE_PIXBUF_BUDGET_DEFAUT;
+//Dernière entrée chargée pour chaque demande (demande -> EntreePixbuf*)
+static GHashTable* cache_pixbuf_demandes = NULL;
+
+
+//Construit la clé d'une entrée, NULL si le fichier n'existe pas
+static gchar* cle_pixbuf(const gchar* path, gint width, gint height) {
+    GStatBuf infos;
+    if (!path || g_stat(path, &infos) != 0)
+        return NULL;
+    return g_strdup_printf("%s|%ld|%d|%d", path, (long)infos.st_mtime,
+                           width > 0 ? width : -1, height > 0 ? height : -1);
+}
+
+//Construit la clé d'une demande asynchrone: "chemin|mtime|largeur|hauteur" comme cle_pixbuf,
+//avec une date -1 pour un fichier absent (l'erreur est alors rendue par le décodage).
+//La date en fait partie pour qu'un fichier modifié sur le disque soit décodé à nouveau au lieu
+//d'etre servi par une ancienne entrée ou rattaché à un ancien chargement.
+static gchar* demande_pixbuf(const gchar* path, gint width, gint height) {
+    GStatBuf infos;
+    long mtime = (path && g_stat(path, &infos) == 0) ? (long)infos.st_mtime : -1;
+    return g_strdup_printf("%s|%ld|%d|%d", path ? path : "", mtime,
+                           width > 0 ? width : -1, height > 0 ? height : -1);
+}
+
+//Appelée quand le pixbuf d'une entrée est détruit: retirer l'entrée du cache
+static void entree_pixbuf_detruite(gpointer data, GObject* ancien) {
+    EntreePixbuf* e = (EntreePixbuf*)data;
+    if (cache_pixbufs && g_hash_table_lookup(cache_pixbufs, e->cle) == e)
+        g_hash_table_remove(cache_pixbufs, e->cle);
+    if (cache_pixbuf_demandes && g_hash_table_lookup(cache_pixbuf_demandes, e->demande) == e)
+        g_hash_table_remove(cache_pixbuf_demandes, e->demande);
+    g_free(e->cle);
+    g_free(e->demande);
+    g_free(e);
+}
+
+//Relache la référence que le cache garde sur une entrée (l'entrée peut alors disparaitre)
+static void cache_pixbuf_relacher(EntreePixbuf* e) {
+    if (!e->lru) return;
+    g_queue_delete_link(&cache_pixbuf_lru, e->lru);
+    e->lru = NULL;
+    cache_pixbuf_octets -= e->octets;
+    g_object_unref(e->pixbuf);
+}
+
+//Relache les entrées les moins récentes jusqu'à respecter le budget
+static void cache_pixbuf_evincer() {
+    while (cache_pixbuf_octets > cache_pixbuf_budget && cache_pixbuf_lru.tail) {
+        EntreePixbuf* e = (EntreePixbuf*)cache_pixbuf_lru.tail->data;
+        cache_pixbuf_relacher(e);
+    }
+}
+
+//Marque une entrée comme la plus récente (le cache la retient)
+static void cache_pixbuf_toucher(EntreePixbuf* e) {
+    if (e->lru) {
+        g_queue_unlink(&cache_pixbuf_lru, e->lru);
+        g_queue_push_head_link(&cache_pixbuf_lru, e->lru);
+        return;
+    }
+    //Une image plus grande que le budget n'est pas retenue
+    if (e->octets > cache_pixbuf_budget) return;
+    g_object_ref(e->pixbuf);
+    g_queue_push_head(&cache_pixbuf_lru, e);
+    e->lru = cache_pixbuf_lru.head;
+    cache_pixbuf_octets += e->octets;
+    cache_pixbuf_evincer();
+}
+
+//Enregistre un pixbuf sous une clé (la clé et la demande sont possédées par l'entrée)
+static EntreePixbuf* cache_pixbuf_ajouter(gchar* cle, gchar* demande, GdkPixbuf* pixbuf) {
+    if (!cache_pixbufs)
+        cache_pixbufs = g_hash_table_new(g_str_hash, g_str_equal);
+    if (!cache_pixbuf_demandes)
+        cache_pixbuf_demandes = g_hash_table_new(g_str_hash, g_str_equal);
+
+    EntreePixbuf* e = g_new0(EntreePixbuf, 1);
+    e->cle = cle;
+    e->demande = demande;
+    e->pixbuf = pixbuf;
+    e->octets = gdk_pixbuf_get_byte_length(pixbuf);
+    g_object_weak_ref(G_OBJECT(pixbuf), entree_pixbuf_detruite, e);
+    g_hash_table_replace(cache_pixbufs, e->cle, e);
+    g_hash_table_replace(cache_pixbuf_demandes, e->demande, e);
+    return e;
+}
+
+
+/**********************************************************************************************************
+ Nom            : cache_pixbuf_obtenir()
+ Entrée         : path - Chemin du fichier image
+                  width, height - Taille cible (<= 0 pour garder la taille d'origine)
+ Sortie         : Une nouvelle référence sur le pixbuf (à libérer avec g_object_unref), NULL en cas d'erreur
+ Description    : Retourne le pixbuf du cache s'il existe déjà pour ce fichier (meme date de
+                  modification) et cette taille. Sinon l'image est redimensionnée à partir de
+                  l'original s'il est déjà en cache, ou décodée directement à la taille cible.
+**********************************************************************************************************/
+GdkPixbuf* cache_pixbuf_obtenir(const gchar* path, gint width, gint height) {
+    if (!cache_pixbufs)
+        cache_pixbufs = g_hash_table_new(g_str_hash, g_str_equal);
+
+    gchar* cle = cle_pixbuf(path, width, height);
+    if (!cle) {
+        g_printerr("Erreur lors du chargement de l'image : %s\n", path ? path : "(null)");
+        return NULL;
+    }
+
+    EntreePixbuf* e = g_hash_table_lookup(cache_pixbufs, cle);
+    if (e) {
+        g_free(cle);
+        cache_pixbuf_toucher(e);
+        return g_object_ref(e->pixbuf);
+    }
+
+    GdkPixbuf* pixbuf = NULL;
+    GError* error = NULL;
+    if (width > 0 && height > 0) {
+        //Si l'original est déjà décodé, le redimensionner suffit
+        gchar* cle_originale = cle_pixbuf(path, -1, -1);
+        EntreePixbuf* original = g_hash_table_lookup(cache_pixbufs, cle_originale);
+        g_free(cle_originale);
+        if (original)
+            pixbuf = gdk_pixbuf_scale_simple(original->pixbuf, width, height, GDK_INTERP_BILINEAR);
+        //Sinon décoder directement à la taille cible
+        else
+            pixbuf = gdk_pixbuf_new_from_file_at_scale(path, width, height, FALSE, &error);
+    }
+    else
+        pixbuf = gdk_pixbuf_new_from_file(path, &error);
+
+    if (error != NULL) {
+        g_printerr("Erreur lors du chargement de l'image : %s\n", error->message);
+        g_error_free(error);
+    }
+    if (!pixbuf) {
+        g_free(cle);
+        return NULL;
+    }
+    e = cache_pixbuf_ajouter(cle, demande_pixbuf(path, width, height), pixbuf);
+    cache_pixbuf_toucher(e);
+    return pixbuf;
+}
+
+//Modifie le budget mémoire des images retenues par le cache (en octets)
+void cache_pixbuf_definir_budget(gsize octets) {
+    cache_pixbuf_budget = octets;
+    cache_pixbuf_evincer();
+}
+
+//Retourne la mémoire occupée par les images retenues par le cache (en octets)
+gsize cache_pixbuf_memoire() {
+    return cache_pixbuf_octets;
+}
+
+//Retourne le nombre d'images décodées encore vivantes (retenues par le cache ou affichées)
+guint cache_pixbuf_nombre() {
+    return cache_pixbufs ? g_hash_table_size(cache_pixbufs) : 0;
+}
+
+//Relache toutes les images retenues (celles encore affichées restent valides)
+void cache_pixbuf_vider() {
+    while (cache_pixbuf_lru.head)
+        cache_pixbuf_relacher((EntreePixbuf*)cache_pixbuf_lru.head->data);
+}
+
+//Crée un GtkImage à partir du cache, NULL si l'image ne peut pas etre chargée
+GtkWidget* cache_pixbuf_creer_image(const gchar* path, gint width, gint height) {
+    GdkPixbuf* pixbuf = cache_pixbuf_obtenir(path, width, height);
+    if (!pixbuf)
+        return NULL;
+    GtkWidget* image = gtk_image_new_from_pixbuf(pixbuf);
+    g_object_unref(pixbuf);
+    return image;
+}
+
+
+
+/******************************Chargement asynchrone************************************/
+
+//Un chargement en cours: un seul décodage par demande, partagé par toutes les images en attente
+typedef struct {
+    gchar* demande;
+    gchar* path;
+    gint width;
+    gint height;
+    GSList* attentes;    //AttentePixbuf* des objets qui attendent ce pixbuf
+    struct ResultatPixbuf* resultat;   //Rempli par le thread de décodage (NULL si erreur)
+    GError* erreur;
+} ChargementPixbuf;
+
+//Que faire du pixbuf une fois décodé (pixbuf NULL en cas d'erreur)
+typedef void (*AppliquerPixbuf)(GObject* objet, const gchar* demande, GdkPixbuf* pixbuf);
+
+//Un objet (image, fenetre...) qui attend un pixbuf
+typedef struct {
+    GWeakRef objet;
+    AppliquerPixbuf appliquer;
+} AttentePixbuf;
+
+//Résultat du thread de décodage
+typedef struct ResultatPixbuf {
+    gchar* cle;
+    GdkPixbuf* pixbuf;
+} ResultatPixbuf;
+
+//Chargements en cours (demande -> ChargementPixbuf*)
+static GHashTable* chargements_pixbufs = NULL;
+
+#define CACHE_PIXBUF_TAMPON 65536
+
+static void liberer_resultat_pixbuf(gpointer data) {
+    ResultatPixbuf* r = (ResultatPixbuf*)data;
+    g_free(r->cle);
+    if (r->pixbuf) g_object_unref(r->pixbuf);
+    g_free(r);
+}
+
+static void liberer_chargement_pixbuf(ChargementPixbuf* ch) {
+    for (GSList* l = ch->attentes; l; l = l->next) {
+        AttentePixbuf* a = (AttentePixbuf*)l->data;
+        g_weak_ref_clear(&a->objet);
+        g_free(a);
+    }
+    g_slist_free(ch->attentes);
+    g_free(ch->demande);
+    g_free(ch->path);
+    g_free(ch);
+}
+
+//Le loader annonce la taille de l'image: demander directement la taille cible
+static void taille_pixbuf_preparee(GdkPixbufLoader* loader, gint width, gint height, gpointer data) {
+    ChargementPixbuf* ch = (ChargementPixbuf*)data;
+    gdk_pixbuf_loader_set_size(loader, ch->width, ch->height);
+}
+
+//Thread de décodage (pool partagé): lit le fichier par blocs et alimente un GdkPixbufLoader
+static void decoder_pixbuf_thread(gpointer data, GCancellable* annulation) {
+    ChargementPixbuf* ch = (ChargementPixbuf*)data;
+    GError* error = NULL;
+
+    gchar* cle = cle_pixbuf(ch->path, ch->width, ch->height);
+    if (!cle) {
+        g_set_error(&ch->erreur, G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+                    "Fichier introuvable : %s", ch->path);
+        return;
+    }
+
+    GFile* fichier = g_file_new_for_path(ch->path);
+    GFileInputStream* flux = g_file_read(fichier, annulation, &error);
+    g_object_unref(fichier);
+    if (!flux) {
+        g_free(cle);
+        ch->erreur = error;
+        return;
+    }
+
+    GdkPixbufLoader* loader = gdk_pixbuf_loader_new();
+    if (ch->width > 0 && ch->height > 0)
+        g_signal_connect(loader, "size-prepared", G_CALLBACK(taille_pixbuf_preparee), ch);
+
+    guchar* tampon = g_malloc(CACHE_PIXBUF_TAMPON);
+    gssize lus;
+    while ((lus = g_input_stream_read(G_INPUT_STREAM(flux), tampon, CACHE_PIXBUF_TAMPON,
+                                      annulation, &error)) > 0) {
+        if (!gdk_pixbuf_loader_write(loader, tampon, lus, &error))
+            break;
+    }
+    g_free(tampon);
+    g_object_unref(flux);
+    gdk_pixbuf_loader_close(loader, error ? NULL : &error);
+
+    GdkPixbuf* pixbuf = error ? NULL : gdk_pixbuf_loader_get_pixbuf(loader);
+    if (pixbuf) g_object_ref(pixbuf);
+    g_object_unref(loader);
+
+    if (!pixbuf) {
+        g_free(cle);
+        if (error)
+            ch->erreur = error;
+        else
+            g_set_error(&ch->erreur, G_IO_ERROR, G_IO_ERROR_FAILED,
+                        "Image illisible : %s", ch->path);
+        return;
+    }
+
+    ResultatPixbuf* r = g_new0(ResultatPixbuf, 1);
+    r->cle = cle;
+    r->pixbuf = pixbuf;
+    ch->resultat = r;
+}
+
+//Affiche un pixbuf dans une image si elle attend toujours cette demande
+static void pixbuf_vers_image(GObject* objet, const gchar* demande, GdkPixbuf* pixbuf) {
+    GtkImage* image = GTK_IMAGE(objet);
+    const gchar* attendue = g_object_get_data(G_OBJECT(image), "cache_pixbuf_demande");
+    //L'image a été redemandée avec un autre fichier ou une autre taille entre temps
+    if (g_strcmp0(attendue, demande) != 0)
+        return;
+    if (pixbuf)
+        gtk_image_set_from_pixbuf(image, pixbuf);
+    else
+        gtk_image_set_from_icon_name(image, "image-missing", GTK_ICON_SIZE_DIALOG);
+}
+
+//Fin du décodage (thread principal): enregistrer dans le cache puis servir les images en attente
+static void pixbuf_decode(gpointer data) {
+    ChargementPixbuf* ch = (ChargementPixbuf*)data;
+    GError* error = ch->erreur;
+    ResultatPixbuf* r = ch->resultat;
+    ch->erreur = NULL;
+    ch->resultat = NULL;
+
+    GdkPixbuf* pixbuf = NULL;
+    if (r) {
+        if (!cache_pixbufs)
+            cache_pixbufs = g_hash_table_new(g_str_hash, g_str_equal);
+        EntreePixbuf* e = g_hash_table_lookup(cache_pixbufs, r->cle);
+        //Le meme fichier a pu etre chargé de façon synchrone entre temps
+        if (e)
+            pixbuf = g_object_ref(e->pixbuf);
+        else {
+            pixbuf = g_object_ref(r->pixbuf);
+            e = cache_pixbuf_ajouter(g_strdup(r->cle), g_strdup(ch->demande), pixbuf);
+        }
+        cache_pixbuf_toucher(e);
+        liberer_resultat_pixbuf(r);
+    }
+    else {
+        g_printerr("Erreur lors du chargement de l'image : %s\n", error->message);
+        g_error_free(error);
+    }
+
+    //Les objets détruits entre temps sont ignorés
+    ch->attentes = g_slist_reverse(ch->attentes);
+    for (GSList* l = ch->attentes; l; l = l->next) {
+        AttentePixbuf* a = (AttentePixbuf*)l->data;
+        GObject* objet = g_weak_ref_get(&a->objet);
+        if (objet) {
+            a->appliquer(objet, ch->demande, pixbuf);
+            g_object_unref(objet);
+        }
+    }
+
+    g_hash_table_remove(chargements_pixbufs, ch->demande);
+    liberer_chargement_pixbuf(ch);
+    if (pixbuf) g_object_unref(pixbuf);
+}
+
+/**********************************************************************************************************
+ Nom            : cache_pixbuf_obtenir_async()
+ Entrée         : objet - L'objet qui attend le pixbuf (une référence faible est gardée)
+                  path - Chemin du fichier image
+                  width, height - Taille cible (<= 0 pour garder la taille d'origine)
+                  appliquer - Fonction appelée dans le thread GTK avec le pixbuf (NULL si erreur)
+ Sortie         : TRUE si le pixbuf était en cache et a été appliqué tout de suite
+ Description    : Décode le fichier dans un thread sans bloquer le thread GTK. Un seul décodage est
+                  lancé meme si plusieurs objets attendent le meme fichier à la meme taille.
+                  Si l'objet est détruit avant la fin, le pixbuf ne lui est simplement pas appliqué.
+**********************************************************************************************************/
+gboolean cache_pixbuf_obtenir_async(GObject* objet, const gchar* path, gint width, gint height,
+                                    AppliquerPixbuf appliquer) {
+    gchar* demande = demande_pixbuf(path, width, height);
+
+    //Déjà décodé: pas de thread
+    EntreePixbuf* e = cache_pixbuf_demandes ? g_hash_table_lookup(cache_pixbuf_demandes, demande) : NULL;
+    if (e) {
+        cache_pixbuf_toucher(e);
+        appliquer(objet, demande, e->pixbuf);
+        g_free(demande);
+        return TRUE;
+    }
+
+    AttentePixbuf* a = g_new0(AttentePixbuf, 1);
+    g_weak_ref_init(&a->objet, objet);
+    a->appliquer = appliquer;
+
+    if (!chargements_pixbufs)
+        chargements_pixbufs = g_hash_table_new(g_str_hash, g_str_equal);
+    ChargementPixbuf* ch = g_hash_table_lookup(chargements_pixbufs, demande);
+    //Le fichier est déjà en cours de décodage: attendre le meme résultat
+    if (ch) {
+        ch->attentes = g_slist_prepend(ch->attentes, a);
+        g_free(demande);
+        return FALSE;
+    }
+
+    ch = g_new0(ChargementPixbuf, 1);
+    ch->demande = demande;
+    ch->path = g_strdup(path);
+    ch->width = width;
+    ch->height = height;
+    ch->attentes = g_slist_prepend(NULL, a);
+    g_hash_table_insert(chargements_pixbufs, ch->demande, ch);
+
+    //Une image demandée est attendue à l'écran: passe avant les travaux de fond
+    travail_lancer(TRAVAIL_VISIBLE, decoder_pixbuf_thread, pixbuf_decode, ch, NULL);
+    return FALSE;
+}
+
+/**********************************************************************************************************
+ Nom            : cache_pixbuf_charger_async()
+ Entrée         : image - Le GtkImage à remplir
+                  path - Chemin du fichier image
+                  width, height - Taille cible (<= 0 pour garder la taille d'origine)
+ Sortie         : Aucune
+ Description    : Affiche l'image sans bloquer le thread GTK. Si le pixbuf est déjà en cache il est
+                  affiché tout de suite; sinon l'image montre un espace réservé à la bonne taille
+                  jusqu'à la fin du décodage. Seule la dernière demande faite pour une image est affichée.
+**********************************************************************************************************/
+void cache_pixbuf_charger_async(GtkImage* image, const gchar* path, gint width, gint height) {
+    if (!image || !path) return;
+
+    g_object_set_data_full(G_OBJECT(image), "cache_pixbuf_demande",
+                           demande_pixbuf(path, width, height), g_free);
+
+    if (cache_pixbuf_obtenir_async(G_OBJECT(image), path, width, height, pixbuf_vers_image))
+        return;
+
+    //Espace réservé à la taille finale pour que la mise en page ne bouge pas
+    if (width > 0 && height > 0)
+        gtk_widget_set_size_request(GTK_WIDGET(image), width, height);
+    gtk_image_set_from_icon_name(image, "image-loading", GTK_ICON_SIZE_DIALOG);
+}
+
+
+#endif //TEST1_PIXBUF_CACHE_H
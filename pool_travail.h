@@ -0,0 +1,190 @@
+//
+// Created by ACER on 06/01/2025.
+//
+
+#ifndef TEST1_POOL_TRAVAIL_H
+#define TEST1_POOL_TRAVAIL_H
+#include <glib.h>
+#include <gio/gio.h>
+#include "trace.h"
+
+//Pool de threads partagé par tous les travaux qui n'appellent pas GTK (décodage des images,
+//copies de fichiers, lecture des layouts...) et file des travaux terminés.
+// - travail_lancer(priorite, executer, appliquer, donnees, annulation): executer(donnees) tourne
+//   dans un thread du pool (un par coeur), puis appliquer(donnees) est appelée dans le thread GTK.
+// - Les threads déposent les travaux terminés sur une pile sans verrou (compare-and-swap); le
+//   thread GTK la vide d'un coup, une fois par itération de la boucle principale, et applique le
+//   lot: d'abord les travaux TRAVAIL_VISIBLE, puis NORMAL, puis FOND. Un lot ne garde pas la
+//   main plus de TRAVAIL_BUDGET_US: le reste est appliqué à l'itération suivante, après le
+//   dessin (la source passe sous la priorité du dessin de GTK).
+// - Les travaux en attente d'un thread passent aussi par ordre de priorité.
+//Seule appliquer() peut toucher GTK. Elle est toujours appelée (meme si le travail a été annulé
+//avant de commencer: g_cancellable_is_cancelled() le dit) et libère les données.
+
+typedef enum {
+    TRAVAIL_VISIBLE,    //Résultat attendu à l'écran (image affichée, chargement demandé)
+    TRAVAIL_NORMAL,
+    TRAVAIL_FOND,       //Préchargements, sauvegardes
+    TRAVAIL_N_PRIORITES
+} PrioriteTravail;
+
+//Temps maximal passé à appliquer des résultats par itération de la boucle principale
+#define TRAVAIL_BUDGET_US 8000
+
+typedef void (*TravailExecuter)(gpointer donnees, GCancellable* annulation);
+typedef void (*TravailAppliquer)(gpointer donnees);
+
+typedef struct Travail {
+    struct Travail* suivant;     //Chainage dans la pile des travaux terminés
+    PrioriteTravail priorite;
+    guint numero;                //Ordre de lancement (à priorité égale, le plus ancien d'abord)
+    TravailExecuter executer;
+    TravailAppliquer appliquer;
+    gpointer donnees;
+    GCancellable* annulation;    //Peut etre NULL
+} Travail;
+
+static GThreadPool* travail_pool = NULL;
+//Pile des travaux terminés (écrite par les threads du pool, vidée par le thread GTK)
+static Travail* travail_termines = NULL;
+//Travaux terminés pas encore appliqués, par priorité (thread GTK seulement)
+static GQueue travail_a_appliquer[TRAVAIL_N_PRIORITES];
+static gint travail_compteur = 0;
+
+//Les travaux en attente d'un thread sortent par priorité puis par ordre de lancement
+static gint travail_comparer(gconstpointer a, gconstpointer b, gpointer data) {
+    const Travail* ta = a;
+    const Travail* tb = b;
+    if (ta->priorite != tb->priorite)
+        return ta->priorite < tb->priorite ? -1 : 1;
+    return ta->numero < tb->numero ? -1 : (ta->numero > tb->numero);
+}
+
+//Thread du pool: exécuter puis déposer le travail sur la pile des travaux terminés
+static void travail_executer(gpointer data, gpointer pool_data) {
+    Travail* t = data;
+    if (!t->annulation || !g_cancellable_is_cancelled(t->annulation))
+        t->executer(t->donnees, t->annulation);
+
+    Travail* tete;
+    do {
+        tete = g_atomic_pointer_get(&travail_termines);
+        t->suivant = tete;
+    } while (!g_atomic_pointer_compare_and_exchange(&travail_termines, tete, t));
+    //La pile était vide: la boucle principale dort peut-etre
+    if (!tete)
+        g_main_context_wakeup(NULL);
+}
+
+static gboolean travail_en_attente() {
+    if (g_atomic_pointer_get(&travail_termines))
+        return TRUE;
+    for (int p = 0; p < TRAVAIL_N_PRIORITES; p++)
+        if (!g_queue_is_empty(&travail_a_appliquer[p]))
+            return TRUE;
+    return FALSE;
+}
+
+static gboolean travail_source_preparer(GSource* source, gint* delai) {
+    *delai = -1;
+    return travail_en_attente();
+}
+
+static gboolean travail_source_verifier(GSource* source) {
+    return travail_en_attente();
+}
+
+//Vide la pile d'un coup et applique le lot, les travaux visibles d'abord
+static gboolean travail_source_distribuer(GSource* source, GSourceFunc callback, gpointer data) {
+    Travail* pile;
+    do {
+        pile = g_atomic_pointer_get(&travail_termines);
+    } while (pile && !g_atomic_pointer_compare_and_exchange(&travail_termines, pile, NULL));
+    //La pile rend les travaux du plus récent au plus ancien: les remettre dans l'ordre
+    GQueue lot[TRAVAIL_N_PRIORITES] = { G_QUEUE_INIT, G_QUEUE_INIT, G_QUEUE_INIT };
+    for (Travail* t = pile; t; t = t->suivant)
+        g_queue_push_head(&lot[t->priorite], t);
+    for (int p = 0; p < TRAVAIL_N_PRIORITES; p++)
+        while (!g_queue_is_empty(&lot[p]))
+            g_queue_push_tail(&travail_a_appliquer[p], g_queue_pop_head(&lot[p]));
+
+    TRACE_SPAN_DEBUT(debut);
+    gint64 limite = g_get_monotonic_time() + TRAVAIL_BUDGET_US;
+    guint appliques = 0;
+    for (int p = 0; p < TRAVAIL_N_PRIORITES; p++) {
+        Travail* t;
+        while ((t = g_queue_pop_head(&travail_a_appliquer[p]))) {
+            t->appliquer(t->donnees);
+            if (t->annulation)
+                g_object_unref(t->annulation);
+            g_free(t);
+            appliques++;
+            if (g_get_monotonic_time() >= limite)
+                goto fin;
+        }
+    }
+fin:
+    TRACER(TRACE_TRAVAUX, TRACE_DEBUG, "%u travaux appliqués", appliques);
+    TRACE_SPAN_FIN(debut, TRACE_TRAVAUX, "application des travaux");
+    return G_SOURCE_CONTINUE;
+}
+
+static GSourceFuncs travail_source_fonctions = {
+    travail_source_preparer,
+    travail_source_verifier,
+    travail_source_distribuer,
+    NULL
+};
+
+//Crée le pool (un thread par coeur) et la source qui applique les résultats
+static void travail_initialiser() {
+    static gsize initialise = 0;
+    if (!g_once_init_enter(&initialise))
+        return;
+    travail_pool = g_thread_pool_new(travail_executer, NULL, (gint)g_get_num_processors(), FALSE, NULL);
+    g_thread_pool_set_sort_function(travail_pool, travail_comparer, NULL);
+    for (int p = 0; p < TRAVAIL_N_PRIORITES; p++)
+        g_queue_init(&travail_a_appliquer[p]);
+
+    GSource* source = g_source_new(&travail_source_fonctions, sizeof(GSource));
+    //Sous la mise en page et le dessin de GTK (G_PRIORITY_HIGH_IDLE + 10/20): un gros lot, meme
+    //appliqué en plusieurs fois, laisse passer une image entre deux tranches. A la meme priorité
+    //que les travaux découpés de la boucle principale (progress_slices_run), qui ne sont pas
+    //affamés non plus.
+    g_source_set_priority(source, G_PRIORITY_DEFAULT_IDLE);
+    g_source_set_name(source, "pool_travail");
+    g_source_attach(source, NULL);
+    g_source_unref(source);
+    g_once_init_leave(&initialise, 1);
+}
+
+/**********************************************************************************************************
+ Nom            : travail_lancer()
+ Entrée         : priorite - TRAVAIL_VISIBLE, TRAVAIL_NORMAL ou TRAVAIL_FOND
+                  executer - Fonction lancée dans un thread du pool (sans appel GTK)
+                  appliquer - Fonction appelée ensuite dans le thread GTK (libère les données)
+                  donnees - Données passées aux deux fonctions
+                  annulation - Annulation du travail (peut etre NULL, une référence est gardée)
+ Sortie         : Aucune
+ Description    : Confie un travail au pool partagé. Si annulation est déclenchée avant que le travail
+                  ne commence, executer() n'est pas appelée mais appliquer() l'est toujours.
+**********************************************************************************************************/
+void travail_lancer(PrioriteTravail priorite, TravailExecuter executer, TravailAppliquer appliquer,
+                    gpointer donnees, GCancellable* annulation) {
+    travail_initialiser();
+    Travail* t = g_new0(Travail, 1);
+    t->priorite = CLAMP(priorite, TRAVAIL_VISIBLE, TRAVAIL_FOND);
+    t->numero = (guint)g_atomic_int_add(&travail_compteur, 1);
+    t->executer = executer;
+    t->appliquer = appliquer;
+    t->donnees = donnees;
+    t->annulation = annulation ? g_object_ref(annulation) : NULL;
+    g_thread_pool_push(travail_pool, t, NULL);
+}
+
+//Nombre de travaux en attente d'un thread (pour les mesures)
+guint travail_nombre_en_attente() {
+    return travail_pool ? g_thread_pool_unprocessed(travail_pool) : 0;
+}
+
+#endif //TEST1_POOL_TRAVAIL_H
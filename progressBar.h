@@ -46,6 +46,530 @@ static gboolean update_progress_timeout(gpointer user_data) {
 }
 
 
+/*
+ * Frame-clock scheduler shared by every animated progress bar.
+ *
+ * Instead of one GSource per bar, bars register a step function here and a
+ * single tick callback (installed on one mapped bar) advances all of them
+ * once per frame. Unmapped bars are skipped, the tick callback is removed
+ * when no registered bar is mapped, and a bar is unregistered when it is
+ * destroyed.
+ */
+
+// Advances an animation; returns FALSE once the animation is finished
+typedef gboolean (*ProgressStepFunc)(gpointer data);
+
+typedef struct {
+    GtkWidget *pbar;
+    gint64 interval;            // minimum time between two steps (microseconds)
+    gint64 last_step;           // frame time of the last step
+    ProgressStepFunc step;
+    gpointer data;
+    GDestroyNotify data_free;   // called on data when the animation is dropped
+} ProgressAnimation;
+
+static GPtrArray *progress_animations = NULL;
+static GtkWidget *progress_driver = NULL;   // bar whose frame clock drives the scheduler
+static guint progress_tick_id = 0;
+
+static gboolean progress_scheduler_tick(GtkWidget *widget, GdkFrameClock *clock, gpointer user_data);
+static void on_progress_bar_map(GtkWidget *pbar, gpointer user_data);
+static void on_progress_bar_unmap(GtkWidget *pbar, gpointer user_data);
+static void on_progress_bar_destroy(GtkWidget *pbar, gpointer user_data);
+
+// Move the tick callback to a mapped bar, or stop ticking if none is mapped
+static void progress_scheduler_elect_driver(void) {
+    if (progress_driver && progress_tick_id)
+        gtk_widget_remove_tick_callback(progress_driver, progress_tick_id);
+    progress_driver = NULL;
+    progress_tick_id = 0;
+
+    if (!progress_animations) return;
+    for (guint i = 0; i < progress_animations->len; i++) {
+        ProgressAnimation *anim = g_ptr_array_index(progress_animations, i);
+        if (gtk_widget_get_mapped(anim->pbar)) {
+            progress_driver = anim->pbar;
+            progress_tick_id = gtk_widget_add_tick_callback(anim->pbar, progress_scheduler_tick,
+                                                            NULL, NULL);
+            return;
+        }
+    }
+}
+
+static gint progress_scheduler_find(GtkWidget *pbar) {
+    if (!progress_animations) return -1;
+    for (guint i = 0; i < progress_animations->len; i++) {
+        ProgressAnimation *anim = g_ptr_array_index(progress_animations, i);
+        if (anim->pbar == pbar) return (gint)i;
+    }
+    return -1;
+}
+
+// Drop the animation at index; does not touch the tick callback
+static void progress_scheduler_forget(guint index) {
+    ProgressAnimation *anim = g_ptr_array_remove_index(progress_animations, index);
+    g_signal_handlers_disconnect_by_func(anim->pbar, on_progress_bar_map, NULL);
+    g_signal_handlers_disconnect_by_func(anim->pbar, on_progress_bar_unmap, NULL);
+    g_signal_handlers_disconnect_by_func(anim->pbar, on_progress_bar_destroy, NULL);
+    if (anim->data_free) anim->data_free(anim->data);
+    g_free(anim);
+}
+
+static gboolean progress_scheduler_tick(GtkWidget *widget, GdkFrameClock *clock, gpointer user_data) {
+    gint64 now = gdk_frame_clock_get_frame_time(clock);
+    guint i = 0;
+
+    while (i < progress_animations->len) {
+        ProgressAnimation *anim = g_ptr_array_index(progress_animations, i);
+        // Hidden bars are paused
+        if (!gtk_widget_get_mapped(anim->pbar) || now - anim->last_step < anim->interval) {
+            i++;
+            continue;
+        }
+        anim->last_step = now;
+        if (anim->step(anim->data))
+            i++;
+        else
+            progress_scheduler_forget(i);
+    }
+
+    // The driver itself may have finished: hand the tick over to another bar
+    if (progress_scheduler_find(widget) < 0) {
+        progress_driver = NULL;
+        progress_tick_id = 0;
+        progress_scheduler_elect_driver();
+        return G_SOURCE_REMOVE;
+    }
+    return G_SOURCE_CONTINUE;
+}
+
+static void on_progress_bar_map(GtkWidget *pbar, gpointer user_data) {
+    if (!progress_driver)
+        progress_scheduler_elect_driver();
+}
+
+static void on_progress_bar_unmap(GtkWidget *pbar, gpointer user_data) {
+    if (pbar == progress_driver)
+        progress_scheduler_elect_driver();
+}
+
+/**
+ * Stop animating a bar. Its data is released with the data_free given at registration.
+ */
+void progress_scheduler_remove(GtkWidget *pbar) {
+    gint index = progress_scheduler_find(pbar);
+    if (index < 0) return;
+
+    progress_scheduler_forget(index);
+    if (pbar == progress_driver)
+        progress_scheduler_elect_driver();
+}
+
+static void on_progress_bar_destroy(GtkWidget *pbar, gpointer user_data) {
+    progress_scheduler_remove(pbar);
+}
+
+/**
+ * Animate a bar: step(data) is called at most once per frame and at least
+ * interval_ms apart, while the bar is mapped, until it returns FALSE or the
+ * bar is destroyed. Registering a bar again replaces its previous animation.
+ */
+void progress_scheduler_add(GtkWidget *pbar, gint interval_ms, ProgressStepFunc step,
+                            gpointer data, GDestroyNotify data_free) {
+    progress_scheduler_remove(pbar);
+    if (!progress_animations)
+        progress_animations = g_ptr_array_new();
+
+    ProgressAnimation *anim = g_new0(ProgressAnimation, 1);
+    anim->pbar = pbar;
+    anim->interval = (gint64)interval_ms * 1000;
+    anim->step = step;
+    anim->data = data;
+    anim->data_free = data_free;
+    g_ptr_array_add(progress_animations, anim);
+
+    g_signal_connect(pbar, "map", G_CALLBACK(on_progress_bar_map), NULL);
+    g_signal_connect(pbar, "unmap", G_CALLBACK(on_progress_bar_unmap), NULL);
+    g_signal_connect(pbar, "destroy", G_CALLBACK(on_progress_bar_destroy), NULL);
+
+    if (!progress_driver && gtk_widget_get_mapped(pbar))
+        progress_scheduler_elect_driver();
+}
+
+// Step function of pulse bars
+static gboolean progress_pulse_step(gpointer pbar) {
+    gtk_progress_bar_pulse(GTK_PROGRESS_BAR(pbar));
+    return TRUE;
+}
+
+
+/*
+ * Progress of real work (file copy, layout load, export...) running in the
+ * shared worker pool (pool_travail.h).
+ *
+ * The worker calls progress_task_report(), which only stores the latest
+ * value under a lock. Bound bars read that value from the frame-clock
+ * scheduler above, so the main loop gets at most one update per bar and per
+ * frame however often the worker reports. Completion comes back once, with
+ * the pool's batch of finished work.
+ */
+typedef struct ProgressTask ProgressTask;
+
+// Runs in the worker thread. Report with progress_task_report(), stop early when
+// the cancellable is cancelled, and return FALSE with error set on failure.
+typedef gboolean (*ProgressTaskFunc)(ProgressTask *task, gpointer task_data,
+                                     GCancellable *cancellable, GError **error);
+
+// Called in the main loop when the work item is over (error is NULL on success)
+typedef void (*ProgressTaskDone)(ProgressTask *task, gboolean success, GError *error,
+                                 gpointer user_data);
+
+struct ProgressTask {
+    gint ref_count;
+    GMutex lock;                // protects fraction, text and finished
+    gdouble fraction;           // latest fraction reported by the worker
+    gchar *text;                // latest text reported, NULL to leave the bar's text
+    gboolean finished;          // the work item has completed
+    GCancellable *cancellable;
+    gboolean success;           // result of func, set by the worker
+    GError *error;
+    ProgressTaskFunc func;
+    gpointer task_data;
+    GDestroyNotify task_data_free;
+    ProgressTaskDone done;
+    gpointer user_data;
+};
+
+// Bars bound to a named channel (name -> GPtrArray of GtkWidget*), see progress_channel_bind()
+static GHashTable *progress_channels = NULL;
+
+ProgressTask *progress_task_ref(ProgressTask *task) {
+    g_atomic_int_inc(&task->ref_count);
+    return task;
+}
+
+void progress_task_unref(ProgressTask *task) {
+    if (!task || !g_atomic_int_dec_and_test(&task->ref_count)) return;
+
+    if (task->task_data_free) task->task_data_free(task->task_data);
+    g_clear_object(&task->cancellable);
+    g_mutex_clear(&task->lock);
+    g_clear_error(&task->error);
+    g_free(task->text);
+    g_free(task);
+}
+
+/**
+ * Report progress from the worker thread. Cheap: nothing is sent to the main loop.
+ */
+void progress_task_report(ProgressTask *task, gdouble fraction, const gchar *text) {
+    g_mutex_lock(&task->lock);
+    task->fraction = CLAMP(fraction, 0.0, 1.0);
+    if (text) {
+        g_free(task->text);
+        task->text = g_strdup(text);
+    }
+    g_mutex_unlock(&task->lock);
+}
+
+void progress_task_cancel(ProgressTask *task) {
+    if (task && task->cancellable)
+        g_cancellable_cancel(task->cancellable);
+}
+
+// A bar showing a task
+typedef struct {
+    ProgressTask *task;
+    GtkProgressBar *pbar;
+} ProgressBinding;
+
+static void progress_binding_free(gpointer data) {
+    ProgressBinding *binding = (ProgressBinding *)data;
+    progress_task_unref(binding->task);
+    g_free(binding);
+}
+
+// Scheduler step of a bound bar: show the latest values reported by the worker
+static gboolean progress_binding_step(gpointer data) {
+    ProgressBinding *binding = (ProgressBinding *)data;
+    ProgressTask *task = binding->task;
+
+    g_mutex_lock(&task->lock);
+    gdouble fraction = task->fraction;
+    gchar *text = g_strdup(task->text);
+    gboolean finished = task->finished;
+    g_mutex_unlock(&task->lock);
+
+    if (fraction != gtk_progress_bar_get_fraction(binding->pbar))
+        gtk_progress_bar_set_fraction(binding->pbar, fraction);
+    if (text && g_strcmp0(text, gtk_progress_bar_get_text(binding->pbar)) != 0)
+        gtk_progress_bar_set_text(binding->pbar, text);
+    g_free(text);
+
+    // Keep the last values on screen and stop animating
+    return !finished;
+}
+
+/**
+ * Show the progress of task on pbar (replaces any animation of the bar)
+ */
+void progress_task_bind(ProgressTask *task, GtkWidget *pbar) {
+    ProgressBinding *binding = g_new0(ProgressBinding, 1);
+    binding->task = progress_task_ref(task);
+    binding->pbar = GTK_PROGRESS_BAR(pbar);
+    gtk_progress_bar_set_fraction(binding->pbar, 0.0);
+    progress_scheduler_add(pbar, 0, progress_binding_step, binding, progress_binding_free);
+}
+
+static void on_channel_bar_destroy(GtkWidget *pbar, gpointer channel) {
+    GPtrArray *bars = progress_channels ? g_hash_table_lookup(progress_channels, channel) : NULL;
+    if (bars) g_ptr_array_remove(bars, pbar);
+}
+
+/**
+ * Bind a bar to a named channel: every task started on that channel is shown on it.
+ */
+void progress_channel_bind(GtkWidget *pbar, const gchar *channel) {
+    if (!progress_channels)
+        progress_channels = g_hash_table_new_full(g_str_hash, g_str_equal, g_free,
+                                                  (GDestroyNotify)g_ptr_array_unref);
+
+    GPtrArray *bars = g_hash_table_lookup(progress_channels, channel);
+    if (!bars) {
+        bars = g_ptr_array_new();
+        g_hash_table_insert(progress_channels, g_strdup(channel), bars);
+    }
+    g_ptr_array_add(bars, pbar);
+
+    // The key stays alive as long as the channel exists
+    gpointer key = NULL;
+    g_hash_table_lookup_extended(progress_channels, channel, &key, NULL);
+    g_signal_connect(pbar, "destroy", G_CALLBACK(on_channel_bar_destroy), key);
+}
+
+/**
+ * Show fraction (and text, if not NULL) on every bar bound to channel. For work
+ * done in the main loop itself, such as building widgets in idle batches.
+ */
+void progress_channel_report(const gchar *channel, gdouble fraction, const gchar *text) {
+    GPtrArray *bars = (channel && progress_channels) ? g_hash_table_lookup(progress_channels, channel) : NULL;
+    for (guint i = 0; bars && i < bars->len; i++) {
+        GtkProgressBar *pbar = GTK_PROGRESS_BAR(g_ptr_array_index(bars, i));
+        gtk_progress_bar_set_fraction(pbar, CLAMP(fraction, 0.0, 1.0));
+        if (text)
+            gtk_progress_bar_set_text(pbar, text);
+    }
+}
+
+static void progress_task_thread(gpointer data, GCancellable *cancellable) {
+    ProgressTask *task = (ProgressTask *)data;
+    task->success = task->func(task, task->task_data, cancellable, &task->error);
+}
+
+static void progress_task_completed(gpointer data) {
+    ProgressTask *task = (ProgressTask *)data;
+    GError *error = g_steal_pointer(&task->error);
+    gboolean success = task->success;
+
+    // Cancelled before a worker picked it up, or failed without saying why
+    if (!success && !error) {
+        if (g_cancellable_is_cancelled(task->cancellable))
+            g_set_error_literal(&error, G_IO_ERROR, G_IO_ERROR_CANCELLED, "Task cancelled");
+        else
+            g_set_error_literal(&error, G_IO_ERROR, G_IO_ERROR_FAILED, "Task failed");
+    }
+
+    g_mutex_lock(&task->lock);
+    if (success) task->fraction = 1.0;
+    task->finished = TRUE;
+    g_mutex_unlock(&task->lock);
+
+    if (task->done) task->done(task, success, error, task->user_data);
+    g_clear_error(&error);
+    progress_task_unref(task);
+}
+
+/**
+ * Run func(task, task_data) in a worker thread and show its progress on pbar
+ * (may be NULL) and on every bar bound to channel (may be NULL).
+ * task_data is released with task_data_free when the task is freed.
+ * The returned task is valid until done has returned; take a reference to keep it.
+ */
+ProgressTask *progress_task_run(const gchar *channel, GtkWidget *pbar,
+                                ProgressTaskFunc func, gpointer task_data,
+                                GDestroyNotify task_data_free, GCancellable *cancellable,
+                                ProgressTaskDone done, gpointer user_data) {
+    ProgressTask *task = g_new0(ProgressTask, 1);
+    task->ref_count = 1;
+    g_mutex_init(&task->lock);
+    task->cancellable = cancellable ? g_object_ref(cancellable) : g_cancellable_new();
+    task->func = func;
+    task->task_data = task_data;
+    task->task_data_free = task_data_free;
+    task->done = done;
+    task->user_data = user_data;
+
+    if (pbar) progress_task_bind(task, pbar);
+    GPtrArray *bars = (channel && progress_channels) ? g_hash_table_lookup(progress_channels, channel) : NULL;
+    for (guint i = 0; bars && i < bars->len; i++)
+        if (g_ptr_array_index(bars, i) != pbar)
+            progress_task_bind(task, g_ptr_array_index(bars, i));
+
+    // The pool holds the initial reference until progress_task_completed()
+    travail_lancer(TRAVAIL_NORMAL, progress_task_thread, progress_task_completed, task, task->cancellable);
+    return task;
+}
+
+
+// Work item: copy a file, reporting the bytes copied
+typedef struct {
+    GFile *source;
+    GFile *destination;
+} ProgressCopy;
+
+static void progress_copy_free(gpointer data) {
+    ProgressCopy *copy = (ProgressCopy *)data;
+    g_object_unref(copy->source);
+    g_object_unref(copy->destination);
+    g_free(copy);
+}
+
+static void progress_copy_report(goffset current, goffset total, gpointer task) {
+    if (total > 0)
+        progress_task_report((ProgressTask *)task, (gdouble)current / total, NULL);
+}
+
+static gboolean progress_copy_work(ProgressTask *task, gpointer data, GCancellable *cancellable, GError **error) {
+    ProgressCopy *copy = (ProgressCopy *)data;
+    return g_file_copy(copy->source, copy->destination, G_FILE_COPY_OVERWRITE, cancellable,
+                       progress_copy_report, task, error);
+}
+
+/**
+ * Copy source to destination in a worker thread, showing progress on pbar and/or channel
+ */
+ProgressTask *progress_task_copy_file(const gchar *channel, GtkWidget *pbar,
+                                      const gchar *source, const gchar *destination,
+                                      GCancellable *cancellable, ProgressTaskDone done, gpointer user_data) {
+    ProgressCopy *copy = g_new0(ProgressCopy, 1);
+    copy->source = g_file_new_for_path(source);
+    copy->destination = g_file_new_for_path(destination);
+    return progress_task_run(channel, pbar, progress_copy_work, copy, progress_copy_free,
+                             cancellable, done, user_data);
+}
+
+
+/*
+ * Work that has to run in the main loop (building GTK widgets...), split into
+ * small steps and run in time slices.
+ *
+ * Each slice runs steps until PROGRESS_SLICE_BUDGET_US is spent, from an idle
+ * callback below GTK's redraw priority: input and drawing get their turn
+ * between two slices, so the window stays responsive however long the job is.
+ * Widgets created during a slice are shown together at its end (affichage.h),
+ * and the values given to progress_slices_report() reach the channel's bars
+ * once per slice.
+ */
+#define PROGRESS_SLICE_BUDGET_US 4000
+
+typedef struct ProgressSlices ProgressSlices;
+
+// One small unit of work. Returns TRUE while work remains; set error to fail the job.
+typedef gboolean (*ProgressSliceFunc)(ProgressSlices *job, gpointer job_data, GError **error);
+
+// Called when the job is over (error is NULL on success), then the job is freed
+typedef void (*ProgressSlicesDone)(ProgressSlices *job, gboolean success, GError *error,
+                                   gpointer user_data);
+
+struct ProgressSlices {
+    gchar *channel;
+    GCancellable *cancellable;
+    ProgressSliceFunc step;
+    gpointer job_data;
+    GDestroyNotify job_data_free;
+    ProgressSlicesDone done;
+    gpointer user_data;
+    gdouble fraction;           // latest values reported by the steps
+    gchar *text;
+    gboolean reported;          // something to send to the bars at the end of the slice
+};
+
+/**
+ * Report progress from a step. Only stored: the bars are updated once per slice.
+ */
+void progress_slices_report(ProgressSlices *job, gdouble fraction, const gchar *text) {
+    job->fraction = CLAMP(fraction, 0.0, 1.0);
+    if (text) {
+        g_free(job->text);
+        job->text = g_strdup(text);
+    }
+    job->reported = TRUE;
+}
+
+static void progress_slices_finish(ProgressSlices *job, gboolean success, GError *error) {
+    if (job->done) job->done(job, success, error, job->user_data);
+    g_clear_error(&error);
+    if (job->job_data_free) job->job_data_free(job->job_data);
+    g_object_unref(job->cancellable);
+    g_free(job->channel);
+    g_free(job->text);
+    g_free(job);
+}
+
+static gboolean progress_slices_run_slice(gpointer data) {
+    ProgressSlices *job = (ProgressSlices *)data;
+    GError *error = NULL;
+    gboolean more = TRUE;
+    guint steps = 0;
+
+    TRACE_SPAN_DEBUT(debut);
+    gint64 limit = g_get_monotonic_time() + PROGRESS_SLICE_BUDGET_US;
+    debut_lot_affichage();
+    // At least one step per slice, so that a slow step still makes progress
+    do {
+        if (g_cancellable_set_error_if_cancelled(job->cancellable, &error))
+            break;
+        more = job->step(job, job->job_data, &error);
+        steps++;
+    } while (more && !error && g_get_monotonic_time() < limit);
+    fin_lot_affichage();
+    TRACE_SPAN_FIN(debut, TRACE_AFFICHAGE, "progress slice");
+    TRACER(TRACE_AFFICHAGE, TRACE_DEBUG, "%u steps in the slice", steps);
+
+    if (job->reported) {
+        progress_channel_report(job->channel, job->fraction, job->text);
+        job->reported = FALSE;
+    }
+    if (more && !error)
+        return G_SOURCE_CONTINUE;
+    progress_slices_finish(job, error == NULL, error);
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * Run step(job, job_data) repeatedly in time slices of the main loop until it
+ * returns FALSE, fails or cancellable is cancelled, then call done.
+ * Progress goes to every bar bound to channel (may be NULL).
+ * job_data is released with job_data_free once done has returned.
+ */
+ProgressSlices *progress_slices_run(const gchar *channel, ProgressSliceFunc step,
+                                    gpointer job_data, GDestroyNotify job_data_free,
+                                    GCancellable *cancellable,
+                                    ProgressSlicesDone done, gpointer user_data) {
+    ProgressSlices *job = g_new0(ProgressSlices, 1);
+    job->channel = g_strdup(channel);
+    job->cancellable = cancellable ? g_object_ref(cancellable) : g_cancellable_new();
+    job->step = step;
+    job->job_data = job_data;
+    job->job_data_free = job_data_free;
+    job->done = done;
+    job->user_data = user_data;
+    // Below GTK's layout and redraw (G_PRIORITY_HIGH_IDLE + 10/20): a frame is never held up
+    g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, progress_slices_run_slice, job, NULL);
+    return job;
+}
+
+
 
 typedef struct
 {   // add color to progress 
@@ -53,7 +577,7 @@ typedef struct
     GtkWidget *pbar;
     // gint h;
     // gint w;
-    dimension *dim;
+    dimension dim;
     gboolean is_active;
     gchar color;
     gint pulsing_speed;
@@ -67,11 +591,12 @@ typedef struct
     GtkWidget *pbar;
     // gint h;
     // gint w;
-    dimension *dim;
+    dimension dim;
     gboolean is_active;
     gchar color;
     gint timeout ; //added custum time , u dont want to mess with it just give it 10 , and use the progress struct to control ur progress
     gdouble fraction;
+    gchar *channel; // if set, the bar shows the tasks run on this channel (see progress_task_run)
     
 
 } progress_bar_type_fraction;
@@ -79,12 +604,12 @@ typedef struct
 
 // Function to initialize a `progress_bar_type_pulse` structure
 progress_bar_type_pulse *Init_ProgressBar_Type_Pulse(GtkWidget *container, dimension *dim, gboolean active, gchar color, gint pulsing_speed) {
-    progress_bar_type_pulse *pbar_pulse = (progress_bar_type_pulse *)g_malloc(sizeof(progress_bar_type_pulse));
+    progress_bar_type_pulse *pbar_pulse = (progress_bar_type_pulse *)memoire_allouer(MEMOIRE_WIDGETS, sizeof(progress_bar_type_pulse));
 
     // Initialize the structure fields
     pbar_pulse->parent_container = container;
     pbar_pulse->pbar = gtk_progress_bar_new();
-    pbar_pulse->dim = dim;
+    pbar_pulse->dim = *dim;
     pbar_pulse->is_active = active;
     pbar_pulse->color = color;
     pbar_pulse->pulsing_speed = pulsing_speed;
@@ -96,15 +621,16 @@ progress_bar_type_pulse *Init_ProgressBar_Type_Pulse(GtkWidget *container, dimen
 
 // Function to initialize a `progress_bar_type_fraction` structure
 progress_bar_type_fraction *Init_ProgressBar_Type_Fraction(GtkWidget *container, dimension *dim, gboolean active, gchar color, gdouble fraction) {
-    progress_bar_type_fraction *pbar_fraction = (progress_bar_type_fraction *)g_malloc(sizeof(progress_bar_type_fraction));
+    progress_bar_type_fraction *pbar_fraction = (progress_bar_type_fraction *)memoire_allouer(MEMOIRE_WIDGETS, sizeof(progress_bar_type_fraction));
 
     // Initialize the structure fields
     pbar_fraction->parent_container = container;
     pbar_fraction->pbar = gtk_progress_bar_new();
-    pbar_fraction->dim = dim;
+    pbar_fraction->dim = *dim;
     pbar_fraction->is_active = active;
     pbar_fraction->color = color;
     pbar_fraction->fraction = fraction;
+    pbar_fraction->channel = NULL;
 
 
     return pbar_fraction;
@@ -114,7 +640,7 @@ progress_bar_type_fraction *Init_ProgressBar_Type_Fraction(GtkWidget *container,
 
 GtkWidget *add_progressbar_Tpulse(progress_bar_type_pulse *pbar_pulse){
     // Configure the progress bar
-    gtk_widget_set_size_request(pbar_pulse->pbar, pbar_pulse->dim->width, pbar_pulse->dim->height);
+    gtk_widget_set_size_request(pbar_pulse->pbar, pbar_pulse->dim.width, pbar_pulse->dim.height);
     gtk_container_add(GTK_CONTAINER(pbar_pulse->parent_container), pbar_pulse->pbar);
     gtk_widget_set_halign(pbar_pulse->pbar, GTK_ALIGN_CENTER);
     gtk_widget_set_valign(pbar_pulse->pbar, GTK_ALIGN_CENTER);
@@ -122,8 +648,9 @@ GtkWidget *add_progressbar_Tpulse(progress_bar_type_pulse *pbar_pulse){
     if (pbar_pulse->is_active) {
         gtk_progress_bar_pulse(GTK_PROGRESS_BAR(pbar_pulse->pbar));
         
-        // gtk_progress_bar_pulse(GTK_PROGRESS_BAR(pbar)
-        g_timeout_add(pbar_pulse->pulsing_speed, (GSourceFunc)gtk_progress_bar_pulse, pbar_pulse->pbar);
+        // Pulsed by the shared frame-clock scheduler, only while visible
+        progress_scheduler_add(pbar_pulse->pbar, pbar_pulse->pulsing_speed,
+                               progress_pulse_step, pbar_pulse->pbar, NULL);
     }
     // guint
     return pbar_pulse->pbar;
@@ -132,22 +659,37 @@ GtkWidget *add_progressbar_Tpulse(progress_bar_type_pulse *pbar_pulse){
 }
 
 
+// Frees a fraction bar and its channel name (progress_channel_bind keeps its own copy)
+static void liberer_progressbar_fraction(gpointer p) {
+    progress_bar_type_fraction *pbar_fraction = (progress_bar_type_fraction *)p;
+    g_free(pbar_fraction->channel);
+    memoire_liberer(pbar_fraction);
+}
+
+// The DownloadProgress passed as data is owned by the bar (freed with g_free when it does not use it)
 GtkWidget *add_progressbar_Tfraction(progress_bar_type_fraction* pbar_fraction,gpointer data){
     DownloadProgress *progress = (DownloadProgress *)data;
 
     // Configure the progress bar
-    gtk_widget_set_size_request(pbar_fraction->pbar, pbar_fraction->dim->width,pbar_fraction->dim->height);
+    gtk_widget_set_size_request(pbar_fraction->pbar, pbar_fraction->dim.width,pbar_fraction->dim.height);
     gtk_container_add(GTK_CONTAINER(pbar_fraction->parent_container), pbar_fraction->pbar);
 
 
     gtk_widget_set_halign(pbar_fraction->pbar, GTK_ALIGN_CENTER);
     gtk_widget_set_valign(pbar_fraction->pbar, GTK_ALIGN_CENTER);
-    if (!pbar_fraction->is_active){
+    if (pbar_fraction->channel){
+        // Real progress: driven by the tasks run on the channel
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(pbar_fraction->pbar), pbar_fraction->fraction);
+        progress_channel_bind(pbar_fraction->pbar, pbar_fraction->channel);
+        g_free(progress);
+    }
+    else if (!pbar_fraction->is_active){
 
         gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(pbar_fraction->pbar), pbar_fraction->fraction);
+        g_free(progress);
     }
     else{
-        g_timeout_add(10,(GSourceFunc)update_progress_timeout,progress);
+        progress_scheduler_add(pbar_fraction->pbar, 10, update_progress_timeout, progress, g_free);
     }
 
 
@@ -165,11 +707,12 @@ GtkWidget *add_progressbar_Tfraction(progress_bar_type_fraction* pbar_fraction,g
 
 
 void ProgressBar_xml(FILE *file, int parent) {
-    dimension *dim = (dimension*)malloc(sizeof(dimension));
+    dimension dim = {0, 0};
     char type;
     int test;
     gboolean is_active = TRUE;
     gdouble fraction = 0.0;
+    gchar *channel = NULL;
     
     
     while((test = balise(file)) == 22) {
@@ -191,12 +734,12 @@ void ProgressBar_xml(FILE *file, int parent) {
         if(!(strcmp("\"width\"", mot))) {
             char width[MAX];
             lire_gchar_str(file, width);
-            dim->width = atoi(width);
+            dim.width = atoi(width);
         }
         else if(!(strcmp("\"height\"", mot))) {
             char height[MAX];
             lire_gchar_str(file, height);
-            dim->height = atoi(height);
+            dim.height = atoi(height);
         }
         else if(!(strcmp("\"type\"", mot))) {
             type = lire_gchar(file);
@@ -209,32 +752,40 @@ void ProgressBar_xml(FILE *file, int parent) {
             lire_gchar_str(file, frac);
             fraction = atof(frac);
         }
+        else if(!(strcmp("\"channel\"", mot))) {
+            char canal[MAX];
+            lire_gchar_str(file, canal);
+            channel = g_strdup(canal);
+        }
     }
 
     if(type == 'p') {
         progress_bar_type_pulse *pbar = Init_ProgressBar_Type_Pulse(
             parents[parent],
-            dim,
+            &dim,
             is_active,
             'r',
             100
         );
         add_progressbar_Tpulse(pbar);
+        memoire_attacher(pbar->pbar, pbar, memoire_liberer);
+        g_free(channel); // a pulsing bar has no channel
     } else {
         progress_bar_type_fraction *pbar = Init_ProgressBar_Type_Fraction(
             parents[parent],
-            dim,
+            &dim,
             is_active,
             'r',
             fraction
         );
-        GtkWidget *b1;
+        pbar->channel = channel;
+        // Filled before the add: it may free the progress when it does not keep it
         DownloadProgress *progress = g_new(DownloadProgress, 1);
-        b1=add_progressbar_Tfraction(pbar, progress);
-        progress->is_active = is_active;
-        progress->progress_bar = GTK_PROGRESS_BAR(b1);
+        progress->progress_bar = GTK_PROGRESS_BAR(pbar->pbar);
         progress->total_size = 1024 * 1024;  // 10MB
         progress->current_size = 0;
         progress->is_active = TRUE;
+        add_progressbar_Tfraction(pbar, progress);
+        memoire_attacher(pbar->pbar, pbar, liberer_progressbar_fraction);
     }
 }
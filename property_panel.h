@@ -52,6 +52,7 @@ typedef struct {
     GtkWidget *bold_check;
     GtkWidget *italic_check;    
     GtkWidget *bgcolor_entry;
+    GtkWidget *shared_style_check; // restyle every widget of the shared style instead of this one
 
 
 } PropertyFields;
@@ -79,7 +80,7 @@ static gboolean on_widget_button_press_select(GtkWidget *widget, GdkEventButton
     AppData *app_data = (AppData *)user_data;
     clear_properties_panel(app_data);
     
-    g_print("Widget clicked: %p\n", widget);
+    TRACER(TRACE_EVENEMENTS, TRACE_DEBUG, "Widget clicked: %p", widget);
     
     // Only handle left-click for selection
     if (event->button == 1) {
@@ -87,7 +88,7 @@ static gboolean on_widget_button_press_select(GtkWidget *widget, GdkEventButton
         app_data->selected_widget = widget;
         // current_properties.widget = widget;
         
-        g_print("Selected widget: %p, creating property form...\n", widget);
+        TRACER(TRACE_EVENEMENTS, TRACE_DEBUG, "Selected widget: %p, creating property form...", widget);
         
         // Show the widget's properties
         create_property_form_for_widget(app_data, widget);
@@ -104,7 +105,7 @@ static gboolean on_widget_button_press_select(GtkWidget *widget, GdkEventButton
         
         app_data->selected_widget = widget;
         
-        g_print("Selected widget: %p, creating property form...\n", widget);
+        TRACER(TRACE_EVENEMENTS, TRACE_DEBUG, "Selected widget: %p, creating property form...", widget);
         
         // Show the widget's properties
         create_property_form_for_widget(app_data, widget);
@@ -147,11 +148,46 @@ static gboolean on_widget_button_press_select(GtkWidget *widget, GdkEventButton
     
 //     return FALSE; // Propagate the event
 // }
+// Rubber band selection on the preview area (areas are answered by the spatial index)
+typedef struct {
+    gboolean active;         // A band is being dragged
+    gdouble start_x;         // Where the drag started
+    gdouble start_y;
+    GdkRectangle rect;       // Current band, in preview area coordinates
+    GPtrArray *selection;    // Widgets selected by the last band
+} RubberBand;
+
+static RubberBand rubber_band;
+
+// Rectangle between the drag start and the pointer
+static void update_rubber_band_rect(gdouble x, gdouble y) {
+    rubber_band.rect.x = (gint)MIN(rubber_band.start_x, x);
+    rubber_band.rect.y = (gint)MIN(rubber_band.start_y, y);
+    rubber_band.rect.width = (gint)ABS(x - rubber_band.start_x);
+    rubber_band.rect.height = (gint)ABS(y - rubber_band.start_y);
+}
+
+static void clear_rubber_band_selection(void) {
+    if (rubber_band.selection)
+        g_ptr_array_set_size(rubber_band.selection, 0);
+}
+
 static gboolean on_preview_area_click(GtkWidget *widget, GdkEventButton *event, gpointer user_data) {
     AppData *app_data = (AppData *)user_data;
     
-    // If click is directly on the preview area (not on a child widget)
+    // If click is directly on the preview area (not on a child widget with its own window)
     if (event->window == gtk_widget_get_window(widget)) {
+        // Widgets without a window of their own (labels, images...) are found through the index
+        GtkWidget *hit = index_spatial_au_point(index_spatial_du_fixed(widget), (gint)event->x, (gint)event->y);
+        clear_rubber_band_selection();
+        if (hit && event->button == 1) {
+            clear_properties_panel(app_data);
+            app_data->selected_widget = hit;
+            create_property_form_for_widget(app_data, hit);
+            gtk_widget_queue_draw(widget);
+            return TRUE;
+        }
+        
         // Clear selection
         app_data->selected_widget = NULL;
         
@@ -162,12 +198,87 @@ static gboolean on_preview_area_click(GtkWidget *widget, GdkEventButton *event,
         gtk_widget_set_sensitive(app_data->apply_button, FALSE);
         gtk_widget_set_sensitive(app_data->remove_button, FALSE);
         
-        g_print("Selection cleared\n");
+        TRACER(TRACE_EVENEMENTS, TRACE_INFO, "Selection cleared");
+        
+        // Start a rubber band
+        if (event->button == 1) {
+            rubber_band.active = TRUE;
+            rubber_band.start_x = event->x;
+            rubber_band.start_y = event->y;
+            update_rubber_band_rect(event->x, event->y);
+        }
+        gtk_widget_queue_draw(widget);
     }
     
     return FALSE; // Propagate the event
 }
 
+static gboolean on_preview_area_motion(GtkWidget *widget, GdkEventMotion *event, gpointer user_data) {
+    if (!rubber_band.active || event->window != gtk_widget_get_window(widget))
+        return FALSE;
+    update_rubber_band_rect(event->x, event->y);
+    gtk_widget_queue_draw(widget);
+    return TRUE;
+}
+
+// End of the band: everything it touches is selected; a single widget also gets the property form
+static gboolean on_preview_area_release(GtkWidget *widget, GdkEventButton *event, gpointer user_data) {
+    AppData *app_data = (AppData *)user_data;
+    if (!rubber_band.active || event->button != 1)
+        return FALSE;
+    
+    rubber_band.active = FALSE;
+    if (event->window == gtk_widget_get_window(widget))
+        update_rubber_band_rect(event->x, event->y);
+    
+    if (rubber_band.selection)
+        g_ptr_array_free(rubber_band.selection, TRUE);
+    rubber_band.selection = index_spatial_chercher(index_spatial_du_fixed(widget), &rubber_band.rect);
+    TRACER(TRACE_EVENEMENTS, TRACE_INFO, "Rubber band selected %u widget(s)", rubber_band.selection->len);
+    
+    if (rubber_band.selection->len == 1) {
+        GtkWidget *selected = g_ptr_array_index(rubber_band.selection, 0);
+        app_data->selected_widget = selected;
+        create_property_form_for_widget(app_data, selected);
+    }
+    gtk_widget_queue_draw(widget);
+    return TRUE;
+}
+
+// Draw the band and outline the selection over the children:
+// blue for selected widgets, red when a selected widget overlaps another one
+static gboolean on_preview_area_draw_overlay(GtkWidget *widget, cairo_t *cr, gpointer user_data) {
+    index_spatial *idx = index_spatial_du_fixed(widget);
+    GdkRectangle rect;
+    
+    cairo_set_line_width(cr, 1.0);
+    if (rubber_band.selection) {
+        for (guint i = 0; i < rubber_band.selection->len; i++) {
+            gpointer selected = g_ptr_array_index(rubber_band.selection, i);
+            if (!index_spatial_rectangle(idx, selected, &rect))
+                continue;
+            GPtrArray *overlaps = index_spatial_chevauchements(idx, selected);
+            if (overlaps->len > 0)
+                cairo_set_source_rgb(cr, 0.85, 0.1, 0.1);
+            else
+                cairo_set_source_rgb(cr, 0.2, 0.4, 0.9);
+            g_ptr_array_free(overlaps, TRUE);
+            cairo_rectangle(cr, rect.x + 0.5, rect.y + 0.5, rect.width - 1, rect.height - 1);
+            cairo_stroke(cr);
+        }
+    }
+    
+    if (rubber_band.active) {
+        cairo_rectangle(cr, rubber_band.rect.x + 0.5, rubber_band.rect.y + 0.5,
+                        rubber_band.rect.width, rubber_band.rect.height);
+        cairo_set_source_rgba(cr, 0.2, 0.4, 0.9, 0.15);
+        cairo_fill_preserve(cr);
+        cairo_set_source_rgba(cr, 0.2, 0.4, 0.9, 0.8);
+        cairo_stroke(cr);
+    }
+    return FALSE;
+}
+
 // Create a labeled entry for properties
 static GtkWidget *create_labeled_property(const gchar *label_text, GtkWidget **entry_ptr, const gchar *default_value) {
     GtkWidget *hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
@@ -241,15 +352,12 @@ void add_styled_box_to_preview(GtkWidget *widget, gpointer data) {
     //                  G_CALLBACK(on_container_click), app_data);
     
     // Add to containers list
-    app_data->containers = g_list_append(app_data->containers, box->widget);
+    add_container(app_data, box->widget);
     
     // Add to hierarchy tree
     add_widget_to_both_trees(app_data, box->widget, "Styled Box", 
                             app_data->preview_area, TRUE, box);
     
-    // Make it visible
-    gtk_widget_show_all(box->widget);
-    
     // Select it
     app_data->selected_container = box->widget;
     
@@ -800,16 +908,27 @@ static void create_property_form_for_button_normal(AppData *app_data, GtkWidget
     current_properties.bold_check = bold_check;
     current_properties.bgcolor_entry = bgcolor_entry;
 
+    // Only offered when other widgets wear the same style class
+    GtkWidget *shared_style_check = NULL;
+    guint sharing = nombre_widgets_style_partage(b->style);
+    if (sharing > 1) {
+        gchar *shared_text = g_strdup_printf("Apply style to all %u widgets sharing it", sharing);
+        shared_style_check = gtk_check_button_new_with_label(shared_text);
+        g_free(shared_text);
+        gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(shared_style_check), TRUE);
+    }
+    current_properties.shared_style_check = shared_style_check;
+
  
         // gtk_entry_set_text(GTK_ENTRY(font_entry), style->police ? style->police : "Sans");
-        gtk_entry_set_text(GTK_ENTRY(font_entry), b->police ? b->police : "Sans");
-        g_print("\nPolice: %s", b->police);
-        gtk_entry_set_text(GTK_ENTRY(color_entry), b->color ? b->color : "#000000");
-        char* taille_str;
-        sprintf(taille_str,"%d",b->taille);
-        gtk_entry_set_text(GTK_ENTRY(size_entry), b->taille ? taille_str : "12");        
-        gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(bold_check), b->gras ? TRUE : FALSE);
-        gtk_entry_set_text(GTK_ENTRY(bgcolor_entry), b->bgcolor ? b->bgcolor : "#FFFFFF");
+        SharedStyle *style = style_partage_effectif(b->style);
+        gtk_entry_set_text(GTK_ENTRY(font_entry), (style && style->police) ? style->police : "Sans");
+        gtk_entry_set_text(GTK_ENTRY(color_entry), (style && style->color[0]) ? style->color : "#000000");
+        char taille_str[16];
+        g_snprintf(taille_str, sizeof(taille_str), "%d", style ? style->taille : 12);
+        gtk_entry_set_text(GTK_ENTRY(size_entry), (style && style->taille > 0) ? taille_str : "12");
+        gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(bold_check), (style && style->gras == 1) ? TRUE : FALSE);
+        gtk_entry_set_text(GTK_ENTRY(bgcolor_entry), (style && style->bgcolor) ? style->bgcolor : "#FFFFFF");
     
     // Store references for property retrieval in apply function
     GtkWidget *dummy_entries[8];  // Temp storage for entries that don't have dedicated fields
@@ -876,6 +995,9 @@ static void create_property_form_for_button_normal(AppData *app_data, GtkWidget
     
     gtk_grid_attach(GTK_GRID(grid), bgcolor_label, 0, row, 1, 1);
     gtk_grid_attach(GTK_GRID(grid), bgcolor_entry, 1, row++, 1, 1);
+
+    if (shared_style_check)
+        gtk_grid_attach(GTK_GRID(grid), shared_style_check, 0, row++, 2, 1);
     
     // Add title and grid to vbox
     gtk_box_pack_start(GTK_BOX(vbox), title, FALSE, FALSE, 5);
@@ -1705,7 +1827,7 @@ static void create_password_entry_form(AppData *app_data, GtkWidget *widget) {
 }
 
 void register_widget_for_property_editing(GtkWidget *widget, AppData *app_data) {
-    g_print("Registering widget %p for property editing\n", widget);
+    TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Registering widget %p for property editing", widget);
     g_signal_connect(widget, "button-press-event", G_CALLBACK(on_widget_button_press_select), app_data);
 }
 
@@ -1736,6 +1858,16 @@ static inline void  on_browse_image_clicked(GtkButton *button, gpointer user_dat
     {
         char *filename = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(dialog));
         gtk_entry_set_text(GTK_ENTRY(entry), filename);
+
+        // Preview the new file in the selected image widget without blocking the UI
+        GtkWidget *target = current_properties.widget;
+        GtkWidget *image_widget = target ? g_object_get_data(G_OBJECT(target), "image_widget") : NULL;
+        if (image_widget && GTK_IS_IMAGE(image_widget)) {
+            gint width = 0, height = 0;
+            gtk_widget_get_size_request(target, &width, &height);
+            cache_pixbuf_charger_async(GTK_IMAGE(image_widget), filename, width, height);
+            g_object_set_data_full(G_OBJECT(target), "image_file_path", g_strdup(filename), g_free);
+        }
         g_free(filename);
     }
     
@@ -1909,7 +2041,7 @@ static void create_property_form_for_image(AppData *app_data, GtkWidget *widget)
     gtk_box_pack_start(GTK_BOX(path_box), path_entry, TRUE, TRUE, 0);
     gtk_box_pack_start(GTK_BOX(path_box), browse_button, FALSE, FALSE, 0);
     
-    g_signal_connect(browse_button, "clicked", G_CALLBACK(NULL), path_entry);
+    g_signal_connect(browse_button, "clicked", G_CALLBACK(on_browse_image_clicked), path_entry);
     
     // Keep aspect ratio checkbox
     GtkWidget *aspect_check = gtk_check_button_new_with_label("Keep Aspect Ratio");
@@ -1960,7 +2092,7 @@ static void create_property_form_for_image(AppData *app_data, GtkWidget *widget)
 static void create_property_form_for_widget(AppData *app_data, GtkWidget *widget) {
     // Clear existing content
     clear_properties_panel(app_data);
-    g_print("\nWidget type: %s\n", G_OBJECT_TYPE_NAME(widget));
+    TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Widget type: %s", G_OBJECT_TYPE_NAME(widget));
 
     current_properties.widget = widget;
 
@@ -1970,13 +2102,13 @@ static void create_property_form_for_widget(AppData *app_data, GtkWidget *widget
             // Check if the EventBox has a "label" object set
             GtkWidget *label = g_object_get_data(G_OBJECT(widget), "label");
             if (label && GTK_IS_LABEL(label)) {
-                g_print("\nEventBox with Label detected\n");
+                TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "EventBox with Label detected");
                 create_property_form_for_label_event_box(app_data, widget, label);
                 return;
             }
     
             // Handle other EventBoxes
-            g_print("\nGeneric EventBox detected\n");
+            TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Generic EventBox detected");
             // create_property_form_for_generic_event_box(app_data, widget);
             return;
         }
@@ -1984,14 +2116,14 @@ static void create_property_form_for_widget(AppData *app_data, GtkWidget *widget
     
     // CRITICAL FIX: Make the event box check first and complete
      else if (GTK_IS_EVENT_BOX(widget) && g_object_get_data(G_OBJECT(widget), "image_widget")) {
-        g_print("\nImage Event Box detected\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Image Event Box detected");
         create_property_form_for_image(app_data, widget);
     }
     else if (GTK_IS_SPIN_BUTTON(widget)) {
-        g_print("\nSpin تشاسيرشاستيرشتيسا\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Spin");
         create_property_form_for_spin_button(app_data, widget);
     } else if (GTK_IS_LABEL(widget)){
-        g_print("\nLabel\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Label");
         GtkWidget *label = gtk_label_new("LAbel properties coming soon");
         gtk_container_add(GTK_CONTAINER(app_data->properties_content), label);
         current_properties.container = label;
@@ -2008,26 +2140,26 @@ static void create_property_form_for_widget(AppData *app_data, GtkWidget *widget
     
     }
     else if (GTK_IS_SWITCH(widget)) {
-        g_print("\nSwitch\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Switch");
         create_property_form_for_switch(app_data, widget);
     }
         else if (GTK_IS_TEXT_VIEW(widget)) {
-        g_print("\nTextView\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "TextView");
         create_property_form_for_text_view(app_data, widget);
     }
 
         else if (GTK_IS_COMBO_BOX(widget)) {
-        g_print("\nComboBox form\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "ComboBox form");
         create_property_form_for_combobox(app_data, widget);
     }
 
         else if (GTK_IS_COMBO_BOX(widget)) {
-        g_print("\nComboBox foooooooomr\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "ComboBox form");
         // show_properties_dialog_combobox(widget, app_data);
     }
 
     else if (GTK_IS_EVENT_BOX(widget)){
-        g_print("\nEvent Box\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Event Box");
         // create_property_form_for_image(app_data, widget);
     }
 
@@ -2056,14 +2188,14 @@ static void create_property_form_for_widget(AppData *app_data, GtkWidget *widget
             // Enable Remove button only
             gtk_widget_set_sensitive(app_data->apply_button, TRUE);
             gtk_widget_set_sensitive(app_data->remove_button, TRUE);
-            g_print("\nCheck Button\n");
+            TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Check Button");
         }
         else if (GTK_IS_SWITCH(widget)) {
-            g_print("\nsadasdasdkjabsldjasdbkajdbjasSwitch\n");
+            TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Switch");
             create_property_form_for_switch(app_data, widget);
         }
         else if (GTK_IS_SPIN_BUTTON(widget)) {
-            g_print("\nSpin Button\n");
+            TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Spin Button");
             create_property_form_for_spin_button(app_data, widget);
         }
         else {
@@ -2072,7 +2204,7 @@ static void create_property_form_for_widget(AppData *app_data, GtkWidget *widget
             // gtk_container_add(GTK_CONTAINER(app_data->properties_content), label);
             // current_properties.container = label;
             // gtk_widget_show_all(app_data->properties_content);
-            g_print("iammmm heeeeeeeere\n");
+            TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Button normal form");
 
             //edit a button normale
             create_property_form_for_button_normal(app_data, widget);     
@@ -2123,11 +2255,11 @@ static void create_property_form_for_widget(AppData *app_data, GtkWidget *widget
     }
 }
 
-// Apply changes to the selected widget
-static void on_apply_clicked(GtkButton *button, gpointer user_data) {
+// Apply changes to the selected widget (timed by on_apply_clicked)
+static void apply_selected_properties(GtkButton *button, gpointer user_data) {
     AppData *app_data = (AppData *)user_data;
     //print tghe g pointer 
-    g_print("gponie is , %p\n", user_data);
+    TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Apply (app_data %p)", user_data);
     // g_print()
     GtkWidget *widget = current_properties.widget;
     
@@ -2183,7 +2315,7 @@ static void on_apply_clicked(GtkButton *button, gpointer user_data) {
 
     if (GTK_IS_SPIN_BUTTON(widget)) {
         // Apply spin button specific properties
-        g_print("\nApplying spin button properties\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Applying spin button properties");
         gdouble value = atof(gtk_entry_get_text(GTK_ENTRY(current_properties.value_entry)));
         gdouble min = atof(gtk_entry_get_text(GTK_ENTRY(current_properties.min_entry)));
         gdouble max = atof(gtk_entry_get_text(GTK_ENTRY(current_properties.max_entry)));
@@ -2234,9 +2366,9 @@ static void on_apply_clicked(GtkButton *button, gpointer user_data) {
         
         // Update text content
         if (textview->texte) {
-            g_free(textview->texte);
+            memoire_liberer(textview->texte);
         }
-        textview->texte = g_strdup(new_text);
+        textview->texte = memoire_strdup(MEMOIRE_WIDGETS, new_text);
         g_free(new_text);
         
         // Apply changes to the widget
@@ -2269,7 +2401,7 @@ static void on_apply_clicked(GtkButton *button, gpointer user_data) {
 
         else if (GTK_IS_COMBO_BOX(widget)) {
         // Get ComboBox data structure
-        g_print("\nApplying combo box properties\n");
+        TRACER(TRACE_PROPRIETES, TRACE_DEBUG, "Applying combo box properties");
         gtkComboBox *combo = g_object_get_data(G_OBJECT(widget), "combo_data");
         if (!combo) {
             g_print("Error: No ComboBox data found\n");
@@ -2385,6 +2517,34 @@ static void on_apply_clicked(GtkButton *button, gpointer user_data) {
         gboolean active = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(current_properties.active_check));
         gtk_switch_set_active(GTK_SWITCH(widget), active);
     }
+    else if (GTK_IS_BUTTON(widget) && current_properties.font_entry) {
+        // Normal button: font, colors and background come from its shared style
+        btn *b = (btn *) get_widget_structure(app_data, widget);
+        SharedStyle *current = style_partage_effectif(b ? b->style : NULL);
+        const gchar *font = gtk_entry_get_text(GTK_ENTRY(current_properties.font_entry));
+        const gchar *color = gtk_entry_get_text(GTK_ENTRY(current_properties.color_entry));
+        const gchar *bgcolor = gtk_entry_get_text(GTK_ENTRY(current_properties.bgcolor_entry));
+        gint size = atoi(gtk_entry_get_text(GTK_ENTRY(current_properties.size_entry)));
+        gboolean bold = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(current_properties.bold_check));
+
+        HexColor text_color = hex_color_valeur(color);
+        Style st = style_valeur((gchar *)font, color[0] ? &text_color : NULL, size > 0 ? size : -1,
+                                bold ? 1 : 0, (gchar *)bgcolor,
+                                current ? current->border : -1,
+                                current ? current->border_radius : -1);
+
+        if (!b) {
+            g_print("Error: Button data not found!\n");
+        }
+        // One rule is reloaded for every widget of the class instead of restyling each of them
+        else if (current_properties.shared_style_check &&
+                 gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(current_properties.shared_style_check))) {
+            restyler_style_partage(b->style, &st);
+        }
+        else {
+            regler_css(b, &st);
+        }
+    }
     // Inside the on_apply_clicked function, add this case after the GTK_IS_ENTRY case:
     else if (GTK_IS_CHECK_BUTTON(widget)) {
         // Apply check button specific properties
@@ -2397,10 +2557,26 @@ static void on_apply_clicked(GtkButton *button, gpointer user_data) {
         // strcpy(bb->label, label_text);
         // bb->isChecked = is_active;
     }
+    else if (GTK_IS_EVENT_BOX(widget) && g_object_get_data(G_OBJECT(widget), "image_widget")) {
+        // Reload the image at its new size or from its new path (decoded off the GTK thread)
+        GtkWidget *image_widget = g_object_get_data(G_OBJECT(widget), "image_widget");
+        const gchar *path = gtk_entry_get_text(GTK_ENTRY(current_properties.label_entry));
+        if (path && path[0] != '\0') {
+            g_object_set_data_full(G_OBJECT(widget), "image_file_path", g_strdup(path), g_free);
+            cache_pixbuf_charger_async(GTK_IMAGE(image_widget), path, width, height);
+        }
+    }
     // Handle other widget types here
+    // (the edited widget queues its own resize and redraw, no need to show the whole preview again)
     
-    // Refresh display
-    gtk_widget_show_all(app_data->preview_area);
+    // Keep the Arbre geometry and the spatial index in step with the new position and size
+    update_widget_geometry(app_data, widget);
+}
+
+static void on_apply_clicked(GtkButton *button, gpointer user_data) {
+    gint64 op_start = perf_op_begin();
+    apply_selected_properties(button, user_data);
+    perf_op_end(PERF_OP_APPLY, op_start);
 }
 
 // Remove the selected widget
@@ -2424,18 +2600,14 @@ static void on_remove_clicked(GtkButton *button, gpointer user_data) {
     }
     
     // If this widget is a container, remove it from containers list
-    GList *link = g_list_find(app_data->containers, widget);
-    if (link != NULL) {
-        app_data->containers = g_list_delete_link(app_data->containers, link);
+    if (g_list_find(app_data->containers, widget) != NULL) {
+        remove_container(app_data, widget);
         update_container_combo(app_data);
     }
     
     // Clear the properties panel
     clear_properties_panel(app_data);
     
-    // Update UI
-    gtk_widget_show_all(app_data->preview_area);
-    
     // Clear selected widget
     app_data->selected_widget = NULL;
     
@@ -2491,9 +2663,22 @@ static void init_property_panel(AppData *app_data) {
     gtk_box_pack_start(GTK_BOX(app_data->properties_panel), scroll, TRUE, TRUE, 0);
     gtk_box_pack_end(GTK_BOX(app_data->properties_panel), buttons_box, FALSE, FALSE, 5);
     
+    // The preview area gets its own window so clicks on its background (and on children
+    // without a window) reach it: they drive deselection, hit-testing and the rubber band
+    if (!gtk_widget_get_realized(app_data->preview_area))
+        gtk_widget_set_has_window(app_data->preview_area, TRUE);
+    gtk_widget_add_events(app_data->preview_area,
+                          GDK_BUTTON_PRESS_MASK | GDK_BUTTON_RELEASE_MASK | GDK_BUTTON1_MOTION_MASK);
+    
     // Connect click handler to preview area for deselection
     g_signal_connect(app_data->preview_area, "button-press-event", 
                     G_CALLBACK(on_preview_area_click), app_data);
+    g_signal_connect(app_data->preview_area, "motion-notify-event",
+                    G_CALLBACK(on_preview_area_motion), app_data);
+    g_signal_connect(app_data->preview_area, "button-release-event",
+                    G_CALLBACK(on_preview_area_release), app_data);
+    g_signal_connect_after(app_data->preview_area, "draw",
+                    G_CALLBACK(on_preview_area_draw_overlay), app_data);
 }
 
 // Register preview area background click to clear selection
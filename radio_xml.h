@@ -24,7 +24,7 @@ btn* radio_xml(FILE *file, GtkWidget* groupe, Style** st) {
     int itaille = -1, iborder = -1, igras = -1, iborder_radius = -1;//initialiser par -1
     gint type_bg = -1; // 0:pour simple background ; 1:pour simple background modern;
     int test = balise(file);//
-    printf("\n!Je suis dans un radio!\n");
+    TRACER(TRACE_XML, TRACE_DEBUG, "radio");
 
     //Tant que la balise lise est un <property>
     do{
@@ -104,7 +104,7 @@ btn* radio_xml(FILE *file, GtkWidget* groupe, Style** st) {
                 while (((car = fgetc(file)) != EOF) && (car != '<')) {
                     gras = car; // Lire le mot
                 }
-                printf("%c\n", gras);
+                TRACER(TRACE_XML, TRACE_DEBUG, "gras: %c", gras);
                 fseek(file, 12, SEEK_CUR);
                 // Convertir en entier
                 radioStyle->gras = char_TO_int(gras);
@@ -159,7 +159,7 @@ btn* radio_xml(FILE *file, GtkWidget* groupe, Style** st) {
     gtk_fixed_put(GTK_FIXED(parents[parent]), radiobtn->Button,
                   radiobtn->cord.xw, radiobtn->cord.yh);
     */
-    printf("\n!Voici mes info: text: %s, mnemonic: %s, checked: %s!\n", text, mnemonic, checked);
+    TRACER(TRACE_XML, TRACE_DEBUG, "radio: text: %s, mnemonic: %s, checked: %s", text, mnemonic, checked);
 
     //Creer l'objet btn
     btn* bra = btnRadio(text, text_, text, NULL, margin(0, 0, 0, 0),
@@ -231,6 +231,7 @@ void radioList_xml(FILE *file, int  parent) {
         creer_button(pere);//Creer le pere
         //appliquer le style au bouton radio
         appliquer_style_button(st, pere);
+        liberer_style(st);
         //Ajouter au box
         gtk_box_pack_start(GTK_BOX(hbox), pere->button, TRUE, TRUE, 0);
     }
@@ -241,6 +242,7 @@ void radioList_xml(FILE *file, int  parent) {
         creer_button(fils);
         //appliquer le style au bouton radio
         appliquer_style_button(st, fils);
+        liberer_style(st);
         //Ajouter le bouton au box
         gtk_box_pack_start(GTK_BOX(hbox), fils->button, TRUE, TRUE, 0);
 
@@ -7,7 +7,6 @@
 #include "property_panel.h"
 #include "dialogs.h"
 #include "callbacks.h"
-#include "menu.h"
 #include "menu_dialog.h"
 #include "widget_types.h"  // Add the widget type enum header
 // #include "forms.h"         // Add the forms system header
@@ -0,0 +1,350 @@
+//
+// Created by ACER on 06/01/2025.
+//
+
+#ifndef TEST1_STYLE_H
+#define TEST1_STYLE_H
+#include "global.h"
+#include "colors.h"
+
+
+/******************************Style************************************/
+typedef struct {
+    gchar* police;
+    HexColor* color;
+    gint taille;
+    gint gras;
+    char* bgcolor;
+    int border;
+    int border_radius;
+} Style;
+
+
+//Un style "interné": une seule copie par combinaison de valeurs, partagée par tous
+//les widgets qui ont le meme aspect. Chaque style partagé possède sa propre classe CSS
+//(ex: ".xt-style-3") enregistrée une seule fois sur l'écran.
+typedef struct SharedStyle {
+    gchar* police;          //Famille de police (NULL si non définie)
+    gchar color[100];       //Couleur du texte en hexadécimal ("" si non définie)
+    gint taille;            //Taille de la police (-1 si non définie)
+    gint gras;              //1: gras, 0: normal, -1: non défini
+    gchar* bgcolor;         //Couleur ou image de fond (NULL si non définie)
+    int border;             //Epaisseur du bord (-1 si non défini)
+    int border_radius;      //Rayon du bord (-1 si non défini)
+    gchar classe[32];       //Nom de la classe CSS associée
+    gchar* cle;             //Clé canonique dans la table des styles
+    GtkCssProvider* provider;//Le provider de la classe, ajouté à l'écran
+    guint refcount;         //Nombre de widgets qui utilisent ce style
+    GHashTable* widgets;    //Widgets qui portent la classe (GtkWidget* -> MembreStyle*)
+    struct SharedStyle* fusion;//Style dans lequel celui-ci a été fusionné par un restyle (NULL sinon)
+} SharedStyle;
+
+//Appartenance d'un widget à un style partagé, gardée sur le widget ("style_partage")
+typedef struct {
+    GtkWidget* widget;
+    SharedStyle* style;     //NULL une fois le style libéré
+    gchar classe[32];       //Copie du nom de la classe portée par le widget
+} MembreStyle;
+
+//Table des styles partagés (clé canonique -> SharedStyle*)
+static GHashTable* styles_partages = NULL;
+//Compteur servant à nommer les classes CSS
+static guint styles_partages_compteur = 0;
+
+
+/**********************************************************************************************************
+ Nom            : cle_style()
+ Entrée         : police, color, taille, gras, bgcolor, border, border_radius - les valeurs du style
+ Sortie         : Une chaine nouvellement allouée (à libérer avec g_free)
+ Description    : Construit la clé canonique d'un style. Deux styles ayant les memes valeurs
+                  produisent la meme clé et partagent donc le meme objet.
+**********************************************************************************************************/
+static gchar* cle_style(const gchar* police, const gchar* color, gint taille, gint gras,
+                        const gchar* bgcolor, int border, int border_radius) {
+    return g_strdup_printf("%s|%s|%d|%d|%s|%d|%d",
+                           police ? police : "", color ? color : "",
+                           taille, gras, bgcolor ? bgcolor : "",
+                           border, border_radius);
+}
+
+/**********************************************************************************************************
+ Nom            : generer_css_style()
+ Entrée         : s - Le style partagé
+ Sortie         : Le code CSS de la classe du style (à libérer avec g_free)
+ Description    : Génère la règle CSS de la classe. Seuls les attributs définis sont écrits.
+                  La couleur et la police sont aussi appliquées au label enfant (cas des boutons).
+**********************************************************************************************************/
+static gchar* generer_css_style(const SharedStyle* s) {
+    GString* texte = g_string_new(NULL);
+
+    //Police et couleur du texte (communes au widget et à son label)
+    if(s->police)
+        g_string_append_printf(texte, " font-family: \"%s\";", s->police);
+    if(s->taille > 0)
+        g_string_append_printf(texte, " font-size: %dpt;", s->taille);
+    if(s->gras == 1)
+        g_string_append(texte, " font-weight: bold;");
+    else if(s->gras == 0)
+        g_string_append(texte, " font-weight: normal;");
+    if(s->color[0] != '\0')
+        g_string_append_printf(texte, " color: %s;", s->color);
+
+    GString* css = g_string_new(NULL);
+    g_string_append_printf(css, ".%s {%s", s->classe, texte->str);
+
+    //Background: une image si la valeur contient une extension, sinon une couleur
+    if(s->bgcolor){
+        if(strchr(s->bgcolor, '.'))
+            g_string_append_printf(css, " background: url('%s') no-repeat center center;"
+                                        " background-size: cover;", s->bgcolor);
+        else
+            g_string_append_printf(css, " background: %s;", s->bgcolor);
+    }
+    if(s->border > -1)
+        g_string_append_printf(css, " border: %dpx solid black;", s->border);
+    if(s->border_radius > -1)
+        g_string_append_printf(css, " border-radius: %dpx;", s->border_radius);
+    g_string_append(css, " }\n");
+
+    if(texte->len)
+        g_string_append_printf(css, ".%s label {%s }\n", s->classe, texte->str);
+
+    g_string_free(texte, TRUE);
+    return g_string_free(css, FALSE);
+}
+
+//Copie les valeurs d'un Style dans un style partagé (sans toucher à la classe)
+static void remplir_style_partage(SharedStyle* s, const Style* st) {
+    memoire_liberer(s->police);
+    memoire_liberer(s->bgcolor);
+    s->police = memoire_strdup(MEMOIRE_STYLES, st->police);
+    s->bgcolor = memoire_strdup(MEMOIRE_STYLES, st->bgcolor);
+    g_strlcpy(s->color, st->color ? st->color->hex_code : "", sizeof(s->color));
+    s->taille = st->taille;
+    s->gras = st->gras;
+    s->border = st->border;
+    s->border_radius = st->border_radius;
+}
+
+//(Re)charge la règle CSS du style dans son provider
+static void charger_css_style(SharedStyle* s) {
+    gchar* css = generer_css_style(s);
+    gtk_css_provider_load_from_data(s->provider, css, -1, NULL);
+    g_free(css);
+}
+
+
+/**********************************************************************************************************
+ Nom            : intern_style()
+ Entrée         : st - Le style recherché
+ Sortie         : Le style partagé correspondant (sa référence est incrémentée), NULL si st est NULL
+ Description    : Cherche dans la table un style ayant exactement les memes valeurs. S'il existe on
+                  le retourne, sinon on le crée avec sa classe CSS et on enregistre son provider
+                  une seule fois pour tout l'écran.
+                  Chaque appel doit etre équilibré par un appel à liberer_style_partage().
+**********************************************************************************************************/
+SharedStyle* intern_style(const Style* st) {
+    if(!st) return NULL;
+
+    if(!styles_partages)
+        styles_partages = g_hash_table_new(g_str_hash, g_str_equal);
+
+    gchar* cle = cle_style(st->police, st->color ? st->color->hex_code : NULL, st->taille,
+                           st->gras, st->bgcolor, st->border, st->border_radius);
+    SharedStyle* s = g_hash_table_lookup(styles_partages, cle);
+    if(s){
+        g_free(cle);
+        s->refcount++;
+        return s;
+    }
+
+    //Nouveau style
+    TRACE_SPAN_DEBUT(debut);
+    s = memoire_allouer0(MEMOIRE_STYLES, sizeof(SharedStyle));
+    remplir_style_partage(s, st);
+    g_snprintf(s->classe, sizeof(s->classe), "xt-style-%u", ++styles_partages_compteur);
+    s->cle = cle;
+    s->refcount = 1;
+    s->widgets = g_hash_table_new(g_direct_hash, g_direct_equal);
+    s->provider = gtk_css_provider_new();
+    charger_css_style(s);
+    gtk_style_context_add_provider_for_screen(gdk_screen_get_default(),
+                                              GTK_STYLE_PROVIDER(s->provider),
+                                              GTK_STYLE_PROVIDER_PRIORITY_USER);
+    g_hash_table_insert(styles_partages, s->cle, s);
+    TRACE_SPAN_FIN(debut, TRACE_AFFICHAGE, "CSS nouveau style");
+    return s;
+}
+
+//Prend une référence supplémentaire sur un style partagé
+SharedStyle* ref_style_partage(SharedStyle* s) {
+    if(s) s->refcount++;
+    return s;
+}
+
+//Style réellement porté: celui dans lequel s a été fusionné, s'il y en a un
+SharedStyle* style_partage_effectif(SharedStyle* s) {
+    while(s && s->fusion)
+        s = s->fusion;
+    return s;
+}
+
+/**********************************************************************************************************
+ Nom            : liberer_style_partage()
+ Entrée         : s - Le style partagé
+ Sortie         : Aucune
+ Description    : Décrémente la référence du style. Au dernier utilisateur, la classe est retirée
+                  de l'écran et la mémoire est libérée.
+**********************************************************************************************************/
+void liberer_style_partage(SharedStyle* s) {
+    if(!s || --s->refcount > 0) return;
+
+    if(styles_partages && g_hash_table_lookup(styles_partages, s->cle) == s)
+        g_hash_table_remove(styles_partages, s->cle);
+    //Un style fusionné n'a plus de provider
+    if(s->provider){
+        gtk_style_context_remove_provider_for_screen(gdk_screen_get_default(),
+                                                     GTK_STYLE_PROVIDER(s->provider));
+        g_object_unref(s->provider);
+    }
+    //Les widgets qui portent encore la classe ne doivent plus pointer vers ce style
+    GHashTableIter it;
+    gpointer widget, membre;
+    g_hash_table_iter_init(&it, s->widgets);
+    while(g_hash_table_iter_next(&it, &widget, &membre))
+        ((MembreStyle*)membre)->style = NULL;
+    g_hash_table_destroy(s->widgets);
+    liberer_style_partage(s->fusion);
+    memoire_liberer(s->police);
+    memoire_liberer(s->bgcolor);
+    g_free(s->cle);
+    memoire_liberer(s);
+}
+
+//Retire un widget de son style (appelée quand le widget change de style ou est détruit)
+static void quitter_style_partage(gpointer data) {
+    MembreStyle* m = (MembreStyle*)data;
+    if(m->style && g_hash_table_lookup(m->style->widgets, m->widget) == m)
+        g_hash_table_remove(m->style->widgets, m->widget);
+    memoire_liberer(m);
+}
+
+/**********************************************************************************************************
+ Nom            : appliquer_style_partage()
+ Entrée         : widget - Le widget à styliser
+                  s - Le style partagé (NULL pour retirer le style)
+ Sortie         : Aucune
+ Description    : Remplace la classe de style du widget par celle de s. Aucune règle CSS n'est
+                  créée: le widget rejoint simplement la classe déjà enregistrée.
+                  Le style garde la liste de ses widgets pour pouvoir les déplacer lors d'une fusion.
+**********************************************************************************************************/
+void appliquer_style_partage(GtkWidget* widget, SharedStyle* s) {
+    if(!widget) return;
+    TRACE_SPAN_DEBUT(debut);
+    GtkStyleContext* context = gtk_widget_get_style_context(widget);
+    s = style_partage_effectif(s);
+
+    //Le membre garde sa propre copie du nom de classe: l'ancien style peut etre libéré
+    //avant le prochain appel sans que ce nom ne pointe vers de la mémoire libérée
+    MembreStyle* ancien = g_object_get_data(G_OBJECT(widget), "style_partage");
+    if(ancien)
+        gtk_style_context_remove_class(context, ancien->classe);
+
+    if(s){
+        gtk_style_context_add_class(context, s->classe);
+        MembreStyle* m = memoire_allouer0(MEMOIRE_STYLES, sizeof(MembreStyle));
+        m->widget = widget;
+        m->style = s;
+        g_strlcpy(m->classe, s->classe, sizeof(m->classe));
+        g_hash_table_insert(s->widgets, widget, m);
+        //Remplacer la donnée retire le widget de son ancien style
+        g_object_set_data_full(G_OBJECT(widget), "style_partage", m, quitter_style_partage);
+    }
+    else
+        g_object_set_data(G_OBJECT(widget), "style_partage", NULL);
+    TRACE_SPAN_FIN(debut, TRACE_AFFICHAGE, "CSS application");
+}
+
+//Déplace les widgets de s dans la classe de cible; s renvoie ensuite vers cible
+static void fusionner_style_partage(SharedStyle* s, SharedStyle* cible) {
+    GHashTableIter it;
+    gpointer widget, membre;
+    g_hash_table_iter_init(&it, s->widgets);
+    while(g_hash_table_iter_next(&it, &widget, &membre)){
+        MembreStyle* m = (MembreStyle*)membre;
+        GtkStyleContext* context = gtk_widget_get_style_context(GTK_WIDGET(widget));
+        gtk_style_context_remove_class(context, m->classe);
+        gtk_style_context_add_class(context, cible->classe);
+        m->style = cible;
+        g_strlcpy(m->classe, cible->classe, sizeof(m->classe));
+        g_hash_table_insert(cible->widgets, widget, m);
+    }
+    g_hash_table_remove_all(s->widgets);
+
+    //Les propriétaires de s le gardent: s retient cible jusqu'à sa propre libération
+    s->fusion = ref_style_partage(cible);
+    gtk_style_context_remove_provider_for_screen(gdk_screen_get_default(),
+                                                 GTK_STYLE_PROVIDER(s->provider));
+    g_object_unref(s->provider);
+    s->provider = NULL;
+}
+
+/**********************************************************************************************************
+ Nom            : restyler_style_partage()
+ Entrée         : s - Le style partagé à modifier
+                  st - Les nouvelles valeurs
+ Sortie         : Aucune
+ Description    : Modifie les valeurs d'une classe existante. Seul son provider est rechargé, donc
+                  tous les widgets de la classe sont mis à jour d'un coup.
+                  Si un autre style a déjà ces valeurs, s y est fusionné: ses widgets passent dans
+                  la classe de ce style et le provider de s est retiré de l'écran.
+**********************************************************************************************************/
+void restyler_style_partage(SharedStyle* s, const Style* st) {
+    s = style_partage_effectif(s);
+    if(!s || !st) return;
+    TRACE_SPAN_DEBUT(debut);
+
+    gchar* cle = cle_style(st->police, st->color ? st->color->hex_code : NULL, st->taille,
+                           st->gras, st->bgcolor, st->border, st->border_radius);
+    SharedStyle* cible = g_hash_table_lookup(styles_partages, cle);
+    if(cible == s){
+        g_free(cle);
+        TRACE_SPAN_FIN(debut, TRACE_AFFICHAGE, "CSS restyle");
+        return;
+    }
+
+    if(g_hash_table_lookup(styles_partages, s->cle) == s)
+        g_hash_table_remove(styles_partages, s->cle);
+    g_free(s->cle);
+    s->cle = cle;
+    remplir_style_partage(s, st);
+
+    if(cible)
+        fusionner_style_partage(s, cible);
+    else{
+        g_hash_table_insert(styles_partages, s->cle, s);
+        charger_css_style(s);
+    }
+    TRACE_SPAN_FIN(debut, TRACE_AFFICHAGE, "CSS restyle");
+}
+
+//Nombre de widgets qui portent la classe d'un style partagé
+guint nombre_widgets_style_partage(SharedStyle* s) {
+    s = style_partage_effectif(s);
+    return s ? g_hash_table_size(s->widgets) : 0;
+}
+
+//Nombre de styles partagés, c'est-à-dire de providers CSS enregistrés sur l'écran
+guint nombre_styles_partages() {
+    return styles_partages ? g_hash_table_size(styles_partages) : 0;
+}
+
+//Libère un Style créé par init_style ainsi que sa couleur
+void liberer_style(Style* st) {
+    if(!st) return;
+    liberer_hex_color(st->color);
+    memoire_liberer(st);
+}
+
+
+#endif //TEST1_STYLE_H
@@ -25,7 +25,7 @@ MonTextView *init_textview(const gchar *texte, const gchar *tit, coordonnees C,
         exit(-1);
     }
 
-    MonTextView *T = (MonTextView *)malloc(sizeof(MonTextView));
+    MonTextView *T = (MonTextView *)memoire_allouer(MEMOIRE_WIDGETS, sizeof(MonTextView));
     if (!T) {
         printf("Erreur d'allocation mémoire pour le TextView.\n");
         exit(-1);
@@ -33,7 +33,7 @@ MonTextView *init_textview(const gchar *texte, const gchar *tit, coordonnees C,
 
     // Allocation et initialisation du titre
     if (tit) {
-        T->titre = (gchar *)malloc(30 * sizeof(gchar));
+        T->titre = (gchar *)memoire_allouer(MEMOIRE_WIDGETS, 30 * sizeof(gchar));
         if (!T->titre) {
             printf("Erreur d'allocation mémoire pour le titre du TextView.\n");
             exit(-1);
@@ -44,7 +44,7 @@ MonTextView *init_textview(const gchar *texte, const gchar *tit, coordonnees C,
     }
 
     // Allocation et initialisation du texte
-    T->texte = (gchar *)malloc(300 * sizeof(gchar));
+    T->texte = (gchar *)memoire_allouer(MEMOIRE_WIDGETS, 300 * sizeof(gchar));
     if (!T->texte) {
         printf("Erreur d'allocation mémoire pour le texte du TextView.\n");
         exit(-1);
@@ -59,9 +59,22 @@ MonTextView *init_textview(const gchar *texte, const gchar *tit, coordonnees C,
     return T;
 }
 
+// Fonction pour libérer un MonTextView (texte et titre compris).
+// Appelée à la destruction du TextView (voir creer_textview).
+void liberer_textview(gpointer data) {
+    MonTextView *T = (MonTextView *)data;
+    if (!T)
+        return;
+    memoire_liberer(T->texte);
+    memoire_liberer(T->titre);
+    memoire_liberer(T);
+}
+
 // Fonction pour créer un TextView GTK à partir d'un objet MonTextView
 MonTextView *creer_textview(MonTextView *T) {
     T->elem = gtk_text_view_new();
+    // Le TextView possède sa structure: elle est libérée à sa destruction
+    memoire_attacher(T->elem, T, liberer_textview);
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(T->elem));
     gtk_text_buffer_set_text(buffer, T->texte, -1);
 
@@ -158,11 +171,8 @@ GtkWidget* create_text_view_with_scrolled_window(dimension *dim, const gchar *ti
     GtkWidget *frame = gtk_frame_new(title);
     gtk_container_add(GTK_CONTAINER(frame), scrolled_window);
     
-    // Show the text view, scrolled window, and frame
-    gtk_widget_show(text_view);
-    gtk_widget_show(scrolled_window);
-    gtk_widget_show(frame);
-    
+    // The frame is returned hidden: the caller shows it once it is placed
+    // (afficher_plus_tard), so the whole subtree is shown in a single pass
     return frame;
 }
 
@@ -0,0 +1,358 @@
+//
+// Created by ACER on 06/01/2025.
+//
+
+#ifndef TEST1_TRACE_H
+#define TEST1_TRACE_H
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+
+//Traces de mise au point par niveau et par catégorie.
+//TRACER(categorie, niveau, format, ...) remplace les printf/g_print de mise au point:
+// - à la compilation, -DTRACE_NIVEAU_MAX=<n> retire tous les appels de niveau supérieur à n
+//   (-1 les retire tous: la condition est constante et le compilateur supprime l'appel);
+// - à l'exécution, la variable d'environnement XML_TAHA_TRACE choisit les catégories
+//   affichées, par exemple XML_TAHA_TRACE=xml,arbre:info ou XML_TAHA_TRACE=tout.
+//   Sans cette variable aucune trace n'est formatée: le cout se limite à un test de masque.
+//Les messages sont formatés dans un tampon circulaire sans verrou (chaque écrivain réserve
+//sa case par un incrément atomique) et écrits sur stderr par le thread principal, hors des
+//chemins chauds, toutes les TRACE_PERIODE_MS et à la fin du programme.
+//
+//Profil des phases: TRACE_SPAN_DEBUT(debut) ... TRACE_SPAN_FIN(debut, categorie, "nom") mesure
+//une portion de code. Si la variable d'environnement XML_TAHA_PROFIL donne un fichier (par exemple
+//XML_TAHA_PROFIL=profil.json), les mesures sont gardées en mémoire et écrites à la fin du programme
+//au format "Chrome trace event", que l'on ouvre dans Perfetto (ui.perfetto.dev) ou chrome://tracing.
+//Sans cette variable une mesure coute un test; avec TRACE_NIVEAU_MAX=-1 elle disparait.
+
+//Niveaux (du plus important au plus bavard)
+#define TRACE_ERREUR 0
+#define TRACE_AVERT  1
+#define TRACE_INFO   2
+#define TRACE_DEBUG  3
+
+//Catégories (un bit chacune)
+#define TRACE_XML         (1u << 0)   // Lecture des fichiers XML
+#define TRACE_ARBRE       (1u << 1)   // Arbre et génération du XML
+#define TRACE_PROPRIETES  (1u << 2)   // Panneau de propriétés
+#define TRACE_EVENEMENTS  (1u << 3)   // Clics et sélection
+#define TRACE_AFFICHAGE   (1u << 4)   // Création et affichage des widgets
+#define TRACE_TRAVAUX     (1u << 5)   // Pool de threads et application des résultats
+#define TRACE_TOUT        0xFFFFFFFFu
+
+#ifndef TRACE_NIVEAU_MAX
+#define TRACE_NIVEAU_MAX TRACE_DEBUG
+#endif
+
+//Taille du tampon circulaire (puissance de 2) et d'un message
+#define TRACE_TAMPON 4096
+#define TRACE_MESSAGE 192
+#define TRACE_PERIODE_MS 100
+//Nombre de mesures gardées pour le profil (puissance de 2, les plus anciennes sont écrasées)
+#define TRACE_SPANS (1 << 17)
+
+#define TRACER(categorie, niveau, ...) \
+    do { \
+        if ((niveau) <= TRACE_NIVEAU_MAX && trace_active((categorie), (niveau))) \
+            trace_ecrire((categorie), (niveau), __VA_ARGS__); \
+    } while (0)
+
+//Le nom d'une mesure doit etre une chaine statique: seul le pointeur est gardé
+#define TRACE_SPAN_DEBUT(debut) \
+    gint64 debut = (TRACE_NIVEAU_MAX >= 0 && trace_profil_actif()) ? g_get_monotonic_time() : 0
+
+#define TRACE_SPAN_FIN(debut, categorie, nom) \
+    do { \
+        if (TRACE_NIVEAU_MAX >= 0 && (debut)) \
+            trace_span_ecrire((categorie), (nom), (debut)); \
+    } while (0)
+
+typedef struct {
+    gint sequence;              // Position + 1 une fois le message écrit, 0 pendant l'écriture
+    guint categorie;
+    gint niveau;
+    gint64 temps;               // g_get_monotonic_time() à l'écriture
+    char texte[TRACE_MESSAGE];
+} trace_entree;
+
+static trace_entree trace_tampon[TRACE_TAMPON];
+//Prochaine case à réserver (incrémentée atomiquement par les écrivains)
+static gint trace_tete = 0;
+//Prochaine case à écrire sur stderr (thread principal uniquement)
+static guint trace_lecture = 0;
+//Catégories actives pour chaque niveau (niveau n: catégories dont le seuil est >= n)
+static guint trace_masques[TRACE_DEBUG + 1];
+static gsize trace_initialisee = 0;
+static gint64 trace_debut = 0;
+
+typedef struct {
+    gint sequence;              // Position + 1 une fois la mesure écrite, 0 pendant l'écriture
+    guint categorie;
+    gint thread;                // Numéro du thread (1 pour le premier thread mesuré)
+    const char* nom;
+    gint64 debut;
+    gint64 duree;
+} trace_span;
+
+//Mesures du profil (allouées seulement si XML_TAHA_PROFIL est défini)
+static trace_span* trace_spans = NULL;
+static gint trace_spans_tete = 0;
+static gchar* trace_profil_chemin = NULL;
+//Numérotation des threads pour le profil
+static gint trace_dernier_thread = 0;
+static GPrivate trace_thread_numero = G_PRIVATE_INIT(NULL);
+
+static const char* trace_noms_categories[] = {"xml", "arbre", "proprietes", "evenements", "affichage", "travaux"};
+static const char* trace_noms_niveaux[] = {"erreur", "avert", "info", "debug"};
+
+void trace_vider(FILE* sortie);
+gboolean trace_profil_exporter(const char* chemin);
+
+static gboolean trace_vider_periodique(gpointer data) {
+    trace_vider(stderr);
+    return G_SOURCE_CONTINUE;
+}
+
+static void trace_vider_sortie(void) {
+    trace_vider(stderr);
+}
+
+static void trace_profil_sortie(void) {
+    trace_profil_exporter(trace_profil_chemin);
+}
+
+//Lit XML_TAHA_TRACE: liste de "categorie[:niveau]" séparés par des virgules
+static void trace_lire_configuration() {
+    const char* profil = g_getenv("XML_TAHA_PROFIL");
+    const char* config = g_getenv("XML_TAHA_TRACE");
+
+    trace_debut = g_get_monotonic_time();
+    if (profil && *profil) {
+        trace_profil_chemin = g_strdup(profil);
+        trace_spans = g_new0(trace_span, TRACE_SPANS);
+        atexit(trace_profil_sortie);
+    }
+    if (!config || !*config)
+        return;
+
+    gchar** elements = g_strsplit(config, ",", -1);
+    for (int i = 0; elements[i]; i++) {
+        gchar** parties = g_strsplit(g_strstrip(elements[i]), ":", 2);
+        guint categories = 0;
+        int niveau = TRACE_DEBUG;
+
+        if (!g_strcmp0(parties[0], "tout"))
+            categories = TRACE_TOUT;
+        for (guint c = 0; c < G_N_ELEMENTS(trace_noms_categories); c++)
+            if (!g_strcmp0(parties[0], trace_noms_categories[c]))
+                categories = 1u << c;
+        if (parties[0] && parties[1])
+            for (int n = 0; n <= TRACE_DEBUG; n++)
+                if (!g_strcmp0(parties[1], trace_noms_niveaux[n]))
+                    niveau = n;
+
+        if (!categories)
+            fprintf(stderr, "XML_TAHA_TRACE: categorie inconnue \"%s\"\n", parties[0]);
+        for (int n = 0; n <= niveau; n++)
+            trace_masques[n] |= categories;
+        g_strfreev(parties);
+    }
+    g_strfreev(elements);
+
+    //Les messages ne sont écrits que par le thread principal
+    g_timeout_add(TRACE_PERIODE_MS, trace_vider_periodique, NULL);
+    atexit(trace_vider_sortie);
+}
+
+//Lit la configuration au premier appel (une seule fois, meme entre threads)
+static void trace_initialiser() {
+    if (g_once_init_enter(&trace_initialisee)) {
+        trace_lire_configuration();
+        g_once_init_leave(&trace_initialisee, 1);
+    }
+}
+
+/**********************************************************************************************************
+ Nom            : trace_active()
+ Entrée         : categorie - Une ou plusieurs catégories TRACE_*
+                  niveau    - Le niveau du message
+ Sortie         : TRUE si le message doit etre enregistré
+**********************************************************************************************************/
+gboolean trace_active(guint categorie, int niveau) {
+    trace_initialiser();
+    return niveau >= 0 && niveau <= TRACE_DEBUG && (trace_masques[niveau] & categorie) != 0;
+}
+
+/**********************************************************************************************************
+ Nom            : trace_ecrire()
+ Entrée         : categorie, niveau - Voir trace_active()
+                  format, ...       - Message façon printf (tronqué à TRACE_MESSAGE caractères)
+ Sortie         : Aucune
+ Description    : Réserve une case du tampon par un incrément atomique et y formate le message.
+                  Peut etre appelée depuis n'importe quel thread, sans verrou. Si le tampon fait
+                  un tour complet avant d'etre vidé, les plus anciens messages sont perdus (et comptés).
+**********************************************************************************************************/
+void trace_ecrire(guint categorie, int niveau, const char* format, ...) {
+    guint position = (guint)g_atomic_int_add(&trace_tete, 1);
+    trace_entree* entree = &trace_tampon[position & (TRACE_TAMPON - 1)];
+    va_list args;
+
+    g_atomic_int_set(&entree->sequence, 0);
+    entree->categorie = categorie;
+    entree->niveau = niveau;
+    entree->temps = g_get_monotonic_time();
+    va_start(args, format);
+    g_vsnprintf(entree->texte, TRACE_MESSAGE, format, args);
+    va_end(args);
+    g_atomic_int_set(&entree->sequence, (gint)(position + 1));
+}
+
+//TRUE si les mesures du profil sont enregistrées (XML_TAHA_PROFIL défini)
+gboolean trace_profil_actif() {
+    trace_initialiser();
+    return trace_spans != NULL;
+}
+
+//Numéro du thread courant dans le profil
+static gint trace_thread() {
+    gint numero = GPOINTER_TO_INT(g_private_get(&trace_thread_numero));
+    if (!numero) {
+        numero = g_atomic_int_add(&trace_dernier_thread, 1) + 1;
+        g_private_set(&trace_thread_numero, GINT_TO_POINTER(numero));
+    }
+    return numero;
+}
+
+/**********************************************************************************************************
+ Nom            : trace_span_ecrire()
+ Entrée         : categorie - La catégorie TRACE_* de la mesure
+                  nom       - Le nom affiché dans le profil (chaine statique)
+                  debut     - g_get_monotonic_time() au début de la portion mesurée
+ Sortie         : Aucune
+ Description    : Enregistre une mesure qui se termine maintenant. Comme trace_ecrire(), la case est
+                  réservée par un incrément atomique: utilisable depuis n'importe quel thread.
+**********************************************************************************************************/
+void trace_span_ecrire(guint categorie, const char* nom, gint64 debut) {
+    gint64 fin = g_get_monotonic_time();
+    if (!trace_spans)
+        return;
+    guint position = (guint)g_atomic_int_add(&trace_spans_tete, 1);
+    trace_span* span = &trace_spans[position & (TRACE_SPANS - 1)];
+
+    g_atomic_int_set(&span->sequence, 0);
+    span->categorie = categorie;
+    span->thread = trace_thread();
+    span->nom = nom;
+    span->debut = debut;
+    span->duree = fin - debut;
+    g_atomic_int_set(&span->sequence, (gint)(position + 1));
+}
+
+//Nom de la première catégorie d'un masque
+static const char* trace_nom_categorie(guint categorie) {
+    for (guint c = 0; c < G_N_ELEMENTS(trace_noms_categories); c++)
+        if (categorie & (1u << c))
+            return trace_noms_categories[c];
+    return "?";
+}
+
+/**********************************************************************************************************
+ Nom            : trace_vider()
+ Entrée         : sortie - Le fichier où écrire (stderr en général)
+ Sortie         : Aucune
+ Description    : Ecrit les messages complets du tampon, dans l'ordre. S'arrete sur un message en
+                  cours d'écriture, qui sera repris au prochain appel. A appeler depuis le thread
+                  principal (fait automatiquement par un timeout et à la sortie du programme).
+**********************************************************************************************************/
+void trace_vider(FILE* sortie) {
+    guint tete = (guint)g_atomic_int_get(&trace_tete);
+    guint perdus = 0;
+    trace_entree copie;
+
+    if (tete - trace_lecture > TRACE_TAMPON) {
+        perdus = tete - trace_lecture - TRACE_TAMPON;
+        trace_lecture = tete - TRACE_TAMPON;
+    }
+
+    while (trace_lecture != tete) {
+        trace_entree* entree = &trace_tampon[trace_lecture & (TRACE_TAMPON - 1)];
+        guint attendue = trace_lecture + 1;
+        guint sequence = (guint)g_atomic_int_get(&entree->sequence);
+        if (sequence != attendue) {
+            //Case réutilisée par un écrivain plus récent: le message est perdu
+            if (sequence != 0 && sequence - attendue < G_MAXINT) {
+                perdus++;
+                trace_lecture++;
+                continue;
+            }
+            break;  //Encore en cours d'écriture
+        }
+        memcpy(&copie, entree, sizeof(copie));
+        //Réécrite pendant la copie: perdue aussi
+        if ((guint)g_atomic_int_get(&entree->sequence) != attendue) {
+            perdus++;
+            trace_lecture++;
+            continue;
+        }
+        copie.texte[TRACE_MESSAGE - 1] = '\0';
+        fprintf(sortie, "[%9.3f ms] [%s] %s: %s\n", (copie.temps - trace_debut) / 1000.0,
+                trace_nom_categorie(copie.categorie), trace_noms_niveaux[copie.niveau], copie.texte);
+        trace_lecture++;
+    }
+    if (perdus)
+        fprintf(sortie, "[trace] %u message(s) perdu(s) (tampon plein)\n", perdus);
+    fflush(sortie);
+}
+
+/**********************************************************************************************************
+ Nom            : trace_profil_exporter()
+ Entrée         : chemin - Le fichier JSON à écrire
+ Sortie         : TRUE si le fichier a été écrit
+ Description    : Ecrit les mesures enregistrées au format "Chrome trace event" (événements complets
+                  "X", temps en microsecondes depuis le lancement). Appelée automatiquement à la fin
+                  du programme quand XML_TAHA_PROFIL est défini; peut aussi etre appelée à la demande.
+                  Les mesures encore en cours d'écriture par un autre thread sont ignorées.
+**********************************************************************************************************/
+gboolean trace_profil_exporter(const char* chemin) {
+    if (!trace_spans || !chemin)
+        return FALSE;
+    FILE* sortie = fopen(chemin, "w");
+    if (!sortie) {
+        fprintf(stderr, "[trace] impossible d'ecrire le profil %s\n", chemin);
+        return FALSE;
+    }
+
+    guint tete = (guint)g_atomic_int_get(&trace_spans_tete);
+    guint premiere = tete > TRACE_SPANS ? tete - TRACE_SPANS : 0;
+    guint ecrites = 0;
+    trace_span copie;
+
+    fprintf(sortie, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(sortie, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+                    "\"args\":{\"name\":\"xml_taha\"}}");
+    for (guint position = premiere; position != tete; position++) {
+        trace_span* span = &trace_spans[position & (TRACE_SPANS - 1)];
+        if ((guint)g_atomic_int_get(&span->sequence) != position + 1)
+            continue;
+        memcpy(&copie, span, sizeof(copie));
+        if ((guint)g_atomic_int_get(&span->sequence) != position + 1)
+            continue;
+        fprintf(sortie, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                        "\"ts\":%" G_GINT64_FORMAT ",\"dur\":%" G_GINT64_FORMAT "}",
+                copie.nom, trace_nom_categorie(copie.categorie), copie.thread,
+                copie.debut - trace_debut, copie.duree);
+        ecrites++;
+    }
+    fprintf(sortie, "\n]}\n");
+    fclose(sortie);
+
+    fprintf(stderr, "[trace] profil: %u mesure(s) ecrite(s) dans %s", ecrites, chemin);
+    if (premiere)
+        fprintf(stderr, " (%u plus ancienne(s) perdue(s))", premiere);
+    fprintf(stderr, "\n");
+    return TRUE;
+}
+
+
+#endif //TEST1_TRACE_H
@@ -5,6 +5,7 @@
 #include "app_data.h"
 #include "containers_list.h"
 #include "widget_props.h"
+#include "perf_panel.h"
 
 // Forward declaration for callback function
 static void on_show_arbre_clicked(GtkWidget *button, gpointer data);
@@ -31,8 +32,8 @@ gboolean find_widget_in_tree_recursive(GtkTreeModel *model, GtkTreeIter *parent_
     }
     
     while (valid) {
-        GtkWidget *current_widget;
-        gtk_tree_model_get(model, &iter, 1, &current_widget, -1);
+        // Menu rows hold their model: the widget is read from it (NULL while unbuilt)
+        GtkWidget *current_widget = menu_hierarchy_row_widget(model, &iter);
         
         if (current_widget == search_widget) {
             // Found the widget
@@ -55,6 +56,31 @@ gboolean find_widget_in_tree_recursive(GtkTreeModel *model, GtkTreeIter *parent_
     return FALSE;
 }
 
+// Index the widget in its GtkFixed and store the same x/y/width/height on its Arbre node,
+// so the spatial index (hit-testing, rubber band, overlaps, snapping) and the Arbre agree
+static void sync_node_geometry(Arbre *node, GtkWidget *widget) {
+    GdkRectangle rect;
+    char value[16];
+    
+    if (!indexer_widget_fixed(widget, &rect) || !node)
+        return;
+    
+    g_snprintf(value, sizeof(value), "%d", rect.x);
+    set_property_of_node(node, "x", value);
+    g_snprintf(value, sizeof(value), "%d", rect.y);
+    set_property_of_node(node, "y", value);
+    g_snprintf(value, sizeof(value), "%d", rect.width);
+    set_property_of_node(node, "width", value);
+    g_snprintf(value, sizeof(value), "%d", rect.height);
+    set_property_of_node(node, "height", value);
+}
+
+// Call after moving or resizing a widget. The node was stored on the widget by
+// add_widget_to_both_trees(): no walk of the Arbre per drag step.
+void update_widget_geometry(AppData *app_data, GtkWidget *widget) {
+    sync_node_geometry(noeud_du_widget(widget), widget);
+}
+
 // After adding or removing widgets, we need to update the Arbre view
 void update_arbre_view(AppData *app_data) {
     if (app_data->arbre_scroll && app_data->widget_tree) {
@@ -75,10 +101,34 @@ void update_arbre_view(AppData *app_data) {
     }
 }
 
+// Depth of nested tree_sync_begin_batch() calls
+static gint tree_sync_batch_depth = 0;
+
+// Start adding or removing many widgets as one transaction: the hierarchy view is
+// detached from its model and neither view is refreshed until tree_sync_end_batch()
+void tree_sync_begin_batch(AppData *app_data) {
+    if (tree_sync_batch_depth++ == 0 && app_data->hierarchy_view)
+        gtk_tree_view_set_model(GTK_TREE_VIEW(app_data->hierarchy_view), NULL);
+}
+
+// End of the transaction: reattach the hierarchy and rebuild the Arbre view once
+void tree_sync_end_batch(AppData *app_data) {
+    if (tree_sync_batch_depth == 0 || --tree_sync_batch_depth > 0)
+        return;
+    if (app_data->hierarchy_view) {
+        gtk_tree_view_set_model(GTK_TREE_VIEW(app_data->hierarchy_view),
+                                GTK_TREE_MODEL(app_data->hierarchy_store));
+        gtk_tree_view_expand_all(GTK_TREE_VIEW(app_data->hierarchy_view));
+    }
+    update_arbre_view(app_data);
+}
+
 // Updated: Add a widget to both tree structures with widget structure reference
 void add_widget_to_both_trees(AppData *app_data, GtkWidget *widget, 
                              const gchar *widget_type_str, GtkWidget *parent_container, 
                              gboolean is_container, void *widget_structure) {
+    gint64 op_start = perf_op_begin();
+    TRACE_SPAN_DEBUT(debut);
     // Generate a unique name for the widget
     // gchar *widget_name = generate_widget_name(widget_type_str, widget);
     // gtk_widget_set_name(widget, widget_name);
@@ -162,17 +212,29 @@ void add_widget_to_both_trees(AppData *app_data, GtkWidget *widget,
     if (widget_structure) {
         populate_widget_properties(new_node, widget_structure, widget_type);
     }
+    sync_node_geometry(new_node, widget);
     
+    TRACE_SPAN_DEBUT(debut_insertion);
     app_data->widget_tree = insererArbre(app_data->widget_tree, new_node, parent_name);
+    TRACE_SPAN_FIN(debut_insertion, TRACE_ARBRE, "insererArbre");
+    lier_noeud_widget(new_node);
     
     // Cleanup
     g_free(widget_name);
     
-    // Expand the tree view to show all items
-    gtk_tree_view_expand_all(GTK_TREE_VIEW(app_data->hierarchy_view));
-    
-    // After adding to both structures, update the Arbre view
-    update_arbre_view(app_data);
+    // Outside of a batch, refresh both views now
+    if (tree_sync_batch_depth == 0) {
+        // Expand the tree view to show all items
+        gtk_tree_view_expand_all(GTK_TREE_VIEW(app_data->hierarchy_view));
+        
+        // After adding to both structures, update the Arbre view
+        update_arbre_view(app_data);
+    }
+
+    // The widget was built hidden: show its subtree with the rest of the batch
+    afficher_plus_tard(widget);
+    TRACE_SPAN_FIN(debut, TRACE_ARBRE, "tree sync");
+    perf_op_end(PERF_OP_ADD_WIDGET, op_start);
 }
 
 // Remove a widget from both tree structures
@@ -184,8 +246,7 @@ void remove_widget_from_both_trees(AppData *app_data, GtkWidget *widget) {
     
     if (gtk_tree_model_get_iter_first(model, &iter)) {
         do {
-            GtkWidget *iter_widget;
-            gtk_tree_model_get(model, &iter, 1, &iter_widget, -1);
+            GtkWidget *iter_widget = menu_hierarchy_row_widget(model, &iter);
             
             if (iter_widget == widget) {
                 found = TRUE;
@@ -197,7 +258,7 @@ void remove_widget_from_both_trees(AppData *app_data, GtkWidget *widget) {
                 GtkTreeIter child_iter;
                 if (gtk_tree_model_iter_children(model, &child_iter, &iter)) {
                     do {
-                        gtk_tree_model_get(model, &child_iter, 1, &iter_widget, -1);
+                        iter_widget = menu_hierarchy_row_widget(model, &child_iter);
                         if (iter_widget == widget) {
                             iter = child_iter;  // Point to the child
                             found = TRUE;
@@ -213,17 +274,17 @@ void remove_widget_from_both_trees(AppData *app_data, GtkWidget *widget) {
         gtk_tree_store_remove(app_data->hierarchy_store, &iter);
     }
     
-    // PART 2: Remove from Arbre
-    // Note: For now, we don't have a direct removal function for Arbre
-    // The most straightforward approach would be to recreate the Arbre
-    // This would be inefficient but simple to implement
+    // The widget no longer takes part in area queries
+    desindexer_widget_fixed(widget);
     
-    // TODO: Implement a proper node removal from Arbre structure
-    // For now, we'll just print a message
-    g_print("Note: Widget removed from GtkTreeStore but not from Arbre structure\n");
+    // PART 2: Remove from Arbre
+    // The node and its children go away; the widget structures they point to are
+    // owned by the widgets and freed when the widgets are destroyed.
+    app_data->widget_tree = supprimerNoeudParWidget(app_data->widget_tree, widget);
     
     // After removing from GtkTreeStore, update the Arbre view
-    update_arbre_view(app_data);
+    if (tree_sync_batch_depth == 0)
+        update_arbre_view(app_data);
 }
 
 // Create a visual representation of the Arbre structure for debugging
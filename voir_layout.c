@@ -0,0 +1,34 @@
+//
+// Created by ACER on 06/01/2025.
+//
+// Affiche un layout XML avec libxmltaha et donne son temps de chargement.
+// Utilisation: voir_layout fichier.html
+// N'inclut que xmltaha.h: le chargeur vient de la bibliothèque (cible xmltaha).
+//
+
+#include <gtk/gtk.h>
+#include "xmltaha.h"
+
+int main(int argc, char *argv[]) {
+    gtk_init(&argc, &argv);
+    if (argc < 2) {
+        printf("Utilisation: %s fichier.html\n", argv[0]);
+        return 1;
+    }
+
+    GError* erreur = NULL;
+    gint64 debut = g_get_monotonic_time();
+    XmlTahaLayout* layout = xmltaha_charger_fichier(argv[1], &erreur);
+    gint64 duree = g_get_monotonic_time() - debut;
+    if (!layout) {
+        printf("ERREUR de chargement de %s: %s\n", argv[1], erreur->message);
+        g_error_free(erreur);
+        return 1;
+    }
+    printf("%s charge en %.2f ms\n", argv[1], duree / 1000.0);
+
+    g_signal_connect(xmltaha_fenetre(layout), "destroy", G_CALLBACK(gtk_main_quit), NULL);
+    gtk_main();
+    xmltaha_liberer(layout);
+    return 0;
+}
@@ -14,7 +14,7 @@ void populate_widget_properties(Arbre *node, void *widget_structure, WidgetType
     // Store a pointer to the widget structure for later use
     node->widget_data = widget_structure;
     
-    g_print("Populating widget properties for node %s, type %s, data: %p\n", 
+    TRACER(TRACE_ARBRE, TRACE_DEBUG, "Populating widget properties for node %s, type %s, data: %p",
            node->nom, widget_type_to_string(type), widget_structure);
     
     // Process based on widget type
@@ -27,10 +27,10 @@ void populate_widget_properties(Arbre *node, void *widget_structure, WidgetType
             if (entry) {
                 // Add properties from the structure
                 char width_str[16], height_str[16], x_str[16], y_str[16], max_len_str[16];
-                sprintf(width_str, "%d", entry->dim->width);
-                sprintf(height_str, "%d", entry->dim->height);
-                sprintf(x_str, "%d", entry->cord->x);
-                sprintf(y_str, "%d", entry->cord->y);
+                sprintf(width_str, "%d", entry->dim.width);
+                sprintf(height_str, "%d", entry->dim.height);
+                sprintf(x_str, "%d", entry->cord.x);
+                sprintf(y_str, "%d", entry->cord.y);
                 sprintf(max_len_str, "%d", entry->maxlen);
                 
                 add_property_to_node(node, "width", width_str);
@@ -63,10 +63,10 @@ void populate_widget_properties(Arbre *node, void *widget_structure, WidgetType
                 char width_str[16], height_str[16], x_str[16], y_str[16];
                 char invisible_char_str[2] = {entry->invisible_char, '\0'};
                 
-                sprintf(width_str, "%d", entry->dim->width);
-                sprintf(height_str, "%d", entry->dim->height);
-                sprintf(x_str, "%d", entry->cord->x);
-                sprintf(y_str, "%d", entry->cord->y);
+                sprintf(width_str, "%d", entry->dim.width);
+                sprintf(height_str, "%d", entry->dim.height);
+                sprintf(x_str, "%d", entry->cord.x);
+                sprintf(y_str, "%d", entry->cord.y);
                 
                 add_property_to_node(node, "width", width_str);
                 add_property_to_node(node, "height", height_str);
@@ -100,10 +100,10 @@ void populate_widget_properties(Arbre *node, void *widget_structure, WidgetType
             if (radio) {
             // Add properties from the structure
             char width_str[16], height_str[16], x_str[16], y_str[16];
-            sprintf(width_str, "%d", radio->dim->width);
-            sprintf(height_str, "%d", radio->dim->height);
-            sprintf(x_str, "%d", radio->pos->x);
-            sprintf(y_str, "%d", radio->pos->y);
+            sprintf(width_str, "%d", radio->dim.width);
+            sprintf(height_str, "%d", radio->dim.height);
+            sprintf(x_str, "%d", radio->pos.x);
+            sprintf(y_str, "%d", radio->pos.y);
             
             add_property_to_node(node, "width", width_str);
             add_property_to_node(node, "height", height_str);
@@ -31,7 +31,7 @@ Mywindow* init_window(const gchar *title, const gchar *icon_name, dimension dim,
 
     // Allocation dynamique de mémoire pour une nouvelle instance de window
     Mywindow* maFenetre=NULL;
-    maFenetre=(Mywindow*)malloc(sizeof(Mywindow));
+    maFenetre=(Mywindow*)memoire_allouer(MEMOIRE_WIDGETS, sizeof(Mywindow));
     // Vérification de l'allocation de mémoire
     if(!maFenetre)
     {
@@ -45,7 +45,7 @@ Mywindow* init_window(const gchar *title, const gchar *icon_name, dimension dim,
     strcpy(maFenetre->icon_name,icon_name);
     maFenetre->resisable=resizable;
     maFenetre->position=position;
-    maFenetre->bgColor=bgColor;
+    maFenetre->bgColor=bgColor; // la fenetre prend possession du GdkRGBA de la couleur
     maFenetre->cord=cord;
 
     ///////////////////////////////////////////////////////////////////////////////////////::
@@ -60,10 +60,32 @@ Mywindow* init_window(const gchar *title, const gchar *icon_name, dimension dim,
 
 
 }
+//Libère une structure Mywindow et la couleur de fond qu'elle possède (GdkRGBA alloué par hex_color_init)
+void liberer_window(gpointer fenetre)
+{
+    Mywindow *maFenetre = (Mywindow*)fenetre;
+    if(!maFenetre)
+        return;
+    memoire_liberer(maFenetre->bgColor.color);
+    memoire_liberer(maFenetre);
+}
+
+//Applique l'icone à la fenetre une fois décodée (appelée par le cache des pixbufs)
+static void icone_vers_fenetre(GObject *fenetre, const gchar *demande, GdkPixbuf *icon)
+{
+    if(icon)
+        gtk_window_set_icon(GTK_WINDOW(fenetre), icon);
+}
+
 void create_window(Mywindow *maFenetre)
 {
     // Crée une nouvelle fenêtre GTK+ de type toplevel
+    TRACE_SPAN_DEBUT(debut);
     maFenetre->window=gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    // La fenetre possède sa structure et sa couleur de fond: elles sont libérées à sa destruction
+    memoire_attacher(maFenetre->window, maFenetre, liberer_window);
+    // Mesure du temps jusqu'au premier dessin (profil)
+    suivre_premiere_image(maFenetre->window);
     // Définit la taille par défaut de la fenêtre en utilisant les dimensions fournies
     gtk_window_set_default_size(GTK_WINDOW(maFenetre->window),maFenetre->dim.width,maFenetre->dim.height);
     // Définit la position initiale de la fenêtre
@@ -81,14 +103,13 @@ void create_window(Mywindow *maFenetre)
     //gtk_widget_override_background_color(maFenetre->window, GTK_STATE_FLAG_NORMAL,maFenetre->bgColor.color);
     // Déplace la fenêtre aux coordonnées spécifiées dans cord
     gtk_window_move(GTK_WINDOW(maFenetre->window), maFenetre->cord.x,maFenetre->cord.y);
-    // Charge l'icône de la fenêtre à partir du chemin donné
-    GdkPixbuf *icon= create_icon_from_file(maFenetre->icon_name);
-
-    //appliquer l'icon
-    gtk_window_set_icon(GTK_WINDOW(maFenetre->window), icon);
-    MonImage *background_image = init_image(maFenetre->bgImg.path,maFenetre->dim,maFenetre->cord);
+    // Charge l'icône de la fenêtre à partir du chemin donné, sans bloquer la création
+    // de la fenetre (l'icone est appliquée à la fin du décodage)
+    cache_pixbuf_obtenir_async(G_OBJECT(maFenetre->window), maFenetre->icon_name, -1, -1,
+                               icone_vers_fenetre);
     // Ajoute le widget d'image à la fenêtre
     //gtk_container_add(GTK_CONTAINER(maFenetre->window), background_image->image);
+    TRACE_SPAN_FIN(debut, TRACE_AFFICHAGE, "create_window");
 }
 
 
@@ -100,8 +121,8 @@ GtkWidget* create_image_widget_from_file(const gchar *file_path)
     GdkPixbuf *pixbuf;
     GtkWidget *image_widget;
 
-    // Charger l'image à partir du fichier spécifié
-    pixbuf = gdk_pixbuf_new_from_file(file_path, NULL);
+    // Charger l'image à partir du fichier spécifié (via le cache des pixbufs)
+    pixbuf = cache_pixbuf_obtenir(file_path, -1, -1);
     if (!pixbuf) {
         // Afficher une erreur si le chargement de l'image échoue
         g_printerr("Erreur lors du chargement de l'image : %s\n", file_path);
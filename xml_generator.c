@@ -7,6 +7,8 @@
 #include "radio_xml.h"
 #include "taha_template.h"
 #include "box.h"
+#include "menu_xml.h"
+#include "fixed_virtuel_xml.h"
 
 void on_open_file_button_clicked(GtkWidget *button, gpointer user_data) {
     GtkWidget *file_dialog;
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <gtk/gtk.h>
+#include "trace.h"
 #define MAX 40
 #define BL ' '
 #define RC '\n'
@@ -23,6 +24,8 @@ void entry_xml(FILE *file,int parent);
 void TextView_xml(FILE *file, int parent);
 void box_xml(FILE *file,int parent);
 void ProgressBar_xml(FILE *file, int parent);
+void menu_barre_xml(FILE *file,int parent);
+void fixed_virtuel_xml(FILE *file, int parent);
 
 //tableau global qui contient les widgets parents
 //0: window, 2:fixed, 4:menu_parent
@@ -42,6 +45,22 @@ void Epeurerblanc(FILE *file)
     while((car=fgetc(file))==BL ||  car== RC);
     ungetc(car,file);
 }
+//Ouvre un texte XML en mémoire comme un FILE* pour les fonctions de lecture: le texte est
+//lu sur place avec fmemopen, ou recopié dans un fichier temporaire sous Windows.
+//Rend NULL en cas d'erreur (errno indique la cause).
+FILE* ouvrir_texte_xml(const gchar* texte, gsize taille)
+{
+#ifdef G_OS_WIN32
+    FILE* file = tmpfile();
+    if (file && (fwrite(texte, 1, taille, file) != taille || fseek(file, 0, SEEK_SET) != 0)) {
+        fclose(file);
+        file = NULL;
+    }
+    return file;
+#else
+    return fmemopen((void*)texte, taille, "r");
+#endif
+}
 //---> fonction qui transforme un caractere en entier
 int char_TO_int(char car)
 {
@@ -58,7 +77,22 @@ void lire_gchar_str(FILE* file,char str[MAX])
         str[ind++] = car; // Lire le mot
     }
     str[ind] = '\0';
-    printf("mot lue de lire_gchar_str%s\n", str);
+    TRACER(TRACE_XML, TRACE_DEBUG, "mot lu par lire_gchar_str: %s", str);
+    fseek(file, 10, SEEK_CUR);
+}
+//Comme lire_gchar_str() mais sans dépasser taille caractères (fin de chaine comprise):
+//le reste de la valeur est lu et ignoré
+void lire_gchar_str_borne(FILE* file, char* str, int taille)
+{
+    int car;
+    int ind=0;
+    Epeurerblanc(file);
+    fseek(file, 1, SEEK_CUR);
+    while (((car = fgetc(file)) != EOF) && (car != '<')) {
+        if(ind < taille - 1) str[ind++] = (char)car; // Lire le mot
+    }
+    str[ind] = '\0';
+    TRACER(TRACE_XML, TRACE_DEBUG, "mot lu par lire_gchar_str_borne: %s", str);
     fseek(file, 10, SEEK_CUR);
 }
 ///pour lire la valeur d'lement property
@@ -97,7 +131,7 @@ void lire_gchar_str_with_deplacement(FILE* file, char str[MAX], int deplacement)
         str[ind++] = car; // Lire le caractère
     }
     str[ind] = '\0'; // Terminer la chaîne
-    printf("%s\n", str); // Afficher la chaîne lue
+    TRACER(TRACE_XML, TRACE_DEBUG, "%s", str); // Tracer la chaîne lue
     fseek(file, deplacement, SEEK_CUR);
 }
 //pour lire la valeur d'ume element item de comboBox
@@ -111,14 +145,16 @@ void lire_gchar_str_item(FILE* file,char str[MAX])
         str[ind++] = car; // Lire le mot
     }
     str[ind] = '\0';
-    printf("%s\n", str);
+    TRACER(TRACE_XML, TRACE_DEBUG, "item: %s", str);
     fseek(file, 6, SEEK_CUR);
 }
 
 
+int balise(FILE *file);
+
 ///retourne un indice sur la balise qu'on est sur laquelle
 ///baliseeeeeeee
-int balise(FILE *file)
+static int lire_balise(FILE *file)
 {
     char motlue[MAX],car;
     int ind;
@@ -167,6 +203,8 @@ int balise(FILE *file)
     else if (!(strcmp("</radioList",motlue))){return -31;}
     else if (!(strcmp("</checkboxList",motlue))){return -36;}
     else if(!(strcmp("<ProgressBar",motlue))) return 37;
+    else if(!(strcmp("<fixedvirtuel",motlue))) return 38;
+    else if(!(strcmp("</fixedvirtuel",motlue))) return -38;
 
     else if (!(strcmp("</checkbox",motlue))){return -3;}
     else if (!(strcmp("</radio",motlue))){return -4;}
@@ -186,14 +224,64 @@ int balise(FILE *file)
     }
     else if(!(strcmp("</menuitem",motlue))) {
         //fseek(file,8,SEEK_CUR);
-        balise(file);
+        //La fermeture du menuitem n'a pas de traitement: retourner la balise suivante
+        return balise(file);
     }
     else if(!(strcmp("</submenu",motlue))) {
         // balise(file);
         return -15;
     }
         return -1;
-}//fin de la fonction balise
+}//fin de la fonction lire_balise
+
+//Lecture d'une balise, mesurée pour le profil (voir trace.h)
+int balise(FILE *file)
+{
+    TRACE_SPAN_DEBUT(debut);
+    int id = lire_balise(file);
+    TRACE_SPAN_FIN(debut, TRACE_XML, "balise");
+    return id;
+}
+
+
+//Nom d'une balise pour le profil (chaine statique)
+static const char* nom_balise(int id)
+{
+    switch(id)
+    {
+        case 0: return "window";
+        case 1: return "fixed";
+        case 2: return "button";
+        case 3: return "checkbox";
+        case 5: return "label";
+        case 6: return "TextView";
+        case 12: return "Dialog";
+        case 13: return "menubarre";
+        case 17: return "box";
+        case 21: return "entry";
+        case 31: return "radioList";
+        case 37: return "ProgressBar";
+        case 38: return "fixedvirtuel";
+        default: return "balise inconnue";
+    }
+}
+
+//Mesure de la balise en cours de création: chaque objet appelle creer_object() pour son frère
+//(ou ses fils) à la fin de sa création, donc la mesure d'une balise se termine quand la
+//suivante commence. On obtient ainsi le temps propre de chaque balise.
+static gint64 balise_en_cours_debut = 0;
+static const char* balise_en_cours_nom = NULL;
+//Profondeur des appels imbriqués de creer_object()
+static int creer_object_profondeur = 0;
+
+static void fermer_mesure_balise()
+{
+    if(balise_en_cours_debut)
+    {
+        trace_span_ecrire(TRACE_XML, balise_en_cours_nom, balise_en_cours_debut);
+        balise_en_cours_debut = 0;
+    }
+}
 
 
 //void creer_object(FILE *file,int parent);
@@ -207,8 +295,16 @@ int balise(FILE *file)
 //              cette derniere doit contenir les objets qu'on veut creer
 void creer_object(FILE *file,int parent)
 {
+    fermer_mesure_balise();
+    TRACE_SPAN_DEBUT(debut);
     //L'identifiant du type de balise (label ou window ou...)
     int id = balise(file);
+    if(debut)
+    {
+        balise_en_cours_debut = debut;
+        balise_en_cours_nom = nom_balise(id);
+    }
+    creer_object_profondeur++;
     //Creation de widget en fonction de la balise
     switch(id)
     {
@@ -245,10 +341,11 @@ void creer_object(FILE *file,int parent)
         case 17: box_xml(file,parent);break;
         case 31:radioList_xml(file,parent);break;
         case 37: ProgressBar_xml(file, parent); break;
+        case 13: menu_barre_xml(file,parent);break;
+        case 38: fixed_virtuel_xml(file,parent);break;
 
 
         /*
-        case 13: menu_barre_xml(file,parent);break;
         case 20: comboBox_xml(file,parent);break;
         case 30:calender_xml(file,parent);break;
          */
@@ -257,7 +354,13 @@ void creer_object(FILE *file,int parent)
         case 33:image_xml(file,parent);break;
         case 34:spin_xml(file,parent);break;
         */
-        default:printf("pas de children");break;
+        default:TRACER(TRACE_XML, TRACE_DEBUG, "pas de children");break;
+    }
+    //Fin du chargement du fichier
+    if(--creer_object_profondeur == 0)
+    {
+        fermer_mesure_balise();
+        TRACE_SPAN_FIN(debut, TRACE_XML, "chargement XML");
     }
 }
 
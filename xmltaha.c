@@ -0,0 +1,223 @@
+//
+// Created by ACER on 06/01/2025.
+//
+// Bibliothèque libxmltaha (voir xmltaha.h): seule unité de compilation qui inclut le chargeur.
+// Les fichiers .h du chargeur définissent leurs fonctions et leurs variables globales: ils ne
+// doivent être inclus que dans ce fichier, les applications passent par l'API de xmltaha.h.
+//
+
+#define XMLTAHA_COMPILATION
+#include <errno.h>
+#include <gtk/gtk.h>
+#include "global.h"
+#include "xml_utility.h"
+#include "bouton_xml.h"
+#include "checkbox_xml.h"
+#include "dialog_xml.h"
+#include "radio_xml.h"
+#include "box.h"
+#include "menu_xml.h"
+#include "fixed_virtuel_xml.h"
+#include "xmltaha.h"
+
+struct XmlTahaLayout {
+    GPtrArray* fenetres;     //Fenetres créées par le chargement (la principale en premier)
+    GHashTable* noms;        //Nom -> GtkWidget (non référencé, retiré à sa destruction)
+};
+
+GQuark xmltaha_erreur_quark(void) {
+    return g_quark_from_static_string("xmltaha-erreur-quark");
+}
+
+static gboolean xmltaha_meme_widget(gpointer nom, gpointer widget, gpointer data) {
+    return widget == data;
+}
+
+//Retire un widget détruit de l'index (et de la liste des fenetres)
+static void xmltaha_widget_detruit(GtkWidget* widget, gpointer data) {
+    XmlTahaLayout* layout = data;
+    const gchar* nom = gtk_widget_get_name(widget);
+    if (g_hash_table_lookup(layout->noms, nom) == widget)
+        g_hash_table_remove(layout->noms, nom);
+    else //Renommé depuis le chargement
+        g_hash_table_foreach_remove(layout->noms, xmltaha_meme_widget, widget);
+    g_ptr_array_remove(layout->fenetres, widget);
+}
+
+//Ajoute le widget et ses descendants à l'index: le premier widget d'un nom l'emporte,
+//les widgets sans nom (gtk_widget_get_name rend alors le nom du type) sont ignorés.
+static void xmltaha_indexer(GtkWidget* widget, gpointer data) {
+    XmlTahaLayout* layout = data;
+    const gchar* nom = gtk_widget_get_name(widget);
+    if (nom && strcmp(nom, G_OBJECT_TYPE_NAME(widget)) != 0 && !g_hash_table_contains(layout->noms, nom)) {
+        g_hash_table_insert(layout->noms, g_strdup(nom), widget);
+        g_signal_connect(widget, "destroy", G_CALLBACK(xmltaha_widget_detruit), layout);
+    }
+    if (GTK_IS_CONTAINER(widget))
+        gtk_container_forall(GTK_CONTAINER(widget), xmltaha_indexer, layout);
+}
+
+//Fenetre créée par le chargement: index et suivi de sa destruction
+static void xmltaha_ajouter_fenetre(XmlTahaLayout* layout, GtkWidget* fenetre) {
+    if (g_ptr_array_find(layout->fenetres, fenetre, NULL))
+        return;
+    g_ptr_array_add(layout->fenetres, fenetre);
+    if (!g_signal_handler_find(fenetre, G_SIGNAL_MATCH_FUNC | G_SIGNAL_MATCH_DATA, 0, 0, NULL,
+                               G_CALLBACK(xmltaha_widget_detruit), layout))
+        g_signal_connect(fenetre, "destroy", G_CALLBACK(xmltaha_widget_detruit), layout);
+    xmltaha_indexer(fenetre, layout);
+}
+
+/**********************************************************************************************************
+ Nom            : xmltaha_charger()
+ Entrée         : file - Fichier XML ouvert en lecture
+                  erreur - Erreur à remplir en cas d'échec (peut etre NULL)
+ Sortie         : Le layout chargé, NULL si le document n'a créé aucune fenetre
+ Description    : Remet à zéro l'état global du chargeur, crée les widgets du document dans un seul
+                  lot d'affichage, puis retrouve les fenetres créées (la fenetre principale et les
+                  boites de dialogue) en comparant la liste des fenetres avant et après.
+**********************************************************************************************************/
+static XmlTahaLayout* xmltaha_charger(FILE* file, GError** erreur) {
+    for (int i = 0; i < 5; i++)
+        parents[i] = NULL;
+    hasOverlay = 0;
+    overlay = NULL;
+
+    GList* avant = gtk_window_list_toplevels();
+    debut_lot_affichage();
+    creer_object(file, 0);
+    fin_lot_affichage();
+    GList* apres = gtk_window_list_toplevels();
+
+    XmlTahaLayout* layout = memoire_allouer0(MEMOIRE_WIDGETS, sizeof(XmlTahaLayout));
+    layout->fenetres = g_ptr_array_new();
+    layout->noms = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+    if (parents[0] && GTK_IS_WINDOW(parents[0]))
+        xmltaha_ajouter_fenetre(layout, parents[0]);
+    for (GList* l = apres; l; l = l->next) {
+        GtkWindow* fenetre = l->data;
+        if (!g_list_find(avant, fenetre) && gtk_window_get_window_type(fenetre) == GTK_WINDOW_TOPLEVEL)
+            xmltaha_ajouter_fenetre(layout, GTK_WIDGET(fenetre));
+    }
+    g_list_free(avant);
+    g_list_free(apres);
+
+    if (layout->fenetres->len == 0) {
+        g_set_error_literal(erreur, XMLTAHA_ERREUR, XMLTAHA_ERREUR_VIDE,
+                            "Le document n'a créé aucune fenetre");
+        xmltaha_liberer(layout);
+        return NULL;
+    }
+    TRACER(TRACE_XML, TRACE_INFO, "layout chargé: %u fenetre(s), %u widget(s) nommé(s)",
+           layout->fenetres->len, g_hash_table_size(layout->noms));
+    return layout;
+}
+
+XmlTahaLayout* xmltaha_charger_fichier(const gchar* chemin, GError** erreur) {
+    g_return_val_if_fail(chemin != NULL, NULL);
+    FILE* file = fopen(chemin, "r");
+    if (!file) {
+        int code = errno;
+        g_set_error(erreur, G_FILE_ERROR, g_file_error_from_errno(code),
+                    "Impossible d'ouvrir %s: %s", chemin, g_strerror(code));
+        return NULL;
+    }
+    XmlTahaLayout* layout = xmltaha_charger(file, erreur);
+    fclose(file);
+    return layout;
+}
+
+XmlTahaLayout* xmltaha_charger_memoire(const gchar* texte, gssize taille, GError** erreur) {
+    g_return_val_if_fail(texte != NULL, NULL);
+    gsize n = taille < 0 ? strlen(texte) : (gsize)taille;
+    if (n == 0) {
+        g_set_error_literal(erreur, XMLTAHA_ERREUR, XMLTAHA_ERREUR_VIDE, "Document vide");
+        return NULL;
+    }
+    FILE* file = ouvrir_texte_xml(texte, n);
+    if (!file) {
+        int code = errno;
+        g_set_error(erreur, G_FILE_ERROR, g_file_error_from_errno(code),
+                    "Impossible de lire le document en mémoire: %s", g_strerror(code));
+        return NULL;
+    }
+    XmlTahaLayout* layout = xmltaha_charger(file, erreur);
+    fclose(file);
+    return layout;
+}
+
+XmlTahaLayout* xmltaha_charger_octets(GBytes* octets, GError** erreur) {
+    g_return_val_if_fail(octets != NULL, NULL);
+    gsize taille = 0;
+    const gchar* texte = g_bytes_get_data(octets, &taille);
+    return xmltaha_charger_memoire(texte ? texte : "", taille, erreur);
+}
+
+XmlTahaLayout* xmltaha_charger_ressource(const gchar* chemin, GError** erreur) {
+    g_return_val_if_fail(chemin != NULL, NULL);
+    GBytes* octets = g_resources_lookup_data(chemin, G_RESOURCE_LOOKUP_FLAGS_NONE, erreur);
+    if (!octets)
+        return NULL;
+    XmlTahaLayout* layout = xmltaha_charger_octets(octets, erreur);
+    g_bytes_unref(octets);
+    return layout;
+}
+
+GtkWidget* xmltaha_fenetre(XmlTahaLayout* layout) {
+    if (!layout || layout->fenetres->len == 0)
+        return NULL;
+    return g_ptr_array_index(layout->fenetres, 0);
+}
+
+GtkWidget* xmltaha_chercher(XmlTahaLayout* layout, const gchar* nom) {
+    if (!layout || !nom)
+        return NULL;
+    return g_hash_table_lookup(layout->noms, nom);
+}
+
+gulong xmltaha_connecter(XmlTahaLayout* layout, const gchar* nom, const gchar* signal,
+                         GCallback fonction, gpointer donnees) {
+    g_return_val_if_fail(signal != NULL && fonction != NULL, 0);
+    GtkWidget* widget = xmltaha_chercher(layout, nom);
+    if (!widget) {
+        TRACER(TRACE_XML, TRACE_AVERT, "xmltaha_connecter: pas de widget nommé '%s'", nom ? nom : "(null)");
+        return 0;
+    }
+    return g_signal_connect(widget, signal, fonction, donnees);
+}
+
+const gchar* xmltaha_valeur_virtuelle(XmlTahaLayout* layout, const gchar* conteneur,
+                                     const gchar* nom, const gchar* propriete) {
+    g_return_val_if_fail(propriete != NULL, NULL);
+    Arbre* noeud = fixed_virtuel_chercher(fixed_virtuel_du_scroll(xmltaha_chercher(layout, conteneur)), nom);
+    return noeud ? get_property_of_node(noeud, propriete) : NULL;
+}
+
+guint xmltaha_connecter_table(XmlTahaLayout* layout, const XmlTahaConnexion* table, gpointer donnees) {
+    guint manquants = 0;
+    for (const XmlTahaConnexion* c = table; c && c->nom; c++)
+        if (!xmltaha_connecter(layout, c->nom, c->signal, c->fonction, donnees))
+            manquants++;
+    return manquants;
+}
+
+void xmltaha_liberer(XmlTahaLayout* layout) {
+    if (!layout)
+        return;
+    //Les widgets qui survivent au layout (déplacés ailleurs par l'application) ne doivent
+    //plus le prévenir de leur destruction
+    GHashTableIter iter;
+    gpointer widget;
+    g_hash_table_iter_init(&iter, layout->noms);
+    while (g_hash_table_iter_next(&iter, NULL, &widget))
+        g_signal_handlers_disconnect_by_data(widget, layout);
+    for (guint i = 0; i < layout->fenetres->len; i++)
+        g_signal_handlers_disconnect_by_data(g_ptr_array_index(layout->fenetres, i), layout);
+    //Les fenetres déjà détruites ont été retirées de la liste par xmltaha_widget_detruit()
+    for (guint i = layout->fenetres->len; i > 0; i--)
+        gtk_widget_destroy(g_ptr_array_index(layout->fenetres, i - 1));
+    g_ptr_array_unref(layout->fenetres);
+    g_hash_table_unref(layout->noms);
+    memoire_liberer(layout);
+}
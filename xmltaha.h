@@ -0,0 +1,98 @@
+//
+// Created by ACER on 06/01/2025.
+//
+// API publique de libxmltaha: chargement d'un layout XML et accès à ses widgets.
+// Le chargeur (xml_utility.h, bouton_xml.h, label.h...) est compilé une seule fois dans la
+// bibliothèque (xmltaha.c); une application inclut seulement ce fichier et se lie à xmltaha.
+//
+// Exemple:
+//     XmlTahaLayout* l = xmltaha_charger_fichier("demo.html", &err);
+//     xmltaha_connecter(l, "b1", "clicked", G_CALLBACK(on_b1), NULL);
+//     ...
+//     xmltaha_liberer(l);
+//
+// Le chargeur garde son état dans des variables globales (parents[], overlay...): les
+// fonctions de chargement s'appellent depuis le thread GTK, un chargement à la fois.
+//
+
+#ifndef XMLTAHA_H
+#define XMLTAHA_H
+#include <gtk/gtk.h>
+
+G_BEGIN_DECLS
+
+//Symboles exportés par la bibliothèque (XMLTAHA_COMPILATION est défini en la compilant,
+//XMLTAHA_PARTAGEE quand elle est construite en bibliothèque partagée)
+#if defined(_WIN32) && defined(XMLTAHA_PARTAGEE)
+#  ifdef XMLTAHA_COMPILATION
+#    define XMLTAHA_API __declspec(dllexport)
+#  else
+#    define XMLTAHA_API __declspec(dllimport)
+#  endif
+#elif defined(__GNUC__) && defined(XMLTAHA_COMPILATION)
+#  define XMLTAHA_API __attribute__((visibility("default")))
+#else
+#  define XMLTAHA_API
+#endif
+
+//Erreurs rendues dans le GError des fonctions de chargement (en plus de G_FILE_ERROR)
+#define XMLTAHA_ERREUR (xmltaha_erreur_quark())
+typedef enum {
+    XMLTAHA_ERREUR_VIDE          //Le document n'a créé aucune fenetre
+} XmlTahaErreur;
+
+//Layout chargé: les fenetres créées et l'index de leurs widgets par nom
+typedef struct XmlTahaLayout XmlTahaLayout;
+
+//Une ligne d'une table de connexion (terminée par une ligne dont 'nom' est NULL)
+typedef struct {
+    const gchar* nom;        //Nom du widget (propriété "nom" du XML)
+    const gchar* signal;     //Signal GTK, par exemple "clicked"
+    GCallback fonction;
+} XmlTahaConnexion;
+
+XMLTAHA_API GQuark xmltaha_erreur_quark(void);
+
+//Charge le layout d'un fichier XML. Rend NULL et remplit 'erreur' en cas d'échec.
+XMLTAHA_API XmlTahaLayout* xmltaha_charger_fichier(const gchar* chemin, GError** erreur);
+
+//Charge un layout depuis un texte XML en mémoire ('taille' octets, -1 si terminé par '\0')
+XMLTAHA_API XmlTahaLayout* xmltaha_charger_memoire(const gchar* texte, gssize taille, GError** erreur);
+
+//Charge un layout depuis un bloc d'octets, par exemple lu d'une GResource compilée dans
+//l'application (voir xmltaha_charger_ressource)
+XMLTAHA_API XmlTahaLayout* xmltaha_charger_octets(GBytes* octets, GError** erreur);
+
+//Charge un layout enregistré dans les ressources de l'application (chemin "/org/.../x.html")
+XMLTAHA_API XmlTahaLayout* xmltaha_charger_ressource(const gchar* chemin, GError** erreur);
+
+//Fenetre principale du layout (la première créée), NULL si elle a été détruite
+XMLTAHA_API GtkWidget* xmltaha_fenetre(XmlTahaLayout* layout);
+
+//Widget de nom 'nom' (gtk_widget_get_name), NULL s'il n'existe pas ou a été détruit
+XMLTAHA_API GtkWidget* xmltaha_chercher(XmlTahaLayout* layout, const gchar* nom);
+
+//Connecte 'fonction' au signal d'un widget nommé. Rend l'identifiant du gestionnaire,
+//0 si le widget n'existe pas.
+XMLTAHA_API gulong xmltaha_connecter(XmlTahaLayout* layout, const gchar* nom, const gchar* signal,
+                                     GCallback fonction, gpointer donnees);
+
+//Connecte toute une table; rend le nombre de lignes dont le widget n'a pas été trouvé
+XMLTAHA_API guint xmltaha_connecter_table(XmlTahaLayout* layout, const XmlTahaConnexion* table,
+                                          gpointer donnees);
+
+//Propriété d'un fils d'un <fixedvirtuel> nommé 'conteneur' (par exemple "default_text" d'une
+//entry ou "active" d'une case). Les fils ne sont construits que lorsqu'ils sont visibles: leurs
+//widgets ne sont pas dans l'index de xmltaha_chercher, leurs propriétés suivent les saisies.
+//Rend NULL si le conteneur, le fils ou la propriété n'existe pas; la chaine appartient au layout
+//et change avec la prochaine saisie.
+XMLTAHA_API const gchar* xmltaha_valeur_virtuelle(XmlTahaLayout* layout, const gchar* conteneur,
+                                                  const gchar* nom, const gchar* propriete);
+
+//Détruit les fenetres du layout encore vivantes (leurs structures sont libérées avec elles)
+//et libère le layout. NULL accepté.
+XMLTAHA_API void xmltaha_liberer(XmlTahaLayout* layout);
+
+G_END_DECLS
+
+#endif //XMLTAHA_H